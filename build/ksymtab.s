@@ -0,0 +1,1194 @@
+.section .ksymtab, "a"
+.balign 8
+.global KernelSymbolAmount
+KernelSymbolAmount:
+    .quad 593
+.global KernelSymbols
+KernelSymbols:
+    .quad 0x0000000000100000, .LName0
+    .quad 0x0000000000100400, .LName1
+    .quad 0x0000000000100460, .LName2
+    .quad 0x0000000000103900, .LName3
+    .quad 0x0000000000103913, .LName4
+    .quad 0x000000000010397c, .LName5
+    .quad 0x00000000001039d8, .LName6
+    .quad 0x00000000001039e0, .LName7
+    .quad 0x0000000000103a3c, .LName8
+    .quad 0x0000000000103a72, .LName9
+    .quad 0x0000000000103aa8, .LName10
+    .quad 0x0000000000103bfc, .LName11
+    .quad 0x0000000000104552, .LName12
+    .quad 0x0000000000104593, .LName13
+    .quad 0x00000000001045cd, .LName14
+    .quad 0x00000000001045e8, .LName15
+    .quad 0x00000000001046c9, .LName16
+    .quad 0x00000000001046d1, .LName17
+    .quad 0x00000000001046d9, .LName18
+    .quad 0x00000000001046e1, .LName19
+    .quad 0x000000000010471b, .LName20
+    .quad 0x0000000000104735, .LName21
+    .quad 0x0000000000104739, .LName22
+    .quad 0x000000000010473c, .LName23
+    .quad 0x000000000010474a, .LName24
+    .quad 0x0000000000104759, .LName25
+    .quad 0x000000000010475a, .LName26
+    .quad 0x000000000010495b, .LName27
+    .quad 0x0000000000104e88, .LName28
+    .quad 0x00000000001056c1, .LName29
+    .quad 0x00000000001056cb, .LName30
+    .quad 0x00000000001056d9, .LName31
+    .quad 0x0000000000105703, .LName32
+    .quad 0x0000000000105784, .LName33
+    .quad 0x0000000000105840, .LName34
+    .quad 0x0000000000105856, .LName35
+    .quad 0x00000000001058dd, .LName36
+    .quad 0x00000000001058fb, .LName37
+    .quad 0x0000000000105c24, .LName38
+    .quad 0x0000000000105c2c, .LName39
+    .quad 0x0000000000105c34, .LName40
+    .quad 0x0000000000105c3a, .LName41
+    .quad 0x0000000000105c3e, .LName42
+    .quad 0x0000000000105c45, .LName43
+    .quad 0x0000000000105c4a, .LName44
+    .quad 0x0000000000105c4f, .LName45
+    .quad 0x0000000000105c9e, .LName46
+    .quad 0x0000000000105d8d, .LName47
+    .quad 0x0000000000105dd2, .LName48
+    .quad 0x0000000000105e39, .LName49
+    .quad 0x0000000000105e41, .LName50
+    .quad 0x0000000000105e4f, .LName51
+    .quad 0x0000000000105e96, .LName52
+    .quad 0x0000000000105ef8, .LName53
+    .quad 0x0000000000105f2e, .LName54
+    .quad 0x0000000000105fc3, .LName55
+    .quad 0x0000000000105fcd, .LName56
+    .quad 0x000000000010604c, .LName57
+    .quad 0x000000000010605b, .LName58
+    .quad 0x0000000000106063, .LName59
+    .quad 0x000000000010608c, .LName60
+    .quad 0x000000000010609c, .LName61
+    .quad 0x00000000001060b8, .LName62
+    .quad 0x00000000001060d4, .LName63
+    .quad 0x0000000000106131, .LName64
+    .quad 0x0000000000106156, .LName65
+    .quad 0x0000000000106304, .LName66
+    .quad 0x00000000001063e7, .LName67
+    .quad 0x0000000000106490, .LName68
+    .quad 0x00000000001064d3, .LName69
+    .quad 0x00000000001064f0, .LName70
+    .quad 0x000000000010650d, .LName71
+    .quad 0x000000000010652a, .LName72
+    .quad 0x0000000000106547, .LName73
+    .quad 0x000000000010658a, .LName74
+    .quad 0x00000000001065a7, .LName75
+    .quad 0x00000000001065c4, .LName76
+    .quad 0x00000000001065e1, .LName77
+    .quad 0x00000000001065fe, .LName78
+    .quad 0x000000000010661b, .LName79
+    .quad 0x000000000010666a, .LName80
+    .quad 0x0000000000106710, .LName81
+    .quad 0x000000000010672d, .LName82
+    .quad 0x00000000001067e3, .LName83
+    .quad 0x0000000000106859, .LName84
+    .quad 0x0000000000106921, .LName85
+    .quad 0x000000000010697c, .LName86
+    .quad 0x0000000000106992, .LName87
+    .quad 0x00000000001069ac, .LName88
+    .quad 0x00000000001069d7, .LName89
+    .quad 0x00000000001069fd, .LName90
+    .quad 0x0000000000106a23, .LName91
+    .quad 0x0000000000106f6a, .LName92
+    .quad 0x0000000000106fe9, .LName93
+    .quad 0x0000000000107097, .LName94
+    .quad 0x0000000000107139, .LName95
+    .quad 0x000000000010727f, .LName96
+    .quad 0x00000000001074e7, .LName97
+    .quad 0x00000000001074ff, .LName98
+    .quad 0x0000000000107518, .LName99
+    .quad 0x0000000000107534, .LName100
+    .quad 0x0000000000107550, .LName101
+    .quad 0x000000000010756c, .LName102
+    .quad 0x000000000010767d, .LName103
+    .quad 0x00000000001076a5, .LName104
+    .quad 0x00000000001077e5, .LName105
+    .quad 0x00000000001077ed, .LName106
+    .quad 0x0000000000107829, .LName107
+    .quad 0x00000000001078aa, .LName108
+    .quad 0x00000000001079da, .LName109
+    .quad 0x00000000001079e0, .LName110
+    .quad 0x00000000001079ea, .LName111
+    .quad 0x0000000000107a1c, .LName112
+    .quad 0x0000000000107a24, .LName113
+    .quad 0x0000000000107a43, .LName114
+    .quad 0x0000000000107a62, .LName115
+    .quad 0x0000000000107a7b, .LName116
+    .quad 0x0000000000107ae6, .LName117
+    .quad 0x0000000000107b76, .LName118
+    .quad 0x0000000000107b98, .LName119
+    .quad 0x0000000000107c03, .LName120
+    .quad 0x0000000000107c4f, .LName121
+    .quad 0x0000000000107c8b, .LName122
+    .quad 0x0000000000107d04, .LName123
+    .quad 0x0000000000107d22, .LName124
+    .quad 0x0000000000107d56, .LName125
+    .quad 0x0000000000107e17, .LName126
+    .quad 0x0000000000108014, .LName127
+    .quad 0x000000000010805b, .LName128
+    .quad 0x00000000001080c3, .LName129
+    .quad 0x000000000010810f, .LName130
+    .quad 0x0000000000108117, .LName131
+    .quad 0x0000000000108135, .LName132
+    .quad 0x0000000000108162, .LName133
+    .quad 0x00000000001081a9, .LName134
+    .quad 0x00000000001081ec, .LName135
+    .quad 0x00000000001081f4, .LName136
+    .quad 0x0000000000108261, .LName137
+    .quad 0x0000000000108291, .LName138
+    .quad 0x00000000001082d6, .LName139
+    .quad 0x000000000010831e, .LName140
+    .quad 0x00000000001084af, .LName141
+    .quad 0x0000000000108530, .LName142
+    .quad 0x0000000000108590, .LName143
+    .quad 0x0000000000108590, .LName144
+    .quad 0x00000000001085ce, .LName145
+    .quad 0x000000000010871a, .LName146
+    .quad 0x0000000000108828, .LName147
+    .quad 0x0000000000108a3e, .LName148
+    .quad 0x0000000000108a53, .LName149
+    .quad 0x0000000000108a72, .LName150
+    .quad 0x0000000000108b6e, .LName151
+    .quad 0x0000000000108bc4, .LName152
+    .quad 0x0000000000108d35, .LName153
+    .quad 0x0000000000108d6d, .LName154
+    .quad 0x0000000000108d8a, .LName155
+    .quad 0x0000000000108f30, .LName156
+    .quad 0x0000000000108fb7, .LName157
+    .quad 0x0000000000108fca, .LName158
+    .quad 0x0000000000109011, .LName159
+    .quad 0x000000000010904f, .LName160
+    .quad 0x0000000000109062, .LName161
+    .quad 0x0000000000109086, .LName162
+    .quad 0x00000000001090ed, .LName163
+    .quad 0x000000000010914f, .LName164
+    .quad 0x0000000000109177, .LName165
+    .quad 0x0000000000109252, .LName166
+    .quad 0x00000000001095eb, .LName167
+    .quad 0x0000000000109602, .LName168
+    .quad 0x0000000000109698, .LName169
+    .quad 0x000000000010969e, .LName170
+    .quad 0x00000000001096a4, .LName171
+    .quad 0x00000000001096c2, .LName172
+    .quad 0x00000000001097ac, .LName173
+    .quad 0x00000000001097b0, .LName174
+    .quad 0x00000000001097bc, .LName175
+    .quad 0x0000000000109816, .LName176
+    .quad 0x0000000000109820, .LName177
+    .quad 0x0000000000109828, .LName178
+    .quad 0x0000000000109830, .LName179
+    .quad 0x0000000000109836, .LName180
+    .quad 0x0000000000109922, .LName181
+    .quad 0x000000000010992a, .LName182
+    .quad 0x0000000000109950, .LName183
+    .quad 0x0000000000109988, .LName184
+    .quad 0x0000000000109a0e, .LName185
+    .quad 0x0000000000109a8c, .LName186
+    .quad 0x0000000000109bea, .LName187
+    .quad 0x000000000010a08e, .LName188
+    .quad 0x000000000010a0a6, .LName189
+    .quad 0x000000000010a0e2, .LName190
+    .quad 0x000000000010a0e8, .LName191
+    .quad 0x000000000010a13e, .LName192
+    .quad 0x000000000010a144, .LName193
+    .quad 0x000000000010a188, .LName194
+    .quad 0x000000000010a188, .LName195
+    .quad 0x000000000010a3bb, .LName196
+    .quad 0x000000000010a44a, .LName197
+    .quad 0x000000000010a4b8, .LName198
+    .quad 0x000000000010a4f9, .LName199
+    .quad 0x000000000010a52c, .LName200
+    .quad 0x000000000010a71b, .LName201
+    .quad 0x000000000010a766, .LName202
+    .quad 0x000000000010a7cd, .LName203
+    .quad 0x000000000010a7d2, .LName204
+    .quad 0x000000000010a883, .LName205
+    .quad 0x000000000010a8aa, .LName206
+    .quad 0x000000000010a8f6, .LName207
+    .quad 0x000000000010a945, .LName208
+    .quad 0x000000000010ab43, .LName209
+    .quad 0x000000000010ab53, .LName210
+    .quad 0x000000000010abd9, .LName211
+    .quad 0x000000000010ac2c, .LName212
+    .quad 0x000000000010ac6f, .LName213
+    .quad 0x000000000010acb6, .LName214
+    .quad 0x000000000010ada6, .LName215
+    .quad 0x000000000010ae7f, .LName216
+    .quad 0x000000000010aecc, .LName217
+    .quad 0x000000000010aed4, .LName218
+    .quad 0x000000000010aee7, .LName219
+    .quad 0x000000000010aefa, .LName220
+    .quad 0x000000000010af31, .LName221
+    .quad 0x000000000010af73, .LName222
+    .quad 0x000000000010b036, .LName223
+    .quad 0x000000000010b0c9, .LName224
+    .quad 0x000000000010b122, .LName225
+    .quad 0x000000000010b12a, .LName226
+    .quad 0x000000000010b132, .LName227
+    .quad 0x000000000010b356, .LName228
+    .quad 0x000000000010b4a4, .LName229
+    .quad 0x000000000010b591, .LName230
+    .quad 0x000000000010b5db, .LName231
+    .quad 0x000000000010b662, .LName232
+    .quad 0x000000000010b6a2, .LName233
+    .quad 0x000000000010b6aa, .LName234
+    .quad 0x000000000010b6c5, .LName235
+    .quad 0x000000000010b726, .LName236
+    .quad 0x000000000010b77e, .LName237
+    .quad 0x000000000010b7d6, .LName238
+    .quad 0x000000000010b82e, .LName239
+    .quad 0x000000000010b8fe, .LName240
+    .quad 0x000000000010b9cc, .LName241
+    .quad 0x000000000010ba0c, .LName242
+    .quad 0x000000000010ba68, .LName243
+    .quad 0x000000000010baa8, .LName244
+    .quad 0x000000000010bb02, .LName245
+    .quad 0x000000000010e73b, .LName246
+    .quad 0x000000000010ea36, .LName247
+    .quad 0x000000000010ea69, .LName248
+    .quad 0x000000000010ed73, .LName249
+    .quad 0x000000000010ed76, .LName250
+    .quad 0x000000000010ed90, .LName251
+    .quad 0x000000000010ed98, .LName252
+    .quad 0x000000000010eda0, .LName253
+    .quad 0x000000000010edda, .LName254
+    .quad 0x000000000010f211, .LName255
+    .quad 0x000000000010f26c, .LName256
+    .quad 0x000000000010f2cb, .LName257
+    .quad 0x000000000010f374, .LName258
+    .quad 0x0000000000110026, .LName259
+    .quad 0x0000000000110026, .LName260
+    .quad 0x0000000000110052, .LName261
+    .quad 0x000000000011025e, .LName262
+    .quad 0x00000000001102ef, .LName263
+    .quad 0x00000000001103af, .LName264
+    .quad 0x00000000001103d0, .LName265
+    .quad 0x00000000001103f0, .LName266
+    .quad 0x0000000000110659, .LName267
+    .quad 0x00000000001108a7, .LName268
+    .quad 0x000000000011091a, .LName269
+    .quad 0x0000000000110c98, .LName270
+    .quad 0x0000000000110c98, .LName271
+    .quad 0x0000000000110ca1, .LName272
+    .quad 0x0000000000110d48, .LName273
+    .quad 0x0000000000110d57, .LName274
+    .quad 0x00000000001111d3, .LName275
+    .quad 0x0000000000111250, .LName276
+    .quad 0x0000000000111368, .LName277
+    .quad 0x00000000001118b2, .LName278
+    .quad 0x00000000001118b2, .LName279
+    .quad 0x00000000001118bb, .LName280
+    .quad 0x000000000011195f, .LName281
+    .quad 0x000000000011196e, .LName282
+    .quad 0x0000000000111c3a, .LName283
+    .quad 0x0000000000111cb7, .LName284
+    .quad 0x0000000000111ce6, .LName285
+    .quad 0x0000000000111e9a, .LName286
+    .quad 0x0000000000111ebb, .LName287
+    .quad 0x0000000000111f00, .LName288
+    .quad 0x0000000000111f0c, .LName289
+    .quad 0x0000000000111f2b, .LName290
+    .quad 0x0000000000111f62, .LName291
+    .quad 0x0000000000111f6a, .LName292
+    .quad 0x0000000000111f72, .LName293
+    .quad 0x0000000000111f7a, .LName294
+    .quad 0x0000000000111f82, .LName295
+    .quad 0x0000000000111f8a, .LName296
+    .quad 0x0000000000111f92, .LName297
+    .quad 0x0000000000111f9a, .LName298
+    .quad 0x0000000000111fc0, .LName299
+    .quad 0x0000000000111fe0, .LName300
+    .quad 0x000000000011218a, .LName301
+    .quad 0x000000000011220d, .LName302
+    .quad 0x00000000001122ca, .LName303
+    .quad 0x0000000000112376, .LName304
+    .quad 0x0000000000112560, .LName305
+    .quad 0x0000000000112628, .LName306
+    .quad 0x000000000011264f, .LName307
+    .quad 0x0000000000112682, .LName308
+    .quad 0x00000000001126ab, .LName309
+    .quad 0x00000000001126e0, .LName310
+    .quad 0x00000000001127ce, .LName311
+    .quad 0x00000000001127dd, .LName312
+    .quad 0x00000000001128bf, .LName313
+    .quad 0x00000000001129cf, .LName314
+    .quad 0x0000000000112a51, .LName315
+    .quad 0x0000000000112c2d, .LName316
+    .quad 0x0000000000112d7a, .LName317
+    .quad 0x0000000000112db7, .LName318
+    .quad 0x0000000000112ddc, .LName319
+    .quad 0x0000000000112df6, .LName320
+    .quad 0x0000000000112e44, .LName321
+    .quad 0x0000000000112ede, .LName322
+    .quad 0x0000000000112f8c, .LName323
+    .quad 0x0000000000112f94, .LName324
+    .quad 0x0000000000112f9c, .LName325
+    .quad 0x00000000001132b8, .LName326
+    .quad 0x00000000001132c8, .LName327
+    .quad 0x00000000001132ea, .LName328
+    .quad 0x000000000011334c, .LName329
+    .quad 0x00000000001133ae, .LName330
+    .quad 0x0000000000113476, .LName331
+    .quad 0x00000000001138fa, .LName332
+    .quad 0x0000000000113b24, .LName333
+    .quad 0x0000000000113b53, .LName334
+    .quad 0x0000000000113d48, .LName335
+    .quad 0x0000000000113e22, .LName336
+    .quad 0x0000000000113e52, .LName337
+    .quad 0x0000000000113e8a, .LName338
+    .quad 0x0000000000113e90, .LName339
+    .quad 0x0000000000113e90, .LName340
+    .quad 0x0000000000113ed8, .LName341
+    .quad 0x0000000000114042, .LName342
+    .quad 0x0000000000114042, .LName343
+    .quad 0x00000000001140be, .LName344
+    .quad 0x00000000001140e2, .LName345
+    .quad 0x000000000011429f, .LName346
+    .quad 0x000000000011430c, .LName347
+    .quad 0x000000000011449c, .LName348
+    .quad 0x00000000001144ee, .LName349
+    .quad 0x000000000011455a, .LName350
+    .quad 0x00000000001145c6, .LName351
+    .quad 0x0000000000114666, .LName352
+    .quad 0x0000000000114676, .LName353
+    .quad 0x00000000001146a6, .LName354
+    .quad 0x00000000001146be, .LName355
+    .quad 0x00000000001146e2, .LName356
+    .quad 0x0000000000114710, .LName357
+    .quad 0x00000000001148ea, .LName358
+    .quad 0x0000000000114a94, .LName359
+    .quad 0x0000000000114ba6, .LName360
+    .quad 0x0000000000114ca8, .LName361
+    .quad 0x0000000000114d48, .LName362
+    .quad 0x0000000000114dbe, .LName363
+    .quad 0x0000000000114dd0, .LName364
+    .quad 0x0000000000114dd4, .LName365
+    .quad 0x0000000000114dfc, .LName366
+    .quad 0x0000000000114e56, .LName367
+    .quad 0x0000000000114eb6, .LName368
+    .quad 0x0000000000114f14, .LName369
+    .quad 0x0000000000114f5a, .LName370
+    .quad 0x0000000000114fc4, .LName371
+    .quad 0x0000000000115024, .LName372
+    .quad 0x0000000000115092, .LName373
+    .quad 0x00000000001150d2, .LName374
+    .quad 0x000000000011512a, .LName375
+    .quad 0x000000000011517a, .LName376
+    .quad 0x00000000001151d6, .LName377
+    .quad 0x00000000001151fa, .LName378
+    .quad 0x0000000000115256, .LName379
+    .quad 0x00000000001152c0, .LName380
+    .quad 0x0000000000115320, .LName381
+    .quad 0x0000000000115360, .LName382
+    .quad 0x0000000000115360, .LName383
+    .quad 0x0000000000115382, .LName384
+    .quad 0x0000000000115382, .LName385
+    .quad 0x0000000000115396, .LName386
+    .quad 0x00000000001153a4, .LName387
+    .quad 0x00000000001154de, .LName388
+    .quad 0x0000000000115685, .LName389
+    .quad 0x000000000011580b, .LName390
+    .quad 0x0000000000115883, .LName391
+    .quad 0x000000000011597b, .LName392
+    .quad 0x0000000000115aba, .LName393
+    .quad 0x0000000000115b3e, .LName394
+    .quad 0x0000000000115b4c, .LName395
+    .quad 0x0000000000115b96, .LName396
+    .quad 0x0000000000115bd6, .LName397
+    .quad 0x0000000000115bfd, .LName398
+    .quad 0x0000000000115c3f, .LName399
+    .quad 0x0000000000115c7c, .LName400
+    .quad 0x0000000000116492, .LName401
+    .quad 0x00000000001164e2, .LName402
+    .quad 0x0000000000116532, .LName403
+    .quad 0x00000000001165d8, .LName404
+    .quad 0x000000000011662c, .LName405
+    .quad 0x0000000000116680, .LName406
+    .quad 0x00000000001166da, .LName407
+    .quad 0x0000000000116a76, .LName408
+    .quad 0x0000000000116cd4, .LName409
+    .quad 0x0000000000116e0f, .LName410
+    .quad 0x0000000000117206, .LName411
+    .quad 0x000000000011725f, .LName412
+    .quad 0x0000000000117272, .LName413
+    .quad 0x00000000001172a6, .LName414
+    .quad 0x00000000001172b6, .LName415
+    .quad 0x00000000001172de, .LName416
+    .quad 0x0000000000117356, .LName417
+    .quad 0x00000000001173c2, .LName418
+    .quad 0x00000000001173ca, .LName419
+    .quad 0x00000000001173ec, .LName420
+    .quad 0x0000000000117410, .LName421
+    .quad 0x000000000011747e, .LName422
+    .quad 0x00000000001174a1, .LName423
+    .quad 0x00000000001174c1, .LName424
+    .quad 0x0000000000117590, .LName425
+    .quad 0x00000000001175b0, .LName426
+    .quad 0x00000000001175d4, .LName427
+    .quad 0x00000000001175e6, .LName428
+    .quad 0x00000000001175f8, .LName429
+    .quad 0x000000000011760a, .LName430
+    .quad 0x000000000011761c, .LName431
+    .quad 0x000000000011762e, .LName432
+    .quad 0x0000000000117640, .LName433
+    .quad 0x0000000000117654, .LName434
+    .quad 0x000000000011766e, .LName435
+    .quad 0x0000000000117678, .LName436
+    .quad 0x0000000000117682, .LName437
+    .quad 0x0000000000117694, .LName438
+    .quad 0x00000000001176a6, .LName439
+    .quad 0x00000000001176b8, .LName440
+    .quad 0x00000000001176d2, .LName441
+    .quad 0x00000000001176e6, .LName442
+    .quad 0x0000000000117704, .LName443
+    .quad 0x0000000000117704, .LName444
+    .quad 0x000000000011770a, .LName445
+    .quad 0x0000000000117712, .LName446
+    .quad 0x00000000001177c2, .LName447
+    .quad 0x0000000000117822, .LName448
+    .quad 0x0000000000117834, .LName449
+    .quad 0x0000000000117842, .LName450
+    .quad 0x0000000000117846, .LName451
+    .quad 0x0000000000117874, .LName452
+    .quad 0x0000000000117880, .LName453
+    .quad 0x00000000001178ba, .LName454
+    .quad 0x0000000000117938, .LName455
+    .quad 0x0000000000117986, .LName456
+    .quad 0x0000000000117996, .LName457
+    .quad 0x0000000000117a08, .LName458
+    .quad 0x0000000000117a1a, .LName459
+    .quad 0x0000000000117a20, .LName460
+    .quad 0x0000000000117a26, .LName461
+    .quad 0x0000000000117a26, .LName462
+    .quad 0x0000000000117a3a, .LName463
+    .quad 0x0000000000117a3a, .LName464
+    .quad 0x0000000000117a48, .LName465
+    .quad 0x0000000000117abd, .LName466
+    .quad 0x0000000000117b14, .LName467
+    .quad 0x0000000000117b3b, .LName468
+    .quad 0x0000000000117b61, .LName469
+    .quad 0x0000000000117b88, .LName470
+    .quad 0x0000000000117ba1, .LName471
+    .quad 0x0000000000117bc6, .LName472
+    .quad 0x0000000000117beb, .LName473
+    .quad 0x0000000000117d46, .LName474
+    .quad 0x0000000000117d56, .LName475
+    .quad 0x0000000000117d7e, .LName476
+    .quad 0x0000000000117d86, .LName477
+    .quad 0x0000000000117d9a, .LName478
+    .quad 0x0000000000117de6, .LName479
+    .quad 0x0000000000117e2c, .LName480
+    .quad 0x0000000000117e39, .LName481
+    .quad 0x0000000000117e45, .LName482
+    .quad 0x0000000000117e52, .LName483
+    .quad 0x0000000000117e5f, .LName484
+    .quad 0x0000000000117e69, .LName485
+    .quad 0x0000000000117e76, .LName486
+    .quad 0x0000000000117e83, .LName487
+    .quad 0x0000000000117e90, .LName488
+    .quad 0x0000000000117eac, .LName489
+    .quad 0x0000000000117eb9, .LName490
+    .quad 0x0000000000117ec6, .LName491
+    .quad 0x0000000000117eea, .LName492
+    .quad 0x0000000000117ef7, .LName493
+    .quad 0x0000000000117f17, .LName494
+    .quad 0x0000000000117f24, .LName495
+    .quad 0x0000000000117f32, .LName496
+    .quad 0x0000000000117f42, .LName497
+    .quad 0x0000000000117f4a, .LName498
+    .quad 0x0000000000117f52, .LName499
+    .quad 0x0000000000117f5a, .LName500
+    .quad 0x0000000000117f96, .LName501
+    .quad 0x0000000000117fb2, .LName502
+    .quad 0x0000000000117fce, .LName503
+    .quad 0x0000000000117ffc, .LName504
+    .quad 0x0000000000118025, .LName505
+    .quad 0x00000000001180a4, .LName506
+    .quad 0x00000000001180c5, .LName507
+    .quad 0x00000000001180de, .LName508
+    .quad 0x0000000000118140, .LName509
+    .quad 0x0000000000118169, .LName510
+    .quad 0x00000000001181ba, .LName511
+    .quad 0x0000000000118297, .LName512
+    .quad 0x0000000000118304, .LName513
+    .quad 0x000000000011838b, .LName514
+    .quad 0x0000000000118393, .LName515
+    .quad 0x00000000001183a1, .LName516
+    .quad 0x0000000000118447, .LName517
+    .quad 0x000000000011844f, .LName518
+    .quad 0x000000000011846c, .LName519
+    .quad 0x000000000011846f, .LName520
+    .quad 0x000000000011847a, .LName521
+    .quad 0x000000000011860b, .LName522
+    .quad 0x0000000000118ba4, .LName523
+    .quad 0x0000000000118c63, .LName524
+    .quad 0x0000000000118d2e, .LName525
+    .quad 0x0000000000118d6d, .LName526
+    .quad 0x0000000000118d9f, .LName527
+    .quad 0x0000000000118dd0, .LName528
+    .quad 0x0000000000118de1, .LName529
+    .quad 0x0000000000118e0a, .LName530
+    .quad 0x0000000000118fa8, .LName531
+    .quad 0x0000000000119143, .LName532
+    .quad 0x00000000001191fc, .LName533
+    .quad 0x000000000011931e, .LName534
+    .quad 0x0000000000119323, .LName535
+    .quad 0x0000000000119338, .LName536
+    .quad 0x0000000000119381, .LName537
+    .quad 0x0000000000119386, .LName538
+    .quad 0x00000000001193b9, .LName539
+    .quad 0x00000000001193be, .LName540
+    .quad 0x00000000001193ce, .LName541
+    .quad 0x0000000000119421, .LName542
+    .quad 0x000000000011945b, .LName543
+    .quad 0x0000000000119460, .LName544
+    .quad 0x000000000011946a, .LName545
+    .quad 0x000000000011946f, .LName546
+    .quad 0x000000000011947f, .LName547
+    .quad 0x0000000000119498, .LName548
+    .quad 0x000000000011949d, .LName549
+    .quad 0x00000000001194bc, .LName550
+    .quad 0x00000000001194db, .LName551
+    .quad 0x00000000001194fa, .LName552
+    .quad 0x0000000000119518, .LName553
+    .quad 0x000000000011958b, .LName554
+    .quad 0x000000000011970d, .LName555
+    .quad 0x000000000011976c, .LName556
+    .quad 0x0000000000119aa2, .LName557
+    .quad 0x0000000000119c31, .LName558
+    .quad 0x000000000011a8ff, .LName559
+    .quad 0x000000000011aa04, .LName560
+    .quad 0x000000000011aa0b, .LName561
+    .quad 0x000000000011aa12, .LName562
+    .quad 0x000000000011aa6a, .LName563
+    .quad 0x000000000011ab79, .LName564
+    .quad 0x000000000011ab92, .LName565
+    .quad 0x000000000011abb0, .LName566
+    .quad 0x000000000011acc8, .LName567
+    .quad 0x000000000011acef, .LName568
+    .quad 0x000000000011acfb, .LName569
+    .quad 0x000000000011adb7, .LName570
+    .quad 0x000000000011adbf, .LName571
+    .quad 0x000000000011adf1, .LName572
+    .quad 0x000000000011ae23, .LName573
+    .quad 0x000000000011ae2b, .LName574
+    .quad 0x000000000011ae33, .LName575
+    .quad 0x000000000011aea9, .LName576
+    .quad 0x000000000011b098, .LName577
+    .quad 0x000000000011b161, .LName578
+    .quad 0x000000000011b170, .LName579
+    .quad 0x000000000011b212, .LName580
+    .quad 0x000000000011b253, .LName581
+    .quad 0x000000000011b2d8, .LName582
+    .quad 0x000000000011b59d, .LName583
+    .quad 0x000000000011b5b8, .LName584
+    .quad 0x000000000011b6bc, .LName585
+    .quad 0x000000000011b6d9, .LName586
+    .quad 0x000000000011b72d, .LName587
+    .quad 0x000000000011b739, .LName588
+    .quad 0x000000000011b742, .LName589
+    .quad 0x000000000011b747, .LName590
+    .quad 0x000000000011b775, .LName591
+    .quad 0x000000000011b790, .LName592
+.LName0: .asciz "_KernelStart"
+.LName1: .asciz "KeyBoard::ShiftedScanCodeTable"
+.LName2: .asciz "KeyBoard::ScanCodeTable"
+.LName3: .asciz "ACPI::Init"
+.LName4: .asciz "ACPI::FindTable"
+.LName5: .asciz "AHCI::Init"
+.LName6: .asciz "AHCI::GetABAR"
+.LName7: .asciz "HBAPort::GetPortType"
+.LName8: .asciz "BochsVBE::Write"
+.LName9: .asciz "BochsVBE::Read"
+.LName10: .asciz "BochsVBE::Init"
+.LName11: .asciz "BochsVBE::SetMode"
+.LName12: .asciz "BochsVBE::GetPage"
+.LName13: .asciz "BochsVBE::Flip"
+.LName14: .asciz "CPU::CPUID"
+.LName15: .asciz "CPU::Init"
+.LName16: .asciz "CPU::HasAVX2"
+.LName17: .asciz "CPU::HasPCID"
+.LName18: .asciz "CPU::HasINVPCID"
+.LName19: .asciz "CPU::SaveFPU"
+.LName20: .asciz "CPU::RestoreFPU"
+.LName21: .asciz "CPU::DisableInterrupts"
+.LName22: .asciz "CPU::RestoreInterrupts"
+.LName23: .asciz "CPU::ReadMSR"
+.LName24: .asciz "CPU::WriteMSR"
+.LName25: .asciz "__stack_chk_fail"
+.LName26: .asciz "KernelMain"
+.LName27: .asciz "Debug::Error"
+.LName28: .asciz "ELF::GetImage"
+.LName29: .asciz "ELF::PageStart"
+.LName30: .asciz "ELF::PageEnd"
+.LName31: .asciz "ELF::GetImage"
+.LName32: .asciz "ELF::FillPage"
+.LName33: .asciz "ELF::Load"
+.LName34: .asciz "ELF::Unload"
+.LName35: .asciz "ELF::Run"
+.LName36: .asciz "ELF::IsOverdue"
+.LName37: .asciz "ELF::HandlePageFault"
+.LName38: .asciz "ELF::GetRunning"
+.LName39: .asciz "ELF::GetImages"
+.LName40: .asciz "IO::OutByte"
+.LName41: .asciz "IO::InByte"
+.LName42: .asciz "IO::OutWord"
+.LName43: .asciz "IO::InWord"
+.LName44: .asciz "IO::Wait"
+.LName45: .asciz "IPC::AddWaiter"
+.LName46: .asciz "IPC::CreateChannel"
+.LName47: .asciz "IPC::OpenChannel"
+.LName48: .asciz "IPC::CloseChannel"
+.LName49: .asciz "IPC::GetChannelAmount"
+.LName50: .asciz "IPC::AddWaiter"
+.LName51: .asciz "IPC::Wait"
+.LName52: .asciz "IPC::Wake"
+.LName53: .asciz "IPC::RemoveWaiters"
+.LName54: .asciz "IPC::DeliverWakes"
+.LName55: .asciz "IPC::OpenChannel"
+.LName56: .asciz "KeyBoard::HandleScanCode"
+.LName57: .asciz "KeyBoard::GetKeyPress"
+.LName58: .asciz "KeyBoard::GetKeyHeld"
+.LName59: .asciz "KeyBoard::IsPressed"
+.LName60: .asciz "KeyBoard::IsHeld"
+.LName61: .asciz "Mouse::MouseWait"
+.LName62: .asciz "Mouse::MouseWaitInput"
+.LName63: .asciz "Mouse::MouseWrite"
+.LName64: .asciz "Mouse::MouseRead"
+.LName65: .asciz "Mouse::InitPS2"
+.LName66: .asciz "Mouse::HandleMousePacket"
+.LName67: .asciz "InteruptHandlers::AbortUser"
+.LName68: .asciz "InteruptHandlers::DivideByZero"
+.LName69: .asciz "InteruptHandlers::NoneMaskableInterrupt"
+.LName70: .asciz "InteruptHandlers::Breakpoint"
+.LName71: .asciz "InteruptHandlers::Overflow"
+.LName72: .asciz "InteruptHandlers::BoundRange"
+.LName73: .asciz "InteruptHandlers::InvalidOP"
+.LName74: .asciz "InteruptHandlers::DeviceNotDetected"
+.LName75: .asciz "InteruptHandlers::DoubleFault"
+.LName76: .asciz "InteruptHandlers::InvalidTSS"
+.LName77: .asciz "InteruptHandlers::SegmentNotPresent"
+.LName78: .asciz "InteruptHandlers::StackSegmentFault"
+.LName79: .asciz "InteruptHandlers::GeneralProtectionFault"
+.LName80: .asciz "InteruptHandlers::PageFault"
+.LName81: .asciz "InteruptHandlers::FloatingPoint"
+.LName82: .asciz "InteruptHandlers::PIT"
+.LName83: .asciz "InteruptHandlers::Keyboard"
+.LName84: .asciz "InteruptHandlers::Mouse"
+.LName85: .asciz "InteruptHandlers::Serial"
+.LName86: .asciz "IDT::IDTEntry::SetOffset"
+.LName87: .asciz "IDT::IDTEntry::GetOffset"
+.LName88: .asciz "IDT::IDTR::SetHandler"
+.LName89: .asciz "IDT::EnableInterrupts"
+.LName90: .asciz "IDT::DisableInterrupts"
+.LName91: .asciz "IDT::SetupInterrupts"
+.LName92: .asciz "Log::Append"
+.LName93: .asciz "Log::Write"
+.LName94: .asciz "Log::ReadRecord"
+.LName95: .asciz "Log::WriteNumber"
+.LName96: .asciz "Log::FormatRecord"
+.LName97: .asciz "Log::Write"
+.LName98: .asciz "Log::Debug"
+.LName99: .asciz "Log::Info"
+.LName100: .asciz "Log::Warning"
+.LName101: .asciz "Log::Error"
+.LName102: .asciz "Log::NextSerialByte"
+.LName103: .asciz "Log::Flush"
+.LName104: .asciz "Log::GetDump"
+.LName105: .asciz "Log::GetDroppedAmount"
+.LName106: .asciz "Log::LevelToString"
+.LName107: .asciz "InitGDT"
+.LName108: .asciz "Heap::TraceOperation"
+.LName109: .asciz "Heap::Segment::GetStart"
+.LName110: .asciz "Heap::Segment::GetEnd"
+.LName111: .asciz "Heap::Segment::Split"
+.LName112: .asciz "Heap::GetFirstSegment"
+.LName113: .asciz "Heap::GetUsedSize"
+.LName114: .asciz "Heap::GetFreeSize"
+.LName115: .asciz "Heap::GetSegmentAmount"
+.LName116: .asciz "Heap::Free"
+.LName117: .asciz "Heap::Reserve"
+.LName118: .asciz "Heap::Init"
+.LName119: .asciz "Heap::FindSegment"
+.LName120: .asciz "Heap::Allocate"
+.LName121: .asciz "AddressSpace::Init"
+.LName122: .asciz "AddressSpace::AllocatePCID"
+.LName123: .asciz "AddressSpace::IsUser"
+.LName124: .asciz "AddressSpace::IsUser"
+.LName125: .asciz "AddressSpace::Create"
+.LName126: .asciz "AddressSpace::Destroy"
+.LName127: .asciz "AddressSpace::Map"
+.LName128: .asciz "AddressSpace::Allocate"
+.LName129: .asciz "AddressSpace::Switch"
+.LName130: .asciz "AddressSpace::GetCurrent"
+.LName131: .asciz "PageAllocator::GetPageStatus"
+.LName132: .asciz "PageAllocator::SetPageStatus"
+.LName133: .asciz "PageAllocator::GetFreePages"
+.LName134: .asciz "PageAllocator::GetLockedPages"
+.LName135: .asciz "PageAllocator::GetTotalPages"
+.LName136: .asciz "PageAllocator::RequestPage"
+.LName137: .asciz "PageAllocator::LockPage"
+.LName138: .asciz "PageAllocator::FreePage"
+.LName139: .asciz "PageAllocator::LockPages"
+.LName140: .asciz "PageAllocator::Init"
+.LName141: .asciz "PageAllocator::RequestPages"
+.LName142: .asciz "PageAllocator::FreePages"
+.LName143: .asciz "PageIndexer::PageIndexer"
+.LName144: .asciz "PageIndexer::PageIndexer"
+.LName145: .asciz "PageTableManager::MapAddress"
+.LName146: .asciz "PageTableManager::Init"
+.LName147: .asciz "PageTableManager::MapAddress"
+.LName148: .asciz "PageTableManager::MapAddress"
+.LName149: .asciz "PageTableManager::IsEmpty"
+.LName150: .asciz "PageTableManager::UnmapAddress"
+.LName151: .asciz "DeviceHeader::GetVendorString"
+.LName152: .asciz "DeviceHeader::GetTypeString"
+.LName153: .asciz "PCI::Init"
+.LName154: .asciz "PCI::ResetEnumeration"
+.LName155: .asciz "PCI::Enumerate"
+.LName156: .asciz "PIT::Sleep"
+.LName157: .asciz "PIT::GetFrequency"
+.LName158: .asciz "PIT::SetFrequency"
+.LName159: .asciz "PIT::SetDivisor"
+.LName160: .asciz "PIT::Tick"
+.LName161: .asciz "Compositor::GetFramePeriod"
+.LName162: .asciz "Compositor::Update"
+.LName163: .asciz "Compositor::Update"
+.LName164: .asciz "Compositor::FrameDue"
+.LName165: .asciz "Compositor::EndFrame"
+.LName166: .asciz "Compositor::GetFrameStats"
+.LName167: .asciz "Compositor::ResetFrameStats"
+.LName168: .asciz "Process::PushRequest"
+.LName169: .asciz "Process::GetID"
+.LName170: .asciz "Process::GetPos"
+.LName171: .asciz "Process::GetSize"
+.LName172: .asciz "Process::SetPos"
+.LName173: .asciz "Process::GetType"
+.LName174: .asciz "Process::GetTitle"
+.LName175: .asciz "Process::PopRequest"
+.LName176: .asciz "Process::PushRequest"
+.LName177: .asciz "Process::GetDroppedRequests"
+.LName178: .asciz "Process::GetCoalescedRequests"
+.LName179: .asciz "Process::GetProcedure"
+.LName180: .asciz "Process::GetCloseButtonPos"
+.LName181: .asciz "Process::GetDepth"
+.LName182: .asciz "Process::Contains"
+.LName183: .asciz "Process::Contains"
+.LName184: .asciz "Process::Clear"
+.LName185: .asciz "Process::Kill"
+.LName186: .asciz "Process::Draw"
+.LName187: .asciz "Process::Render"
+.LName188: .asciz "Process::IsOpaque"
+.LName189: .asciz "Process::SendMessage"
+.LName190: .asciz "Process::GetSurface"
+.LName191: .asciz "Process::SetupRing"
+.LName192: .asciz "Process::GetRing"
+.LName193: .asciz "Process::CreateSurface"
+.LName194: .asciz "Process::Process"
+.LName195: .asciz "Process::Process"
+.LName196: .asciz "ProcessHandler::StartProcess"
+.LName197: .asciz "ProcessHandler::SetFocusedProcess"
+.LName198: .asciz "ProcessHandler::RequestFocus"
+.LName199: .asciz "ProcessHandler::KeyBoardInterupt"
+.LName200: .asciz "ProcessHandler::MouseInterupt"
+.LName201: .asciz "ProcessHandler::PITInterupt"
+.LName202: .asciz "ProcessHandler::KillAllProcesses"
+.LName203: .asciz "ProcessHandler::GetProcess"
+.LName204: .asciz "ProcessHandler::DestroyProcess"
+.LName205: .asciz "ProcessHandler::KillProcess"
+.LName206: .asciz "ProcessHandler::StartProcess"
+.LName207: .asciz "ProcessHandler::PollRings"
+.LName208: .asciz "ProcessHandler::Loop"
+.LName209: .asciz "_GLOBAL__sub_I__ZN14ProcessHandler19LastMessagedProcessE"
+.LName210: .asciz "ProcessTable::GetArea"
+.LName211: .asciz "ProcessTable::Unlink"
+.LName212: .asciz "ProcessTable::LinkTop"
+.LName213: .asciz "ProcessTable::UnlinkFocus"
+.LName214: .asciz "ProcessTable::Insert"
+.LName215: .asciz "ProcessTable::Remove"
+.LName216: .asciz "ProcessTable::Get"
+.LName217: .asciz "ProcessTable::GetAmount"
+.LName218: .asciz "ProcessTable::GetBottom"
+.LName219: .asciz "ProcessTable::GetTop"
+.LName220: .asciz "ProcessTable::GetAbove"
+.LName221: .asciz "ProcessTable::GetBelow"
+.LName222: .asciz "ProcessTable::Raise"
+.LName223: .asciz "ProcessTable::Lower"
+.LName224: .asciz "ProcessTable::Focus"
+.LName225: .asciz "ProcessTable::GetLastFocused"
+.LName226: .asciz "ProcessTable::InvalidateHitGrid"
+.LName227: .asciz "ProcessTable::UpdateHitGrid"
+.LName228: .asciz "ProcessTable::HitTest"
+.LName229: .asciz "Surface::Create"
+.LName230: .asciz "Surface::Acquire"
+.LName231: .asciz "Surface::Release"
+.LName232: .asciz "Surface::Get"
+.LName233: .asciz "Surface::GetAmount"
+.LName234: .asciz "Bench::Run"
+.LName235: .asciz "Bench::Sort"
+.LName236: .asciz "Bench::Run"
+.LName237: .asciz "Bench::Run"
+.LName238: .asciz "Bench::Run"
+.LName239: .asciz "Bench::WriterProcedure"
+.LName240: .asciz "Bench::ReaderProcedure"
+.LName241: .asciz "Bench::Run"
+.LName242: .asciz "Bench::Run"
+.LName243: .asciz "Bench::InitProcess"
+.LName244: .asciz "Bench::Sort"
+.LName245: .asciz "Bench::Run"
+.LName246: .asciz "BootTrace::Init"
+.LName247: .asciz "BootTrace::Mark"
+.LName248: .asciz "BootTrace::GetReport"
+.LName249: .asciz "Profiler::GetCPUIndex"
+.LName250: .asciz "Profiler::Start"
+.LName251: .asciz "Profiler::Stop"
+.LName252: .asciz "Profiler::IsRunning"
+.LName253: .asciz "Profiler::Sample"
+.LName254: .asciz "Profiler::GetReport"
+.LName255: .asciz "Symbols::FindIndex"
+.LName256: .asciz "Symbols::Lookup"
+.LName257: .asciz "Calculator::GetButtonPosition"
+.LName258: .asciz "Calculator::Procedure"
+.LName259: .asciz "STL::WidgetTree::~WidgetTree"
+.LName260: .asciz "STL::WidgetTree::~WidgetTree"
+.LName261: .asciz "_GLOBAL__sub_I__ZN10Calculator7WidgetsE"
+.LName262: .asciz "Desktop::OpenAnimation"
+.LName263: .asciz "Desktop::Procedure"
+.LName264: .asciz "_GLOBAL__sub_I__ZN7Desktop16CurrentAnimationE"
+.LName265: .asciz "__tcf_0"
+.LName266: .asciz "StartMenu::Procedure"
+.LName267: .asciz "_GLOBAL__sub_I__ZN9StartMenu18StartableProcessesE"
+.LName268: .asciz "SystemMenu::OpenAnimation"
+.LName269: .asciz "SystemMenu::Procedure"
+.LName270: .asciz "STL::Button::~Button"
+.LName271: .asciz "STL::Button::~Button"
+.LName272: .asciz "_GLOBAL__sub_I__ZN10SystemMenu9TTYButtonE"
+.LName273: .asciz "Terminal::Write"
+.LName274: .asciz "Terminal::Procedure"
+.LName275: .asciz "_GLOBAL__sub_I__ZN8Terminal8PrevTickE"
+.LName276: .asciz "Topbar::OpenAnimation"
+.LName277: .asciz "Topbar::Procedure"
+.LName278: .asciz "STL::Label::~Label"
+.LName279: .asciz "STL::Label::~Label"
+.LName280: .asciz "_GLOBAL__sub_I__ZN6Topbar13TimeDateLabelE"
+.LName281: .asciz "tty::Write"
+.LName282: .asciz "tty::Procedure"
+.LName283: .asciz "_GLOBAL__sub_I__ZN3tty8PrevTickE"
+.LName284: .asciz "RAMFS::ParseOctal"
+.LName285: .asciz "RAMFS::Next"
+.LName286: .asciz "RAMFS::Init"
+.LName287: .asciz "RAMFS::Find"
+.LName288: .asciz "RAMFS::ResetEnumeration"
+.LName289: .asciz "RAMFS::Enumerate"
+.LName290: .asciz "RAMFS::GetFileAmount"
+.LName291: .asciz "RAMFS::GetSize"
+.LName292: .asciz "RTC::GetSecond"
+.LName293: .asciz "RTC::GetMinute"
+.LName294: .asciz "RTC::GetHour"
+.LName295: .asciz "RTC::GetDay"
+.LName296: .asciz "RTC::GetMonth"
+.LName297: .asciz "RTC::GetYear"
+.LName298: .asciz "RTC::Wait"
+.LName299: .asciz "RTC::GetRegister"
+.LName300: .asciz "RTC::Update"
+.LName301: .asciz "Renderer::HideCursor"
+.LName302: .asciz "Renderer::Init"
+.LName303: .asciz "Renderer::UniteArea"
+.LName304: .asciz "Renderer::AddDamage"
+.LName305: .asciz "Renderer::LoadFonts"
+.LName306: .asciz "Renderer::PutChar"
+.LName307: .asciz "Renderer::Print"
+.LName308: .asciz "Renderer::Print"
+.LName309: .asciz "Renderer::CursorRowWidth"
+.LName310: .asciz "Renderer::UniteCursorArea"
+.LName311: .asciz "Renderer::HideCursor"
+.LName312: .asciz "Renderer::ShowCursor"
+.LName313: .asciz "Renderer::RedrawMouse"
+.LName314: .asciz "Renderer::CopyArea"
+.LName315: .asciz "Renderer::SwapDamage"
+.LName316: .asciz "Renderer::SetDisplay"
+.LName317: .asciz "Renderer::SwapBuffers"
+.LName318: .asciz "Renderer::GetScreenSize"
+.LName319: .asciz "STL::Console::Release"
+.LName320: .asciz "STL::Console::Resize"
+.LName321: .asciz "STL::Console::Clear"
+.LName322: .asciz "STL::Console::Init"
+.LName323: .asciz "STL::Console::SetCursorVisible"
+.LName324: .asciz "STL::Console::Invalidate"
+.LName325: .asciz "STL::Console::Draw"
+.LName326: .asciz "STL::Console::GetLine"
+.LName327: .asciz "STL::Console::GetTop"
+.LName328: .asciz "STL::Console::ClearLine"
+.LName329: .asciz "STL::Console::NewLine"
+.LName330: .asciz "STL::Console::Put"
+.LName331: .asciz "STL::Console::Execute"
+.LName332: .asciz "STL::Console::Write"
+.LName333: .asciz "STL::Console::Write"
+.LName334: .asciz "_GLOBAL__sub_I__ZN3STL7Console4InitEjjNS_4ARGBES1_"
+.LName335: .asciz "STL::Button::Draw"
+.LName336: .asciz "STL::Button::IsToggled"
+.LName337: .asciz "STL::Button::IsPressed"
+.LName338: .asciz "STL::Button::IsDown"
+.LName339: .asciz "STL::Button::Button"
+.LName340: .asciz "STL::Button::Button"
+.LName341: .asciz "STL::Label::Draw"
+.LName342: .asciz "STL::Label::Label"
+.LName343: .asciz "STL::Label::Label"
+.LName344: .asciz "STL::Overlaps"
+.LName345: .asciz "STL::WidgetTree::Add"
+.LName346: .asciz "STL::UpdateBounds"
+.LName347: .asciz "STL::WidgetTree::Init"
+.LName348: .asciz "STL::WidgetTree::AddContainer"
+.LName349: .asciz "STL::WidgetTree::AddButton"
+.LName350: .asciz "STL::WidgetTree::AddLabel"
+.LName351: .asciz "STL::WidgetTree::AddTextField"
+.LName352: .asciz "STL::WidgetTree::Get"
+.LName353: .asciz "STL::WidgetTree::SetText"
+.LName354: .asciz "STL::WidgetTree::Invalidate"
+.LName355: .asciz "STL::WidgetTree::InvalidateAll"
+.LName356: .asciz "STL::WidgetTree::IsDirty"
+.LName357: .asciz "STL::WidgetTree::DrawWidget"
+.LName358: .asciz "STL::WidgetTree::Draw"
+.LName359: .asciz "STL::WidgetTree::HitTest"
+.LName360: .asciz "STL::WidgetTree::HandleMouse"
+.LName361: .asciz "STL::WidgetTree::HandleKey"
+.LName362: .asciz "STL::WidgetTree::Release"
+.LName363: .asciz "STL::Saturate"
+.LName364: .asciz "STL::ARGB::ToInt"
+.LName365: .asciz "STL::ARGB::operator=="
+.LName366: .asciz "STL::ARGB::operator+="
+.LName367: .asciz "STL::ARGB::operator-="
+.LName368: .asciz "STL::ARGB::operator*="
+.LName369: .asciz "STL::ARGB::operator/="
+.LName370: .asciz "STL::ARGB::operator+"
+.LName371: .asciz "STL::ARGB::operator-"
+.LName372: .asciz "STL::ARGB::operator*"
+.LName373: .asciz "STL::ARGB::operator/"
+.LName374: .asciz "STL::ARGB::operator+="
+.LName375: .asciz "STL::ARGB::operator-="
+.LName376: .asciz "STL::ARGB::operator*="
+.LName377: .asciz "STL::ARGB::operator/="
+.LName378: .asciz "STL::ARGB::operator+"
+.LName379: .asciz "STL::ARGB::operator-"
+.LName380: .asciz "STL::ARGB::operator*"
+.LName381: .asciz "STL::ARGB::operator/"
+.LName382: .asciz "STL::ARGB::ARGB"
+.LName383: .asciz "STL::ARGB::ARGB"
+.LName384: .asciz "STL::ARGB::ARGB"
+.LName385: .asciz "STL::ARGB::ARGB"
+.LName386: .asciz "STL::Divide255"
+.LName387: .asciz "STL::BlendScalar"
+.LName388: .asciz "STL::BlendSSE2"
+.LName389: .asciz "STL::BlendAVX2"
+.LName390: .asciz "STL::BlendSpan"
+.LName391: .asciz "STL::FillSSE2"
+.LName392: .asciz "STL::FillAVX2"
+.LName393: .asciz "STL::FillSpan"
+.LName394: .asciz "STL::Framebuffer::Clear"
+.LName395: .asciz "STL::Framebuffer::ScrollUp"
+.LName396: .asciz "STL::Framebuffer::GetPixel"
+.LName397: .asciz "STL::Framebuffer::PutPixel"
+.LName398: .asciz "STL::ClipRect"
+.LName399: .asciz "STL::FillRow"
+.LName400: .asciz "STL::DrawBevel"
+.LName401: .asciz "STL::Framebuffer::DrawRaisedRectEdge"
+.LName402: .asciz "STL::Framebuffer::DrawSunkenRectEdge"
+.LName403: .asciz "STL::Framebuffer::DrawRect"
+.LName404: .asciz "STL::Framebuffer::DrawRaisedRect"
+.LName405: .asciz "STL::Framebuffer::DrawSunkenRect"
+.LName406: .asciz "STL::Framebuffer::Fill"
+.LName407: .asciz "STL::Framebuffer::PutChar"
+.LName408: .asciz "STL::Framebuffer::Print"
+.LName409: .asciz "STL::ExpandGlyph"
+.LName410: .asciz "STL::GetGlyph"
+.LName411: .asciz "STL::ClearGlyphAtlas"
+.LName412: .asciz "STL::SetFonts"
+.LName413: .asciz "STL::GetFont"
+.LName414: .asciz "STL::Channel::GetSize"
+.LName415: .asciz "STL::Channel::Init"
+.LName416: .asciz "STL::Channel::Write"
+.LName417: .asciz "STL::Channel::Read"
+.LName418: .asciz "STL::Channel::GetAmount"
+.LName419: .asciz "STL::Channel::WaitReadable"
+.LName420: .asciz "STL::Channel::WaitWritable"
+.LName421: .asciz "STL::GetDigit"
+.LName422: .asciz "STL::GetDigitAmount"
+.LName423: .asciz "STL::IntPow"
+.LName424: .asciz "STL::Sqrt"
+.LName425: .asciz "STL::Contains"
+.LName426: .asciz "STL::Contains"
+.LName427: .asciz "STL::Point::operator+="
+.LName428: .asciz "STL::Point::operator-="
+.LName429: .asciz "STL::Point::operator*="
+.LName430: .asciz "STL::Point::operator/="
+.LName431: .asciz "STL::Point::operator+"
+.LName432: .asciz "STL::Point::operator-"
+.LName433: .asciz "STL::Point::operator*"
+.LName434: .asciz "STL::Point::operator/"
+.LName435: .asciz "STL::Point::operator+="
+.LName436: .asciz "STL::Point::operator-="
+.LName437: .asciz "STL::Point::operator*="
+.LName438: .asciz "STL::Point::operator/="
+.LName439: .asciz "STL::Point::operator+"
+.LName440: .asciz "STL::Point::operator-"
+.LName441: .asciz "STL::Point::operator*"
+.LName442: .asciz "STL::Point::operator/"
+.LName443: .asciz "STL::Point::Point"
+.LName444: .asciz "STL::Point::Point"
+.LName445: .asciz "STL::SetMemory"
+.LName446: .asciz "STL::CopyMemory"
+.LName447: .asciz "STL::String::Reserve"
+.LName448: .asciz "STL::String::Pop"
+.LName449: .asciz "STL::String::cstr"
+.LName450: .asciz "STL::String::Length"
+.LName451: .asciz "STL::String::Erase"
+.LName452: .asciz "STL::String::Reserve"
+.LName453: .asciz "STL::String::operator+="
+.LName454: .asciz "STL::String::operator="
+.LName455: .asciz "STL::String::operator="
+.LName456: .asciz "STL::String::operator="
+.LName457: .asciz "STL::String::operator+="
+.LName458: .asciz "STL::String::operator+="
+.LName459: .asciz "STL::String::operator[]"
+.LName460: .asciz "STL::String::operator[]"
+.LName461: .asciz "STL::String::String"
+.LName462: .asciz "STL::String::String"
+.LName463: .asciz "STL::String::~String"
+.LName464: .asciz "STL::String::~String"
+.LName465: .asciz "STL::ToString"
+.LName466: .asciz "STL::ToInt"
+.LName467: .asciz "STL::NextWord"
+.LName468: .asciz "STL::LineAmount"
+.LName469: .asciz "STL::HashWord"
+.LName470: .asciz "STL::Length"
+.LName471: .asciz "STL::Compare"
+.LName472: .asciz "STL::StartsWith"
+.LName473: .asciz "STL::CopyString"
+.LName474: .asciz "STL::SyscallRing::GetSize"
+.LName475: .asciz "STL::SyscallRing::Init"
+.LName476: .asciz "STL::SyscallRing::GetSubmissions"
+.LName477: .asciz "STL::SyscallRing::GetCompletions"
+.LName478: .asciz "STL::SyscallRing::Submit"
+.LName479: .asciz "STL::SyscallRing::Complete"
+.LName480: .asciz "STL::SyscallRing::Enter"
+.LName481: .asciz "STL::SetupRing"
+.LName482: .asciz "operator new"
+.LName483: .asciz "operator delete"
+.LName484: .asciz "STL::System"
+.LName485: .asciz "STL::Malloc"
+.LName486: .asciz "STL::Free"
+.LName487: .asciz "STL::Start"
+.LName488: .asciz "STL::Kill"
+.LName489: .asciz "STL::GetTime"
+.LName490: .asciz "STL::GetStat"
+.LName491: .asciz "STL::Wait"
+.LName492: .asciz "STL::Wake"
+.LName493: .asciz "STL::CreateChannel"
+.LName494: .asciz "STL::OpenChannel"
+.LName495: .asciz "STL::CloseChannel"
+.LName496: .asciz "STL::SystemPage::ReadBegin"
+.LName497: .asciz "STL::SystemPage::ReadRetry"
+.LName498: .asciz "STL::SystemPage::BeginWrite"
+.LName499: .asciz "STL::SystemPage::EndWrite"
+.LName500: .asciz "STL::SystemPage::GetNanoseconds"
+.LName501: .asciz "STL::SystemPage::GetTicks"
+.LName502: .asciz "STL::SystemPage::GetTime"
+.LName503: .asciz "STL::SystemPage::GetStat"
+.LName504: .asciz "STL::GetSystemPage"
+.LName505: .asciz "Serial::Init"
+.LName506: .asciz "Serial::EnableInterrupts"
+.LName507: .asciz "Serial::Kick"
+.LName508: .asciz "Serial::HandleInterrupt"
+.LName509: .asciz "Serial::Write"
+.LName510: .asciz "Serial::Write"
+.LName511: .asciz "SharedPage::Tick"
+.LName512: .asciz "SharedPage::Init"
+.LName513: .asciz "SharedPage::UpdateCounters"
+.LName514: .asciz "SharedPage::Get"
+.LName515: .asciz "SharedPage::Map"
+.LName516: .asciz "Syscall::Init"
+.LName517: .asciz "Syscall::GetCPU"
+.LName518: .asciz "SyscallDispatch"
+.LName519: .asciz "System::SyscallExit"
+.LName520: .asciz "System::UserSyscallSystemPage"
+.LName521: .asciz "System::CommandSet"
+.LName522: .asciz "System::CommandHelp"
+.LName523: .asciz "System::CommandTime"
+.LName524: .asciz "System::CommandDate"
+.LName525: .asciz "System::SyscallTime"
+.LName526: .asciz "System::CommandKill"
+.LName527: .asciz "System::CommandSuicide"
+.LName528: .asciz "System::SyscallKill"
+.LName529: .asciz "System::CommandClear"
+.LName530: .asciz "System::CommandShutdown"
+.LName531: .asciz "System::CommandRestart"
+.LName532: .asciz "System::CommandStart"
+.LName533: .asciz "System::CommandExec"
+.LName534: .asciz "System::CommandDmesg"
+.LName535: .asciz "System::CommandBench"
+.LName536: .asciz "System::CommandExit"
+.LName537: .asciz "System::CommandBoottime"
+.LName538: .asciz "System::CommandFrames"
+.LName539: .asciz "System::SyscallMalloc"
+.LName540: .asciz "System::SyscallFree"
+.LName541: .asciz "System::SyscallStat"
+.LName542: .asciz "System::SyscallWait"
+.LName543: .asciz "System::SyscallWake"
+.LName544: .asciz "System::SyscallChannelCreate"
+.LName545: .asciz "System::SyscallChannelOpen"
+.LName546: .asciz "System::SyscallChannelClose"
+.LName547: .asciz "System::SyscallRingSetup"
+.LName548: .asciz "System::SyscallSystemPage"
+.LName549: .asciz "System::UserSyscallTime"
+.LName550: .asciz "System::UserSyscallStat"
+.LName551: .asciz "System::UserSyscallWake"
+.LName552: .asciz "System::SyscallStart"
+.LName553: .asciz "System::CommandPerf"
+.LName554: .asciz "System::CommandHeapvis"
+.LName555: .asciz "System::UserSyscallWait"
+.LName556: .asciz "System::CommandSysfetch"
+.LName557: .asciz "System::CommandList"
+.LName558: .asciz "System::CommandList"
+.LName559: .asciz "System::Run"
+.LName560: .asciz "System::SyscallSystem"
+.LName561: .asciz "System::System"
+.LName562: .asciz "System::RunDeferred"
+.LName563: .asciz "System::RunScript"
+.LName564: .asciz "System::Call"
+.LName565: .asciz "System::UserCall"
+.LName566: .asciz "System::Drain"
+.LName567: .asciz "System::SyscallRingEnter"
+.LName568: .asciz "TSC::Read"
+.LName569: .asciz "TSC::Calibrate"
+.LName570: .asciz "TSC::GetFrequency"
+.LName571: .asciz "TSC::ToMicroseconds"
+.LName572: .asciz "TSC::ToNanoseconds"
+.LName573: .asciz "UEFI::Init"
+.LName574: .asciz "UEFI::GetRT"
+.LName575: .asciz "Virtio::MapBAR"
+.LName576: .asciz "Virtio::Init"
+.LName577: .asciz "Virtio::SetupQueue"
+.LName578: .asciz "Virtio::Start"
+.LName579: .asciz "Virtio::Send"
+.LName580: .asciz "VirtioGPU::Send"
+.LName581: .asciz "VirtioGPU::Init"
+.LName582: .asciz "VirtioGPU::SetMode"
+.LName583: .asciz "VirtioGPU::GetFramebuffer"
+.LName584: .asciz "VirtioGPU::Flush"
+.LName585: .asciz "LoadGDT"
+.LName586: .asciz "SyscallEntry"
+.LName587: .asciz "SyscallRestore"
+.LName588: .asciz "UserAbort"
+.LName589: .asciz "UserCallAbort"
+.LName590: .asciz "EnterUser"
+.LName591: .asciz "SyscallBenchStart"
+.LName592: .asciz "SyscallBenchEnd"
+.section .note.GNU-stack, "", @progbits
@@ -2,9 +2,6 @@
 #include <efilib.h>
 #include <elf.h>
 
-#define PSF_MAGIC0 0x36
-#define PSF_MAGIC1 0x04
-
 typedef unsigned long long size_t;
 
 typedef struct
@@ -18,16 +15,21 @@ typedef struct
 
 typedef struct
 {
-	unsigned char magic[2];
-	unsigned char mode;
-	unsigned char charsize;
-} PSF_HEADER;
+	void* Base;
+	uint64_t Size;
+} INITRD;
+
+typedef struct
+{
+	const char* Name;
+	uint64_t TSC;
+} BOOT_STAGE;
 
 typedef struct
 {
-	PSF_HEADER* PSF_Header;
-	void* glyphBuffer;
-} PSF_FONT;
+	uint64_t Amount;
+	BOOT_STAGE Stages[16];
+} BOOT_TRACE;
 
 typedef struct
 {
@@ -40,16 +42,33 @@ typedef struct
 typedef struct
 {
 	Framebuffer* framebuffer;
-	PSF_FONT** PSFFonts;	
-	uint8_t FontAmount;
+	INITRD* Initrd;
 	EFI_MEMORY_MAP* MemoryMap;
 	void* RSDP;
 	EFI_RUNTIME_SERVICES *RT;
+	BOOT_TRACE* Trace;
 } BootInfo;
 
 EFI_HANDLE ImageHandle;
 EFI_SYSTEM_TABLE* SystemTable;
 
+BOOT_TRACE BootTrace;
+
+void MarkStage(const char* Name)
+{
+	if (BootTrace.Amount >= sizeof(BootTrace.Stages) / sizeof(BootTrace.Stages[0]))
+	{
+		return;
+	}
+
+	unsigned int Low, High;
+	__asm__ __volatile__("RDTSC" : "=a"(Low), "=d"(High));
+
+	BootTrace.Stages[BootTrace.Amount].Name = Name;
+	BootTrace.Stages[BootTrace.Amount].TSC = ((uint64_t)High << 32) | Low;
+	BootTrace.Amount++;
+}
+
 int strcmp(const char* Str1, const char* Str2)
 {
 	int i = 0;
@@ -137,13 +156,13 @@ Framebuffer GetFramebuffer()
 	return NewBuffer;
 }
 
-PSF_FONT LoadPSFFont(EFI_FILE* Directory, CHAR16* Path)
+INITRD LoadInitrd(EFI_FILE* Directory, CHAR16* Path)
 {
-	EFI_FILE* Font = LoadFile(Directory, Path);
+	EFI_FILE* File = LoadFile(Directory, Path);
 
-	if (Font == NULL)
+	if (File == NULL)
 	{
-		Print(L"ERROR: Failed to load font!\n\r");
+		Print(L"ERROR: Failed to load initrd!\n\r");
 		
 		while (1)
 		{
@@ -151,45 +170,30 @@ PSF_FONT LoadPSFFont(EFI_FILE* Directory, CHAR16* Path)
 		}
 	}
 
-	PSF_HEADER* FontHeader;
-	SystemTable->BootServices->AllocatePool(EfiLoaderData, sizeof(PSF_HEADER), (void**)&FontHeader);
-	UINTN size = sizeof(PSF_HEADER);
-	Font->Read(Font, &size, FontHeader);
-
-	/*if (FontHeader->magic[0] != PSF_MAGIC0 || FontHeader->magic[1] != PSF_MAGIC1)
-	{
-		Print(L"ERROR: Invalid font loaded!\n\r");
-		
-		while (1)
-		{
-			__asm__("HLT");
-		}
-	}*/
-
-	UINTN GlyphBufferSize = FontHeader->charsize * 256;
-	if (FontHeader->mode == 1)
-	{
-		GlyphBufferSize = FontHeader->charsize * 512;
-	}
+	UINTN FileInfoSize = 0;
+	EFI_FILE_INFO* FileInfo;
+	File->GetInfo(File, &gEfiFileInfoGuid, &FileInfoSize, NULL);
+	SystemTable->BootServices->AllocatePool(EfiLoaderData, FileInfoSize, (void**)&FileInfo);
+	File->GetInfo(File, &gEfiFileInfoGuid, &FileInfoSize, FileInfo);
 
-	void* GlyphBuffer;
-	{
-		Font->SetPosition(Font, sizeof(PSF_HEADER));
-		SystemTable->BootServices->AllocatePool(EfiLoaderData, GlyphBufferSize, (void**)&GlyphBuffer);
-		Font->Read(Font, &GlyphBufferSize, GlyphBuffer);
-	}
+	INITRD NewInitrd;
+	NewInitrd.Size = FileInfo->FileSize;
 
-	PSF_FONT newFont;
+	//Load the whole archive into one contiguous allocation with a single read.
+	EFI_PHYSICAL_ADDRESS Address;
+	UINTN Pages = (NewInitrd.Size + 0x1000 - 1) / 0x1000;
+	SystemTable->BootServices->AllocatePages(AllocateAnyPages, EfiLoaderData, Pages, &Address);
 
-	newFont.PSF_Header = FontHeader;
-	newFont.glyphBuffer = (char*)GlyphBuffer;
+	UINTN Size = NewInitrd.Size;
+	File->Read(File, &Size, (void*)Address);
+	NewInitrd.Base = (void*)Address;
 
-	Print(L"FONT INFO\n\r");
-	Print(L"Char Size: %d\n\r", newFont.PSF_Header->charsize);
-	Print(L"Mode: 0x%x\n\r", newFont.PSF_Header->mode);
-	Print(L"FONT INFO END\n\r");
+	Print(L"INITRD INFO\n\r");
+	Print(L"Base: 0x%x\n\r", NewInitrd.Base);
+	Print(L"Size: 0x%x\n\r", NewInitrd.Size);
+	Print(L"INITRD INFO END\n\r");
 
-	return newFont;
+	return NewInitrd;
 }
 
 EFI_MEMORY_MAP GetMemoryMap()
@@ -263,7 +267,7 @@ Elf64_Ehdr LoadELFFile(EFI_FILE* Directory, CHAR16* Path)
 		{
 		case PT_LOAD:
 		{
-			int pages = (phdr->p_memsz * 0x1000 - 1) / 0x1000;
+			int pages = (phdr->p_memsz + 0x1000 - 1) / 0x1000;
 			Elf64_Addr segment = phdr->p_paddr;
 			SystemTable->BootServices->AllocatePages(AllocateAddress, EfiLoaderData, pages, &segment);
 
@@ -300,6 +304,9 @@ void* GetRSDP()
 
 EFI_STATUS efi_main(EFI_HANDLE In_ImageHandle, EFI_SYSTEM_TABLE* In_SystemTable)
 {
+	//Everything before the bootloader was started is spent in the firmware.
+	MarkStage("Firmware");
+
 	ImageHandle = In_ImageHandle;
 	SystemTable = In_SystemTable;
 
@@ -307,31 +314,33 @@ EFI_STATUS efi_main(EFI_HANDLE In_ImageHandle, EFI_SYSTEM_TABLE* In_SystemTable)
 	Print(L"Bootloader loaded!\n\r");
 
 	EFI_FILE* KernelDir = LoadFile(NULL, L"KERNEL");
-	EFI_FILE* FontsDir = LoadFile(NULL, L"FONTS");
 
 	Elf64_Ehdr KernelELF = LoadELFFile(KernelDir, L"Kernel.elf");
+	MarkStage("Load kernel");
 
-	PSF_FONT FontVGA = LoadPSFFont(FontsDir, L"zap-vga16.psf");
-	PSF_FONT FontLight = LoadPSFFont(FontsDir, L"zap-light16.psf");
-
-	PSF_FONT* Fonts[] = {&FontVGA, &FontLight};
+	INITRD Initrd = LoadInitrd(KernelDir, L"initrd.tar");
+	MarkStage("Load initrd");
 
 	Framebuffer newBuffer = GetFramebuffer();
-	EFI_MEMORY_MAP newMap = GetMemoryMap();
+	MarkStage("GOP setup");
+
 	void* RSDP = GetRSDP();
+	EFI_MEMORY_MAP newMap = GetMemoryMap();
+	MarkStage("Memory map");
 
 	void (*KernelMain)(BootInfo*) = ((__attribute__((sysv_abi)) void (*)(BootInfo*)) KernelELF.e_entry);
 
 	Print(L"Exiting boot services...\n\r");
 	SystemTable->BootServices->ExitBootServices(ImageHandle, newMap.Key);
-	
+	MarkStage("Exit boot services");
+
 	BootInfo bootInfo;
 	bootInfo.framebuffer = &newBuffer;
-	bootInfo.PSFFonts = Fonts;
-	bootInfo.FontAmount = sizeof(Fonts)/sizeof(Fonts[0]);	
+	bootInfo.Initrd = &Initrd;
 	bootInfo.MemoryMap = &newMap;
 	bootInfo.RSDP = RSDP;
 	bootInfo.RT = SystemTable->RuntimeServices;
+	bootInfo.Trace = &BootTrace;
 
 	Print(L"Entering Kernel...\n\r");
 	KernelMain(&bootInfo);
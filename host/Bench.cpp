@@ -0,0 +1,136 @@
+#include "Host.h"
+
+#include "STL/List/List.h"
+#include "STL/String/String.h"
+#include "STL/Memory/Memory.h"
+
+#include "Memory/Heap.h"
+#include "Memory/Paging/PageAllocator.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define HOST_BENCH_ITERATIONS 1000
+
+uint64_t Samples[HOST_BENCH_ITERATIONS];
+
+/// <summary>
+/// Times Body once per iteration, Setup runs before each iteration and is not timed.
+/// </summary>
+template<typename S, typename B>
+void Measure(const char* Filter, const char* Name, uint64_t Iterations, S Setup, B Body)
+{
+    if (strncmp(Name, Filter, strlen(Filter)) != 0)
+    {
+        return;
+    }
+
+    for (uint64_t i = 0; i < Iterations; i++)
+    {
+        Setup(i);
+        uint64_t Start = Host::Now();
+        Body(i);
+        Samples[i] = Host::Now() - Start;
+    }
+
+    Host::Report(Name, Samples, Iterations);
+}
+
+int main(int argc, char** argv)
+{
+    const char* Filter = argc > 1 ? argv[1] : "";
+
+    Host::Init();
+
+    auto Nothing = [](uint64_t) {};
+
+    printf("%-32s %15s %15s %15s\n", "BENCHMARK", "MIN", "MEDIAN", "P99");
+
+    //Containers.
+    Measure(Filter, "list push 1000", 256, Nothing, [](uint64_t) 
+    { 
+        STL::List<uint64_t> List;
+        for (uint64_t i = 0; i < 1000; i++)
+        {
+            List.Push(i);
+        }
+    });
+
+    Measure(Filter, "list erase front 100", 256, Nothing, [](uint64_t) 
+    { 
+        STL::List<uint64_t> List;
+        for (uint64_t i = 0; i < 100; i++)
+        {
+            List.Push(i);
+        }
+        while (List.Length() != 0)
+        {
+            List.Erase(0);
+        }
+    });
+
+    Measure(Filter, "string append 1000 chars", 256, Nothing, [](uint64_t) 
+    { 
+        STL::String String;
+        for (uint64_t i = 0; i < 1000; i++)
+        {
+            String += (char)('a' + i % 26);
+        }
+    });
+
+    Measure(Filter, "string append 100 words", 256, Nothing, [](uint64_t) 
+    { 
+        STL::String String;
+        for (uint64_t i = 0; i < 100; i++)
+        {
+            String += "word ";
+        }
+    });
+
+    //Memory.
+    {
+        static uint8_t Source[1048576];
+        static uint8_t Dest[1048576];
+
+        const uint64_t Sizes[] = {64, 4096, 65536, 1048576};
+        const char* CopyNames[] = {"copy 64", "copy 4K", "copy 64K", "copy 1M"};
+        const char* SetNames[] = {"set 64", "set 4K", "set 64K", "set 1M"};
+
+        for (uint64_t i = 0; i < sizeof(Sizes) / sizeof(Sizes[0]); i++)
+        {
+            Measure(Filter, CopyNames[i], HOST_BENCH_ITERATIONS, Nothing, [&](uint64_t) { STL::CopyMemory(Source, Dest, Sizes[i]); });
+            Measure(Filter, SetNames[i], HOST_BENCH_ITERATIONS, Nothing, [&](uint64_t) { STL::SetMemory(Dest, 0xAA, Sizes[i]); });
+        }
+    }
+
+    //Heap.
+    {
+        static void* Allocations[HOST_BENCH_ITERATIONS];
+
+        Measure(Filter, "heap alloc+free 64", HOST_BENCH_ITERATIONS, Nothing, [](uint64_t) { Heap::Free(Heap::Allocate(64)); });
+
+        Measure(Filter, "heap alloc+free 4K", HOST_BENCH_ITERATIONS, Nothing, [](uint64_t) { Heap::Free(Heap::Allocate(4096)); });
+
+        Measure(Filter, "heap alloc 64 x1000 live", HOST_BENCH_ITERATIONS, Nothing, [&](uint64_t i) { Allocations[i] = Heap::Allocate(64); });
+
+        Measure(Filter, "heap free 64 x1000 live", HOST_BENCH_ITERATIONS, Nothing, [&](uint64_t i) 
+        { 
+            Heap::Free(Allocations[HOST_BENCH_ITERATIONS - i - 1]); 
+        });
+    }
+
+    //Pages.
+    {
+        static void* Pages[HOST_BENCH_ITERATIONS];
+
+        Measure(Filter, "page request", HOST_BENCH_ITERATIONS, Nothing, [&](uint64_t i) { Pages[i] = PageAllocator::RequestPage(); });
+
+        Measure(Filter, "page free", HOST_BENCH_ITERATIONS, Nothing, [&](uint64_t i) { PageAllocator::FreePage(Pages[i]); });
+
+        Measure(Filter, "page free pages count", 16, Nothing, [](uint64_t) { PageAllocator::GetFreePages(); });
+    }
+
+    printf("Heap: %lu segments, %lu KB used, %lu KB free\n", Heap::GetSegmentAmount(), Heap::GetUsedSize() / 1024, Heap::GetFreeSize() / 1024);
+
+    return 0;
+}
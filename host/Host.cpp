@@ -0,0 +1,188 @@
+#include "Host.h"
+
+#include "STL/System/System.h"
+
+#include "System/System.h"
+#include "Memory/Heap.h"
+#include "Memory/Paging/PageAllocator.h"
+#include "Memory/Paging/PageTable.h"
+#include "TSC/TSC.h"
+#include "Serial/Serial.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+
+/// <summary>
+/// The kernel image is not inside the fake physical memory, both symbols share one address so PageAllocator locks nothing for it.
+/// </summary>
+asm(".data\n.global _KernelStart\n.global _KernelEnd\n_KernelStart:\n_KernelEnd:\n.quad 0\n.text");
+
+namespace Host
+{
+    int ArenaFile = -1;
+
+    void (*OnAllocate)(uint64_t Duration) = nullptr;
+    void (*OnFree)(uint64_t Duration) = nullptr;
+
+    void Init()
+    {
+        ArenaFile = memfd_create("physical", 0);
+        if (ArenaFile == -1 || ftruncate(ArenaFile, HOST_ARENA_SIZE) != 0)
+        {
+            perror("memfd");
+            exit(1);
+        }
+
+        void* Arena = mmap((void*)HOST_ARENA_BASE, HOST_ARENA_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED_NOREPLACE, ArenaFile, 0);
+        if (Arena != (void*)HOST_ARENA_BASE)
+        {
+            perror("mmap arena");
+            exit(1);
+        }
+
+        //Everything below the arena is reserved, like the low memory on a real machine.
+        static EFI_MEMORY_DESCRIPTOR Descriptors[2];
+        Descriptors[0].Type = (uint32_t)EFI_MEMORY_TYPE::EfiReservedMemoryType;
+        Descriptors[0].PhysicalStart = (void*)0;
+        Descriptors[0].NumberOfPages = HOST_ARENA_BASE / 4096;
+        Descriptors[1].Type = (uint32_t)EFI_MEMORY_TYPE::EfiConventionalMemory;
+        Descriptors[1].PhysicalStart = (void*)HOST_ARENA_BASE;
+        Descriptors[1].NumberOfPages = HOST_ARENA_SIZE / 4096;
+
+        EFI_MEMORY_MAP MemoryMap;
+        MemoryMap.Base = Descriptors;
+        MemoryMap.Size = sizeof(Descriptors);
+        MemoryMap.DescSize = sizeof(EFI_MEMORY_DESCRIPTOR);
+
+        STL::Framebuffer ScreenBuffer = {};
+
+        PageAllocator::Init(&MemoryMap, &ScreenBuffer);
+        PageTableManager::Init(&ScreenBuffer);
+        Heap::Init();
+    }
+
+    uint64_t Now()
+    {
+        timespec Time;
+        clock_gettime(CLOCK_MONOTONIC, &Time);
+        return Time.tv_sec * 1000000000ull + Time.tv_nsec;
+    }
+
+    void Report(const char* Name, uint64_t* Samples, uint64_t Amount)
+    {
+        qsort(Samples, Amount, sizeof(uint64_t), [](const void* A, const void* B) 
+        { 
+            uint64_t X = *(const uint64_t*)A;
+            uint64_t Y = *(const uint64_t*)B;
+            return (X > Y) - (X < Y);
+        });
+
+        printf("%-32s %12lu ns %12lu ns %12lu ns\n", Name, Samples[0], Samples[Amount / 2], Samples[(Amount * 99) / 100]);
+    }
+}
+
+namespace PageTableManager
+{
+    void Init(STL::Framebuffer* ScreenBuffer)
+    {
+
+    }
+
+    void MapAddress(void* VirtualAddress, void* PhysicalAddress, bool User)
+    {
+        //Like the page tables the offset within the page is ignored.
+        VirtualAddress = (void*)((uint64_t)VirtualAddress & ~0xFFFull);
+        PhysicalAddress = (void*)((uint64_t)PhysicalAddress & ~0xFFFull);
+
+        uint64_t Offset = (uint64_t)PhysicalAddress - HOST_ARENA_BASE;
+        if ((uint64_t)PhysicalAddress < HOST_ARENA_BASE || Offset >= HOST_ARENA_SIZE)
+        {
+            fprintf(stderr, "MapAddress: %p is outside the fake physical memory\n", PhysicalAddress);
+            abort();
+        }
+
+        if (mmap(VirtualAddress, 4096, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, Host::ArenaFile, Offset) != VirtualAddress)
+        {
+            perror("MapAddress");
+            abort();
+        }
+    }
+}
+
+namespace System
+{
+    STL::SYSRV Call(uint64_t Selector, uint64_t Argument)
+    {
+        switch (Selector)
+        {
+        case SYSCALL_MALLOC:
+        {
+            uint64_t Start = Host::Now();
+            void* Address = Heap::Allocate(Argument);
+            if (Host::OnAllocate != nullptr)
+            {
+                Host::OnAllocate(Host::Now() - Start);
+            }
+            return (STL::SYSRV)Address;
+        }
+        case SYSCALL_FREE:
+        {
+            uint64_t Start = Host::Now();
+            Heap::Free((void*)Argument);
+            if (Host::OnFree != nullptr)
+            {
+                Host::OnFree(Host::Now() - Start);
+            }
+            return 0;
+        }
+        case SYSCALL_SYSTEM:
+        {
+            return (STL::SYSRV)"ERROR: No commands on the host";
+        }
+        default:
+        {
+            return 0;
+        }
+        }
+    }
+}
+
+namespace TSC
+{
+    uint64_t Read()
+    {
+        return Host::Now();
+    }
+
+    uint64_t GetFrequency()
+    {
+        return 1000000000;
+    }
+
+    uint64_t ToMicroseconds(uint64_t Cycles)
+    {
+        return Cycles / 1000;
+    }
+
+    uint64_t ToNanoseconds(uint64_t Cycles)
+    {
+        return Cycles;
+    }
+}
+
+namespace Serial
+{
+    void Kick()
+    {
+
+    }
+
+    void Write(char Chr)
+    {
+        fputc(Chr, stderr);
+    }
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stdint.h>
+
+#define HOST_ARENA_BASE 0x10000000 //Where the fake physical memory is identity mapped.
+#define HOST_ARENA_SIZE (256 * 1024 * 1024)
+
+namespace Host
+{
+    /// <summary>
+    /// Creates the fake physical memory and a matching EFI memory map, then initializes PageAllocator and Heap on top of it.
+    /// The arena is a memfd so MapAddress can alias a physical page at any virtual address, exactly like the kernel page tables.
+    /// </summary>
+    void Init();
+
+    /// <summary>
+    /// Returns a monotonic timestamp in nanoseconds.
+    /// </summary>
+    uint64_t Now();
+
+    /// <summary>
+    /// Prints the min, median and 99th percentile of the given durations, the array is sorted in place.
+    /// </summary>
+    void Report(const char* Name, uint64_t* Samples, uint64_t Amount);
+
+    /// <summary>
+    /// If set, called with the duration of every Heap::Allocate and Heap::Free made through STL::Malloc and STL::Free.
+    /// </summary>
+    extern void (*OnAllocate)(uint64_t Duration);
+    extern void (*OnFree)(uint64_t Duration);
+}
@@ -0,0 +1,236 @@
+#include "Host.h"
+
+#include "STL/List/List.h"
+#include "STL/String/String.h"
+
+#include "Memory/Heap.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define REPLAY_MAX_OPERATIONS (1 << 20)
+#define REPLAY_TABLE_SIZE (1 << 21) //Must be a power of two larger than the amount of live allocations.
+
+/// <summary>
+/// Maps the addresses in a trace to the addresses returned by the heap during the replay.
+/// </summary>
+struct Allocation
+{
+    uint64_t TraceAddress;
+    void* Address;
+};
+
+Allocation Table[REPLAY_TABLE_SIZE];
+
+uint64_t AllocateSamples[REPLAY_MAX_OPERATIONS];
+uint64_t AllocateAmount = 0;
+uint64_t FreeSamples[REPLAY_MAX_OPERATIONS];
+uint64_t FreeAmount = 0;
+
+void RecordAllocate(uint64_t Duration)
+{
+    if (AllocateAmount < REPLAY_MAX_OPERATIONS)
+    {
+        AllocateSamples[AllocateAmount++] = Duration;
+    }
+}
+
+void RecordFree(uint64_t Duration)
+{
+    if (FreeAmount < REPLAY_MAX_OPERATIONS)
+    {
+        FreeSamples[FreeAmount++] = Duration;
+    }
+}
+
+Allocation* FindSlot(uint64_t TraceAddress)
+{
+    uint64_t Index = (TraceAddress >> 6) & (REPLAY_TABLE_SIZE - 1);
+    while (Table[Index].TraceAddress != 0 && Table[Index].TraceAddress != TraceAddress)
+    {
+        Index = (Index + 1) & (REPLAY_TABLE_SIZE - 1);
+    }
+    return &Table[Index];
+}
+
+void RemoveSlot(Allocation* Slot)
+{
+    //Backward shift deletion keeps every probe sequence intact without tombstones.
+    uint64_t Index = Slot - Table;
+    uint64_t Next = (Index + 1) & (REPLAY_TABLE_SIZE - 1);
+    while (Table[Next].TraceAddress != 0)
+    {
+        uint64_t Home = (Table[Next].TraceAddress >> 6) & (REPLAY_TABLE_SIZE - 1);
+        if (((Next - Home) & (REPLAY_TABLE_SIZE - 1)) >= ((Next - Index) & (REPLAY_TABLE_SIZE - 1)))
+        {
+            Table[Index] = Table[Next];
+            Index = Next;
+        }
+        Next = (Next + 1) & (REPLAY_TABLE_SIZE - 1);
+    }
+    Table[Index].TraceAddress = 0;
+}
+
+void Allocate(uint64_t Size, uint64_t TraceAddress)
+{
+    uint64_t Start = Host::Now();
+    void* Address = Heap::Allocate(Size);
+    RecordAllocate(Host::Now() - Start);
+
+    Allocation* Slot = FindSlot(TraceAddress);
+    Slot->TraceAddress = TraceAddress;
+    Slot->Address = Address;
+}
+
+void Free(uint64_t TraceAddress)
+{
+    Allocation* Slot = FindSlot(TraceAddress);
+    if (Slot->TraceAddress == 0)
+    {
+        //Allocated before tracing was turned on.
+        return;
+    }
+
+    uint64_t Start = Host::Now();
+    Heap::Free(Slot->Address);
+    RecordFree(Host::Now() - Start);
+
+    RemoveSlot(Slot);
+}
+
+/// <summary>
+/// Replays every "heap A [SIZE] [ADDRESS]" and "heap F [ADDRESS]" line in a kernel log captured from serial.
+/// </summary>
+bool ReplayTrace(const char* Path)
+{
+    FILE* File = fopen(Path, "r");
+    if (File == nullptr)
+    {
+        perror(Path);
+        return false;
+    }
+
+    char Line[512];
+    while (fgets(Line, sizeof(Line), File) != nullptr)
+    {
+        const char* Operation = strstr(Line, "heap ");
+        if (Operation == nullptr)
+        {
+            continue;
+        }
+
+        uint64_t Size;
+        uint64_t Address;
+        if (sscanf(Operation, "heap A %lu %lx", &Size, &Address) == 2)
+        {
+            Allocate(Size, Address);
+        }
+        else if (sscanf(Operation, "heap F %lx", &Address) == 1)
+        {
+            Free(Address);
+        }
+    }
+
+    fclose(File);
+    return true;
+}
+
+/// <summary>
+/// Without a trace, drives the STL containers the way the terminal does: 
+/// commands are typed one character at a time, kept in a history and windows are opened and closed now and then.
+/// Only the calls that reach the heap are timed, an append that fits in its string is not an allocation.
+/// </summary>
+void ReplayTerminal()
+{
+    STL::List<STL::String*> History;
+    void* Windows[8] = {};
+
+    Host::OnAllocate = RecordAllocate;
+    Host::OnFree = RecordFree;
+
+    srand(1);
+    for (uint64_t Command = 0; Command < 20000; Command++)
+    {
+        STL::String* Input = new STL::String();
+        uint64_t Length = 4 + rand() % 28;
+        for (uint64_t i = 0; i < Length; i++)
+        {
+            *Input += (char)('a' + rand() % 26);
+        }
+        History.Push(Input);
+
+        if (History.Length() > 64)
+        {
+            delete History[0];
+            History.Erase(0);
+        }
+
+        if (rand() % 64 == 0)
+        {
+            uint64_t Window = rand() % 8;
+            if (Windows[Window] != nullptr)
+            {
+                uint64_t Start = Host::Now();
+                Heap::Free(Windows[Window]);
+                RecordFree(Host::Now() - Start);
+                Windows[Window] = nullptr;
+            }
+            else
+            {
+                uint64_t Size = (200 + rand() % 600) * (150 + rand() % 450) * 4;
+                uint64_t Start = Host::Now();
+                Windows[Window] = Heap::Allocate(Size);
+                RecordAllocate(Host::Now() - Start);
+            }
+        }
+    }
+
+    while (History.Length() != 0)
+    {
+        delete History.Pop();
+    }
+
+    Host::OnAllocate = nullptr;
+    Host::OnFree = nullptr;
+}
+
+int main(int argc, char** argv)
+{
+    Host::Init();
+
+    uint64_t Start = Host::Now();
+    if (argc > 1)
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            if (!ReplayTrace(argv[i]))
+            {
+                return 1;
+            }
+        }
+    }
+    else
+    {
+        ReplayTerminal();
+    }
+    uint64_t End = Host::Now();
+
+    AllocateAmount = AllocateAmount < REPLAY_MAX_OPERATIONS ? AllocateAmount : REPLAY_MAX_OPERATIONS;
+    FreeAmount = FreeAmount < REPLAY_MAX_OPERATIONS ? FreeAmount : REPLAY_MAX_OPERATIONS;
+
+    printf("%-32s %15s %15s %15s\n", "OPERATION", "MIN", "MEDIAN", "P99");
+    if (AllocateAmount != 0)
+    {
+        Host::Report("allocate", AllocateSamples, AllocateAmount);
+    }
+    if (FreeAmount != 0)
+    {
+        Host::Report("free", FreeSamples, FreeAmount);
+    }
+
+    printf("Replayed %lu allocations and %lu frees in %lu us\n", AllocateAmount, FreeAmount, (End - Start) / 1000);
+    printf("Heap: %lu segments, %lu KB used, %lu KB free\n", Heap::GetSegmentAmount(), Heap::GetUsedSize() / 1024, Heap::GetFreeSize() / 1024);
+
+    return 0;
+}
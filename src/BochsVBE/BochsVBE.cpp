@@ -0,0 +1,197 @@
+#include "BochsVBE.h"
+
+#include "PCI/PCI.h"
+#include "IO/IO.h"
+#include "Memory/Paging/PageTable.h"
+
+#define VBE_DISPI_IOPORT_INDEX 0x01CE
+#define VBE_DISPI_IOPORT_DATA 0x01CF
+#define VBE_DISPI_MMIO_OFFSET 0x500
+
+#define VBE_DISPI_INDEX_ID 0x0
+#define VBE_DISPI_INDEX_XRES 0x1
+#define VBE_DISPI_INDEX_YRES 0x2
+#define VBE_DISPI_INDEX_BPP 0x3
+#define VBE_DISPI_INDEX_ENABLE 0x4
+#define VBE_DISPI_INDEX_VIRT_WIDTH 0x6
+#define VBE_DISPI_INDEX_VIRT_HEIGHT 0x7
+#define VBE_DISPI_INDEX_X_OFFSET 0x8
+#define VBE_DISPI_INDEX_Y_OFFSET 0x9
+#define VBE_DISPI_INDEX_VIDEO_MEMORY_64K 0xA
+
+#define VBE_DISPI_ID_MIN 0xB0C0
+#define VBE_DISPI_ID_MAX 0xB0C5
+
+#define VBE_DISPI_DISABLED 0x00
+#define VBE_DISPI_ENABLED 0x01
+#define VBE_DISPI_LFB_ENABLED 0x40
+
+#define BOCHSVBE_MAX_PAGES 2
+
+namespace BochsVBE
+{
+    PCIHeader* Device = nullptr;
+
+    uint64_t VideoMemory = 0;
+    uint64_t VideoMemorySize = 0;
+
+    /// <summary>
+    /// The DISPI registers when the device has an MMIO bar, nullptr if they are only reachable through IO ports.
+    /// </summary>
+    volatile uint16_t* Registers = nullptr;
+
+    uint64_t MappedSize = 0;
+
+    uint32_t ModeWidth = 0;
+    uint32_t ModeHeight = 0;
+
+    void Write(uint16_t Index, uint16_t Value)
+    {
+        if (Registers != nullptr)
+        {
+            Registers[Index] = Value;
+        }
+        else
+        {
+            IO::OutWord(VBE_DISPI_IOPORT_INDEX, Index);
+            IO::OutWord(VBE_DISPI_IOPORT_DATA, Value);
+        }
+    }
+
+    uint16_t Read(uint16_t Index)
+    {
+        if (Registers != nullptr)
+        {
+            return Registers[Index];
+        }
+        else
+        {
+            IO::OutWord(VBE_DISPI_IOPORT_INDEX, Index);
+            return IO::InWord(VBE_DISPI_IOPORT_DATA);
+        }
+    }
+
+    bool Init()
+    {
+        Device = nullptr;
+
+        DeviceHeader* Header;
+        PCI::ResetEnumeration();
+        while (PCI::Enumerate(Header))
+        { 
+            if (Header->VendorID == BOCHSVBE_VENDOR_ID && Header->DeviceID == BOCHSVBE_DEVICE_ID)
+            {
+                Device = (PCIHeader*)Header;
+            }
+        }
+
+        if (Device == nullptr)
+        {
+            return false;
+        }
+
+        //BAR0 is the prefetchable framebuffer, it may be 64 bit.
+        VideoMemory = Device->BAR0 & ~(uint64_t)0xF;
+        if ((Device->BAR0 & 0b110) == 0b100)
+        {
+            VideoMemory |= (uint64_t)Device->BAR1 << 32;
+        }
+
+        //BAR2 holds the DISPI registers on bochs-display and newer stdvga, older stdvga only has the IO ports.
+        uint64_t MMIO = Device->BAR2 & ~(uint64_t)0xF;
+        if (MMIO != 0 && !(Device->BAR2 & 0b1))
+        {
+            PageTableManager::MapAddress((void*)MMIO, (void*)MMIO);
+            Registers = (volatile uint16_t*)(MMIO + VBE_DISPI_MMIO_OFFSET);
+        }
+
+        uint16_t ID = Read(VBE_DISPI_INDEX_ID);
+        if (VideoMemory == 0 || ID < VBE_DISPI_ID_MIN || ID > VBE_DISPI_ID_MAX)
+        {
+            Device = nullptr;
+            return false;
+        }
+
+        VideoMemorySize = (uint64_t)Read(VBE_DISPI_INDEX_VIDEO_MEMORY_64K) * 64 * 1024;
+
+        return true;
+    }
+
+    uint32_t SetMode(uint32_t Width, uint32_t Height)
+    {
+        if (Device == nullptr || Width == 0 || Height == 0)
+        {
+            return 0;
+        }
+
+        uint64_t PageSize = (uint64_t)Width * Height * 4;
+        uint32_t PageAmount = VideoMemorySize / PageSize;
+        if (PageAmount == 0)
+        {
+            return 0;
+        }
+        PageAmount = PageAmount > BOCHSVBE_MAX_PAGES ? BOCHSVBE_MAX_PAGES : PageAmount;
+
+        //The firmware mode is kept so it can be restored if the new one is refused.
+        uint16_t Previous[VBE_DISPI_INDEX_Y_OFFSET + 1];
+        for (uint16_t i = VBE_DISPI_INDEX_XRES; i <= VBE_DISPI_INDEX_Y_OFFSET; i++)
+        {
+            Previous[i] = Read(i);
+        }
+
+        Write(VBE_DISPI_INDEX_ENABLE, VBE_DISPI_DISABLED);
+        Write(VBE_DISPI_INDEX_XRES, Width);
+        Write(VBE_DISPI_INDEX_YRES, Height);
+        Write(VBE_DISPI_INDEX_BPP, 32);
+        Write(VBE_DISPI_INDEX_VIRT_WIDTH, Width);
+        Write(VBE_DISPI_INDEX_VIRT_HEIGHT, Height * PageAmount);
+        Write(VBE_DISPI_INDEX_X_OFFSET, 0);
+        Write(VBE_DISPI_INDEX_Y_OFFSET, 0);
+        Write(VBE_DISPI_INDEX_ENABLE, VBE_DISPI_ENABLED | VBE_DISPI_LFB_ENABLED);
+
+        //The device may round or refuse the mode.
+        if (Read(VBE_DISPI_INDEX_XRES) != Width || Read(VBE_DISPI_INDEX_YRES) != Height || Read(VBE_DISPI_INDEX_BPP) != 32)
+        {
+            Write(VBE_DISPI_INDEX_ENABLE, VBE_DISPI_DISABLED);
+            for (uint16_t i = VBE_DISPI_INDEX_XRES; i <= VBE_DISPI_INDEX_Y_OFFSET; i++)
+            {
+                if (i != VBE_DISPI_INDEX_ENABLE)
+                {
+                    Write(i, Previous[i]);
+                }
+            }
+            Write(VBE_DISPI_INDEX_ENABLE, Previous[VBE_DISPI_INDEX_ENABLE] | VBE_DISPI_LFB_ENABLED);
+            return 0;
+        }
+        if (Read(VBE_DISPI_INDEX_VIRT_HEIGHT) < Height * PageAmount)
+        {
+            PageAmount = 1;
+        }
+
+        for (; MappedSize < PageSize * PageAmount; MappedSize += 4096)
+        {
+            PageTableManager::MapAddress((void*)(VideoMemory + MappedSize), (void*)(VideoMemory + MappedSize));
+        }
+
+        ModeWidth = Width;
+        ModeHeight = Height;
+
+        return PageAmount;
+    }
+
+    STL::Framebuffer GetPage(uint32_t Index)
+    {
+        STL::Framebuffer Page;
+        Page.Width = ModeWidth;
+        Page.Height = ModeHeight;
+        Page.PixelsPerScanline = ModeWidth;
+        Page.Size = (uint64_t)ModeWidth * ModeHeight * 4;
+        Page.Base = (STL::ARGB*)(VideoMemory + Page.Size * Index);
+        return Page;
+    }
+
+    void Flip(uint32_t Index)
+    {
+        Write(VBE_DISPI_INDEX_Y_OFFSET, ModeHeight * Index);
+    }
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "STL/Graphics/Framebuffer.h"
+
+#define BOCHSVBE_VENDOR_ID 0x1234
+#define BOCHSVBE_DEVICE_ID 0x1111
+
+namespace BochsVBE
+{
+    /// <summary>
+    /// Looks for the QEMU/Bochs display adapter (-vga std or -device bochs-display) on the PCI bus and returns true if it was found.
+    /// </summary>
+    bool Init();
+
+    /// <summary>
+    /// Sets a 32 bit mode of Width by Height with a virtual height of twice the screen if video memory allows it.
+    /// Returns the amount of pages that fit, or 0 if the mode could not be set.
+    /// </summary>
+    uint32_t SetMode(uint32_t Width, uint32_t Height);
+
+    /// <summary>
+    /// Returns page Index of the current mode as a framebuffer.
+    /// </summary>
+    STL::Framebuffer GetPage(uint32_t Index);
+
+    /// <summary>
+    /// Shows page Index by moving the Y offset of the display, takes effect at the next scanout.
+    /// </summary>
+    void Flip(uint32_t Index);
+}
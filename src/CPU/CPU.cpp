@@ -0,0 +1,151 @@
+#include "CPU.h"
+
+#define CR0_EM (1 << 2)
+#define CR0_MP (1 << 1)
+#define CR4_OSFXSR (1 << 9)
+#define CR4_OSXMMEXCPT (1 << 10)
+#define CR4_OSXSAVE (1 << 18)
+
+#define CPUID1_ECX_PCID (1 << 17)
+#define CPUID1_ECX_XSAVE (1 << 26)
+#define CPUID1_ECX_AVX (1 << 28)
+#define CPUID7_EBX_AVX2 (1 << 5)
+#define CPUID7_EBX_INVPCID (1 << 10)
+
+#define XCR0_X87 (1 << 0)
+#define XCR0_SSE (1 << 1)
+#define XCR0_AVX (1 << 2)
+
+namespace CPU
+{
+    bool AVX2 = false;
+    bool XSAVE = false;
+    bool PCID = false;
+    bool INVPCID = false;
+
+    void CPUID(uint32_t Leaf, uint32_t SubLeaf, uint32_t& EAX, uint32_t& EBX, uint32_t& ECX, uint32_t& EDX)
+    {
+        asm volatile ("CPUID" : "=a"(EAX), "=b"(EBX), "=c"(ECX), "=d"(EDX) : "a"(Leaf), "c"(SubLeaf));
+    }
+
+    void Init()
+    {
+        uint64_t CR0;
+        uint64_t CR4;
+        asm volatile ("MOV %%CR0, %0" : "=r"(CR0));
+        asm volatile ("MOV %%CR4, %0" : "=r"(CR4));
+
+        CR0 = (CR0 & ~(uint64_t)CR0_EM) | CR0_MP;
+        CR4 |= CR4_OSFXSR | CR4_OSXMMEXCPT;
+
+        uint32_t EAX, EBX, ECX, EDX;
+        CPUID(0, 0, EAX, EBX, ECX, EDX);
+        uint32_t MaxLeaf = EAX;
+
+        CPUID(1, 0, EAX, EBX, ECX, EDX);
+        PCID = ECX & CPUID1_ECX_PCID;
+        bool AVX = (ECX & CPUID1_ECX_XSAVE) && (ECX & CPUID1_ECX_AVX);
+        if (AVX)
+        {
+            CR4 |= CR4_OSXSAVE;
+        }
+
+        asm volatile ("MOV %0, %%CR0" : : "r"(CR0));
+        asm volatile ("MOV %0, %%CR4" : : "r"(CR4));
+
+        if (MaxLeaf >= 7)
+        {
+            CPUID(7, 0, EAX, EBX, ECX, EDX);
+            INVPCID = PCID && (EBX & CPUID7_EBX_INVPCID);
+        }
+
+        if (!AVX)
+        {
+            return;
+        }
+
+        uint32_t Low;
+        uint32_t High;
+        asm volatile ("XGETBV" : "=a"(Low), "=d"(High) : "c"(0));
+        Low |= XCR0_X87 | XCR0_SSE | XCR0_AVX;
+        asm volatile ("XSETBV" : : "a"(Low), "d"(High), "c"(0));
+        XSAVE = true;
+
+        if (MaxLeaf >= 7)
+        {
+            CPUID(7, 0, EAX, EBX, ECX, EDX);
+            AVX2 = EBX & CPUID7_EBX_AVX2;
+        }
+    }
+
+    bool HasAVX2()
+    {
+        return AVX2;
+    }
+
+    bool HasPCID()
+    {
+        return PCID;
+    }
+
+    bool HasINVPCID()
+    {
+        return INVPCID;
+    }
+
+    void SaveFPU(void* Area)
+    {
+        if (XSAVE)
+        {
+            //XSAVE leaves most of the header alone and XRSTOR faults on garbage in it.
+            for (uint64_t i = 0; i < 8; i++)
+            {
+                ((uint64_t*)((uint64_t)Area + 512))[i] = 0;
+            }
+
+            //Only the components the kernel enabled, so the area stays the same size whatever else the firmware turned on.
+            asm volatile ("XSAVE64 (%0)" : : "r"(Area), "a"(XCR0_X87 | XCR0_SSE | XCR0_AVX), "d"(0) : "memory");
+        }
+        else
+        {
+            asm volatile ("FXSAVE64 (%0)" : : "r"(Area) : "memory");
+        }
+    }
+
+    void RestoreFPU(void* Area)
+    {
+        if (XSAVE)
+        {
+            asm volatile ("XRSTOR64 (%0)" : : "r"(Area), "a"(XCR0_X87 | XCR0_SSE | XCR0_AVX), "d"(0) : "memory");
+        }
+        else
+        {
+            asm volatile ("FXRSTOR64 (%0)" : : "r"(Area) : "memory");
+        }
+    }
+
+    uint64_t DisableInterrupts()
+    {
+        uint64_t Flags;
+        asm volatile ("PUSHFQ\n\tPOP %0\n\tCLI" : "=r"(Flags) : : "memory");
+        return Flags;
+    }
+
+    void RestoreInterrupts(uint64_t Flags)
+    {
+        asm volatile ("PUSH %0\n\tPOPFQ" : : "r"(Flags) : "memory", "cc");
+    }
+
+    uint64_t ReadMSR(uint32_t MSR)
+    {
+        uint32_t Low;
+        uint32_t High;
+        asm volatile ("RDMSR" : "=a"(Low), "=d"(High) : "c"(MSR));
+        return ((uint64_t)High << 32) | Low;
+    }
+
+    void WriteMSR(uint32_t MSR, uint64_t Value)
+    {
+        asm volatile ("WRMSR" : : "a"((uint32_t)Value), "d"((uint32_t)(Value >> 32)), "c"(MSR));
+    }
+}
\ No newline at end of file
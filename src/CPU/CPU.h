@@ -0,0 +1,54 @@
+#pragma once
+
+#include <stdint.h>
+
+#define MSR_EFER 0xC0000080
+#define MSR_STAR 0xC0000081
+#define MSR_LSTAR 0xC0000082
+#define MSR_SFMASK 0xC0000084
+#define MSR_GS_BASE 0xC0000101
+#define MSR_KERNEL_GS_BASE 0xC0000102
+
+#define CPU_FPU_STATE_SIZE 1024 //Enough for the x87, SSE and AVX state XSAVE stores.
+
+namespace CPU
+{
+    /// <summary>
+    /// Enables SSE and, if the processor supports it, AVX state saving so vector instructions can be used by the kernel.
+    /// </summary>
+    void Init();
+
+    /// <summary>
+    /// Returns true if AVX2 is supported and was enabled by Init.
+    /// </summary>
+    bool HasAVX2();
+
+    /// <summary>
+    /// Returns true if address spaces can be tagged with a PCID, it is enabled by AddressSpace::Init.
+    /// </summary>
+    bool HasPCID();
+
+    bool HasINVPCID();
+
+    /// <summary>
+    /// Saves the x87, SSE and AVX registers to a 64 byte aligned area of CPU_FPU_STATE_SIZE bytes, which can be uninitialized stack.
+    /// Uses XSAVE when AVX is enabled, as FXSAVE leaves the upper halves of the YMM registers out.
+    /// </summary>
+    void SaveFPU(void* Area);
+
+    void RestoreFPU(void* Area);
+
+    /// <summary>
+    /// Disables interrupts and returns the flags from before, to be passed to RestoreInterrupts.
+    /// </summary>
+    uint64_t DisableInterrupts();
+
+    /// <summary>
+    /// Enables interrupts again only if they were enabled when DisableInterrupts returned Flags.
+    /// </summary>
+    void RestoreInterrupts(uint64_t Flags);
+
+    uint64_t ReadMSR(uint32_t MSR);
+
+    void WriteMSR(uint32_t MSR, uint64_t Value);
+}
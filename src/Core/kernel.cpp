@@ -15,29 +15,85 @@ void* __cxa_atexit = (void*) &__cxa_atexit;
 /// </summary>
 extern "C" void KernelMain(BootLoaderInfo* BootInfo)
 {
+	BootTrace::Init(BootInfo->Trace);
+
 	InitGDT();
+	BootTrace::Mark("GDT setup");
+
+	//Vector extensions used by the compositor.
+	CPU::Init();
+	BootTrace::Mark("CPU setup");
+
+	//Entry path for user mode.
+	Syscall::Init();
+	BootTrace::Mark("Syscall setup");
 
 	//Runtime services setup.
 	UEFI::Init(BootInfo->RT);
+	BootTrace::Mark("UEFI setup");
 
 	//Heap setup.
 	PageAllocator::Init(BootInfo->MemoryMap, BootInfo->ScreenBuffer);
+	BootTrace::Mark("Page allocator setup");
 	PageTableManager::Init(BootInfo->ScreenBuffer);
+	AddressSpace::Init();
 	Heap::Init();
+	BootTrace::Mark("Heap setup");
+
+	//Initrd setup.
+	RAMFS::Init(BootInfo->Initrd);
+	BootTrace::Mark("RAMFS setup");
 
 	//Renderer setup.
-	STL::SetFonts(BootInfo->PSFFonts, BootInfo->FontAmount);
+	Renderer::LoadFonts("fonts/");
 	Renderer::Init(BootInfo->ScreenBuffer);
+	BootTrace::Mark("Renderer setup");
+
+	//Debug output setup.
+	Serial::Init();
+	TSC::Calibrate();
+	BootTrace::Mark("TSC calibration");
 
 	//Interrupt setup.
 	PIT::SetFrequency(100);
 	RTC::Update();
+	SharedPage::Init();
 	IDT::SetupInterrupts();
+	BootTrace::Mark("Interrupt setup");
 	
 	//AHCI setup.
 	ACPI::Init(BootInfo->RSDP);
 	PCI::Init();
 	AHCI::Init();
+	BootTrace::Mark("AHCI setup");
+
+	//Display setup, a virtio-gpu resource or Bochs page flipping replaces the GOP framebuffer if either device is present.
+	STL::Point Resolution = Renderer::GetScreenSize();
+	if (VirtioGPU::Init() && VirtioGPU::SetMode(Resolution.X, Resolution.Y))
+	{
+		STL::Framebuffer Framebuffer = VirtioGPU::GetFramebuffer();
+		Renderer::SetDisplay(&Framebuffer, 1, nullptr, VirtioGPU::Flush);
+	}
+	else if (BochsVBE::Init())
+	{
+		uint32_t PageAmount = BochsVBE::SetMode(Resolution.X, Resolution.Y);
+
+		if (PageAmount != 0)
+		{
+			STL::Framebuffer Pages[2] = {BochsVBE::GetPage(0), BochsVBE::GetPage(1)};
+			Renderer::SetDisplay(Pages, PageAmount, BochsVBE::Flip);
+		}
+	}
+	BootTrace::Mark("Display setup");
+
+	Log::Info(BootTrace::GetReport());
+
+	//Commands to run at boot, used for headless benchmark runs.
+	RAMFS::File Autorun;
+	if (RAMFS::Find("autorun", Autorun))
+	{
+		System::RunScript((const char*)Autorun.Data, Autorun.Size);
+	}
 
 	ProcessHandler::Loop();
 
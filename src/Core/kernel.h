@@ -7,6 +7,7 @@
 #include "Memory/Heap.h"
 #include "Memory/Paging/PageAllocator.h"
 #include "Memory/Paging/PageTable.h"
+#include "Memory/Paging/AddressSpace.h"
 #include "Input/KeyBoard.h"
 #include "Input/Mouse.h"
 #include "PIT/PIT.h"
@@ -18,6 +19,16 @@
 #include "AHCI/AHCI.h"
 #include "PCI/PCI.h"
 #include "UEFI/UEFI.h"
+#include "RAMFS/RAMFS.h"
+#include "TSC/TSC.h"
+#include "SharedPage/SharedPage.h"
+#include "CPU/CPU.h"
+#include "Syscall/Syscall.h"
+#include "BochsVBE/BochsVBE.h"
+#include "VirtioGPU/VirtioGPU.h"
+#include "Serial/Serial.h"
+#include "Log/Log.h"
+#include "Profiling/BootTrace.h"
 
 /// <summary>
 /// Compiler definitions.
@@ -32,11 +43,11 @@ extern "C" void* __cxa_atexit;
 struct BootLoaderInfo
 {
 	STL::Framebuffer* ScreenBuffer;
-	STL::PSF_FONT** PSFFonts;
-	uint8_t FontAmount;
+	InitrdInfo* Initrd;
 	EFI_MEMORY_MAP* MemoryMap;
 	RSDP2* RSDP;
 	EfiRuntimeServices* RT;
+	BootLoaderTrace* Trace;
 };
 
 /// <summary>
@@ -8,6 +8,7 @@
 #include "Memory/Paging/PageAllocator.h"
 #include "Memory/Heap.h"
 #include "System/System.h"
+#include "Log/Log.h"
 
 #include "Version.h"
 
@@ -42,6 +43,11 @@ namespace Debug
     {
         asm("CLI");
 
+        //Get the message out over serial first in case drawing the panic screen faults.
+        Log::Error("KERNEL PANIC!");
+        Log::Error(Message);
+        Log::Flush();
+
         uint8_t Scale = 3;
         STL::Point StartPoint = STL::Point(100, 50);
 
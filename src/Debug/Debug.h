@@ -3,7 +3,7 @@
 namespace Debug
 {    
     /// <summary>
-    /// Halts the system, clears the interupt flag and prints the given message.
+    /// Halts the system, clears the interupt flag and prints the given message to the screen and the serial port.
     /// After this function has been called the only way to return is to reboot the pc.
     /// </summary>
     void Error(const char* Message);
@@ -0,0 +1,317 @@
+#include "ELF.h"
+
+#include "STL/Memory/Memory.h"
+#include "STL/Math/Math.h"
+#include "Memory/Heap.h"
+#include "Memory/Paging/PageAllocator.h"
+#include "RAMFS/RAMFS.h"
+#include "Syscall/Syscall.h"
+#include "SharedPage/SharedPage.h"
+#include "PIT/PIT.h"
+
+#define ELF_MAGIC 0x464C457F //"\x7FELF" read as a little endian integer.
+#define ELF_CLASS_64 2
+#define ELF_DATA_LITTLE_ENDIAN 1
+#define ELF_MACHINE_X86_64 0x3E
+
+#define ELF_TYPE_EXECUTABLE 2
+#define ELF_TYPE_SHARED 3
+
+#define ELF_SEGMENT_LOAD 1
+#define ELF_SEGMENT_INTERPRETER 3
+
+#define ELF_FLAG_WRITE (1 << 1)
+
+namespace ELF
+{
+    struct FileHeader
+    {
+        uint32_t Magic;
+        uint8_t Class;
+        uint8_t Data;
+        uint8_t IdentVersion;
+        uint8_t ABI;
+        uint8_t Padding[8];
+        uint16_t Type;
+        uint16_t Machine;
+        uint32_t Version;
+        uint64_t Entry;
+        uint64_t ProgramHeaderOffset;
+        uint64_t SectionHeaderOffset;
+        uint32_t Flags;
+        uint16_t HeaderSize;
+        uint16_t ProgramHeaderSize;
+        uint16_t ProgramHeaderAmount;
+        uint16_t SectionHeaderSize;
+        uint16_t SectionHeaderAmount;
+        uint16_t SectionNameIndex;
+    } __attribute__((packed));
+
+    struct ProgramHeader
+    {
+        uint32_t Type;
+        uint32_t Flags;
+        uint64_t Offset;
+        uint64_t VirtualAddress;
+        uint64_t PhysicalAddress;
+        uint64_t FileSize;
+        uint64_t MemorySize;
+        uint64_t Align;
+    } __attribute__((packed));
+
+    Image* Images = nullptr;
+
+    Program* Running = nullptr;
+
+    uint64_t Deadline = 0; //In PIT ticks.
+
+    uint64_t PageStart(uint64_t Address)
+    {
+        return Address & ~0xFFFull;
+    }
+
+    uint64_t PageEnd(uint64_t Address)
+    {
+        return (Address + 0xFFF) & ~0xFFFull;
+    }
+
+    /// <summary>
+    /// Returns the image of a file, parsing it the first time, or nullptr if it can not be run.
+    /// </summary>
+    Image* GetImage(RAMFS::File& File)
+    {
+        for (Image* Current = Images; Current != nullptr; Current = Current->Next)
+        {
+            if (Current->Data == File.Data)
+            {
+                return Current;
+            }
+        }
+
+        FileHeader* Header = (FileHeader*)File.Data;
+        if (File.Size < sizeof(FileHeader) || Header->Magic != ELF_MAGIC || Header->Class != ELF_CLASS_64 ||
+            Header->Data != ELF_DATA_LITTLE_ENDIAN || Header->Machine != ELF_MACHINE_X86_64 ||
+            (Header->Type != ELF_TYPE_EXECUTABLE && Header->Type != ELF_TYPE_SHARED) ||
+            Header->ProgramHeaderSize != sizeof(ProgramHeader) ||
+            Header->ProgramHeaderOffset + Header->ProgramHeaderAmount * sizeof(ProgramHeader) > File.Size)
+        {
+            return nullptr;
+        }
+
+        Image NewImage;
+        NewImage.Name = File.Name;
+        NewImage.Data = (uint8_t*)File.Data;
+        NewImage.Size = File.Size;
+        NewImage.PositionIndependent = Header->Type == ELF_TYPE_SHARED;
+        NewImage.Entry = Header->Entry;
+        NewImage.SegmentAmount = 0;
+        NewImage.SharedPageAmount = 0;
+
+        uint64_t Base = NewImage.PositionIndependent ? ELF_PIE_BASE : 0;
+
+        ProgramHeader* ProgramHeaders = (ProgramHeader*)(NewImage.Data + Header->ProgramHeaderOffset);
+        for (uint64_t i = 0; i < Header->ProgramHeaderAmount; i++)
+        {
+            ProgramHeader& Current = ProgramHeaders[i];
+
+            //Programs needing a dynamic linker can not be run, there is none.
+            if (Current.Type == ELF_SEGMENT_INTERPRETER)
+            {
+                return nullptr;
+            }
+            else if (Current.Type != ELF_SEGMENT_LOAD || Current.MemorySize == 0)
+            {
+                continue;
+            }
+
+            //Every page of a segment has to be in the user region below the stack.
+            if (NewImage.SegmentAmount == ELF_SEGMENT_AMOUNT || Current.FileSize > Current.MemorySize ||
+                Current.Offset + Current.FileSize > File.Size || Current.Offset + Current.FileSize < Current.Offset ||
+                Base + Current.VirtualAddress < USER_SPACE_START ||
+                Base + Current.VirtualAddress + Current.MemorySize > ELF_STACK_TOP - ELF_STACK_SIZE ||
+                Base + Current.VirtualAddress + Current.MemorySize < Base + Current.VirtualAddress)
+            {
+                return nullptr;
+            }
+
+            //A page is filled from a single segment, as linkers lay them out by default.
+            for (uint64_t j = 0; j < NewImage.SegmentAmount; j++)
+            {
+                Segment& Other = NewImage.Segments[j];
+                if (PageStart(Current.VirtualAddress) < PageEnd(Other.Address + Other.MemorySize) &&
+                    PageStart(Other.Address) < PageEnd(Current.VirtualAddress + Current.MemorySize))
+                {
+                    return nullptr;
+                }
+            }
+
+            Segment& NewSegment = NewImage.Segments[NewImage.SegmentAmount];
+            NewSegment.Address = Current.VirtualAddress;
+            NewSegment.FileOffset = Current.Offset;
+            NewSegment.FileSize = Current.FileSize;
+            NewSegment.MemorySize = Current.MemorySize;
+            NewSegment.Writable = Current.Flags & ELF_FLAG_WRITE;
+            NewSegment.SharedPages = nullptr;
+            NewImage.SegmentAmount++;
+        }
+
+        if (NewImage.SegmentAmount == 0)
+        {
+            return nullptr;
+        }
+
+        for (uint64_t i = 0; i < NewImage.SegmentAmount; i++)
+        {
+            Segment& Current = NewImage.Segments[i];
+            if (!Current.Writable)
+            {
+                uint64_t PageAmount = (PageEnd(Current.Address + Current.MemorySize) - PageStart(Current.Address)) / 4096;
+                Current.SharedPages = (void**)Heap::Allocate(PageAmount * sizeof(void*));
+                STL::SetMemory(Current.SharedPages, 0, PageAmount * sizeof(void*));
+            }
+        }
+
+        Image* Cached = (Image*)Heap::Allocate(sizeof(Image));
+        *Cached = NewImage;
+        Cached->Next = Images;
+        Images = Cached;
+
+        return Cached;
+    }
+
+    /// <summary>
+    /// Fills a page of a segment, Page is relative to the base of the program.
+    /// </summary>
+    void FillPage(Image* Source, Segment& Target, uint64_t Page, void* Destination)
+    {
+        STL::SetMemory(Destination, 0, 4096);
+
+        uint64_t Start = STL::Max(Page, Target.Address);
+        uint64_t End = STL::Min(Page + 4096, Target.Address + Target.FileSize);
+        if (Start < End)
+        {
+            STL::CopyMemory(Source->Data + Target.FileOffset + (Start - Target.Address), (uint8_t*)Destination + (Start - Page), End - Start);
+        }
+    }
+
+    Program* Load(const char* Path)
+    {
+        RAMFS::File File;
+        if (!RAMFS::Find(Path, File))
+        {
+            return nullptr;
+        }
+
+        Image* Source = GetImage(File);
+        if (Source == nullptr)
+        {
+            return nullptr;
+        }
+
+        AddressSpace::Space* Space = AddressSpace::Create();
+        if (Space == nullptr)
+        {
+            return nullptr;
+        }
+        else if (!SharedPage::Map(Space, (void*)ELF_SYSTEM_PAGE))
+        {
+            AddressSpace::Destroy(Space);
+            return nullptr;
+        }
+
+        Program* NewProgram = (Program*)Heap::Allocate(sizeof(Program));
+        NewProgram->Source = Source;
+        NewProgram->Space = Space;
+        NewProgram->Base = Source->PositionIndependent ? ELF_PIE_BASE : 0;
+        NewProgram->PageFaults = 0;
+
+        return NewProgram;
+    }
+
+    void Unload(Program* Target)
+    {
+        //Only private pages are owned by the space, the shared ones stay with the image.
+        AddressSpace::Destroy(Target->Space);
+        Heap::Free(Target);
+    }
+
+    uint64_t Run(Program* Target, uint64_t Argument)
+    {
+        Program* Previous = Running;
+        AddressSpace::Space* PreviousSpace = AddressSpace::GetCurrent();
+
+        Deadline = PIT::Ticks + ELF_TIME_LIMIT * PIT::GetFrequency();
+        Running = Target;
+        AddressSpace::Switch(Target->Space);
+
+        uint64_t Result = EnterUser(Target->Base + Target->Source->Entry, ELF_STACK_TOP, Argument);
+
+        AddressSpace::Switch(PreviousSpace);
+        Running = Previous;
+
+        return Result;
+    }
+
+    bool IsOverdue()
+    {
+        return Running != nullptr && PIT::Ticks >= Deadline;
+    }
+
+    bool HandlePageFault(uint64_t Address)
+    {
+        if (Running == nullptr)
+        {
+            return false;
+        }
+
+        uint64_t Page = PageStart(Address);
+        if (Page >= ELF_STACK_TOP - ELF_STACK_SIZE && Page < ELF_STACK_TOP)
+        {
+            AddressSpace::Allocate(Running->Space, (void*)Page);
+            Running->PageFaults++;
+            return true;
+        }
+
+        Image* Source = Running->Source;
+        uint64_t Relative = Page - Running->Base;
+        for (uint64_t i = 0; i < Source->SegmentAmount; i++)
+        {
+            Segment& Current = Source->Segments[i];
+            if (Relative < PageStart(Current.Address) || Relative >= PageEnd(Current.Address + Current.MemorySize))
+            {
+                continue;
+            }
+
+            if (Current.Writable)
+            {
+                FillPage(Source, Current, Relative, AddressSpace::Allocate(Running->Space, (void*)Page));
+            }
+            else
+            {
+                void*& Shared = Current.SharedPages[(Relative - PageStart(Current.Address)) / 4096];
+                if (Shared == nullptr)
+                {
+                    Shared = PageAllocator::RequestPage();
+                    FillPage(Source, Current, Relative, Shared);
+                    Source->SharedPageAmount++;
+                }
+                AddressSpace::Map(Running->Space, (void*)Page, Shared, false);
+            }
+
+            Running->PageFaults++;
+            return true;
+        }
+
+        return false;
+    }
+
+    Program* GetRunning()
+    {
+        return Running;
+    }
+
+    Image* GetImages()
+    {
+        return Images;
+    }
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "Memory/Paging/AddressSpace.h"
+
+#define ELF_SEGMENT_AMOUNT 8
+
+#define ELF_PIE_BASE (USER_SPACE_START + 0x400000) //Where position independent programs are placed.
+#define ELF_STACK_TOP (USER_SPACE_END - 0x1000)
+#define ELF_STACK_SIZE 0x100000
+#define ELF_SYSTEM_PAGE ELF_STACK_TOP //The read only system page sits directly above the stack.
+#define ELF_TIME_LIMIT 10 //Seconds a program may run before it is aborted, the process loop waits for it meanwhile.
+
+/// <summary>
+/// Loads static or position independent ELF64 programs from the initrd into their own address space.
+/// Nothing is copied when a program is loaded, every page is filled in by the page fault handler the first time it is touched.
+/// Only these programs run in ring 3, the built in programs like Terminal and Calculator are still kernel procedures sharing the kernel heap.
+/// </summary>
+namespace ELF
+{
+    /// <summary>
+    /// A PT_LOAD segment, addresses are relative to the base of the program.
+    /// </summary>
+    struct Segment
+    {
+        uint64_t Address;
+        uint64_t FileOffset;
+        uint64_t FileSize;
+        uint64_t MemorySize;
+        bool Writable;
+
+        /// <summary>
+        /// The pages of a read only segment, filled in once and mapped into every program using the image.
+        /// </summary>
+        void** SharedPages;
+    };
+
+    /// <summary>
+    /// A parsed ELF file, kept for as long as the kernel runs so its shared pages outlive the programs using them.
+    /// </summary>
+    struct Image
+    {
+        const char* Name;
+        uint8_t* Data;
+        uint64_t Size;
+
+        uint64_t Entry;
+        bool PositionIndependent;
+
+        Segment Segments[ELF_SEGMENT_AMOUNT];
+        uint64_t SegmentAmount;
+
+        uint64_t SharedPageAmount;
+
+        Image* Next;
+    };
+
+    /// <summary>
+    /// A loaded instance of an image.
+    /// </summary>
+    struct Program
+    {
+        Image* Source;
+        AddressSpace::Space* Space;
+        uint64_t Base;
+
+        /// <summary>
+        /// The amount of pages filled in for this program so far.
+        /// </summary>
+        uint64_t PageFaults;
+    };
+
+    /// <summary>
+    /// Creates a program from the file at Path in the initrd, returns nullptr if it is missing or not a usable ELF64 executable.
+    /// </summary>
+    Program* Load(const char* Path);
+
+    void Unload(Program* Target);
+
+    /// <summary>
+    /// Runs a program from its entry point with Argument in RDI until it makes the SYSCALL_EXIT syscall, returns its exit value or USER_ABORTED.
+    /// </summary>
+    uint64_t Run(Program* Target, uint64_t Argument = 0);
+
+    /// <summary>
+    /// Called on a page fault for a page that is not present, maps the page if it belongs to the running program and returns true.
+    /// </summary>
+    bool HandlePageFault(uint64_t Address);
+
+    /// <summary>
+    /// Returns true if the running program has used up ELF_TIME_LIMIT, checked by the PIT which then aborts it.
+    /// </summary>
+    bool IsOverdue();
+
+    /// <summary>
+    /// Returns the program being run, or nullptr if none is.
+    /// </summary>
+    Program* GetRunning();
+
+    /// <summary>
+    /// Returns the first cached image, the rest are reached through Next.
+    /// </summary>
+    Image* GetImages();
+}
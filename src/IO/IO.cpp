@@ -14,6 +14,18 @@ namespace IO
         return ReturnValue;
     }
 
+    void OutWord(uint16_t Port, uint16_t Value)
+    {
+        asm volatile ("OUTW %0, %1" : : "a"(Value), "Nd"(Port));
+    }
+
+    uint16_t InWord(uint16_t Port)
+    {
+        uint16_t ReturnValue;
+        asm volatile ("INW %1, %0" : "=a"(ReturnValue) : "Nd"(Port));
+        return ReturnValue;
+    }
+
     void Wait()
     {
         asm volatile("OUTB %%al, $0x80" : : "a"(0));
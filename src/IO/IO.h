@@ -8,5 +8,9 @@ namespace IO
 
     uint8_t InByte(uint16_t Port);
 
+    void OutWord(uint16_t Port, uint16_t Value);
+
+    uint16_t InWord(uint16_t Port);
+
     void Wait();
 }
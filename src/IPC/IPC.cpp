@@ -0,0 +1,190 @@
+#include "IPC.h"
+
+#include "Memory/Paging/PageAllocator.h"
+#include "ProcessHandler/ProcessHandler.h"
+#include "CPU/CPU.h"
+#include "STL/Handle/HandleTable.h"
+
+namespace IPC
+{
+    struct Buffer
+    {
+        STL::Channel* Address;
+        uint64_t PageAmount;
+    };
+
+    struct Waiter
+    {
+        uint64_t ProcessID;
+        volatile uint32_t* Address; //nullptr if the entry is free.
+        bool Woken;
+    };
+
+    STL::HandleTable<Buffer, IPC_CHANNEL_AMOUNT> Channels;
+
+    Waiter Waiters[IPC_WAITER_AMOUNT];
+
+    bool PendingWakes = false;
+
+    uint64_t CreateChannel(uint32_t MessageSize, uint32_t Capacity)
+    {
+        if (MessageSize == 0 || Capacity == 0 || (Capacity & (Capacity - 1)) != 0)
+        {
+            return 0;
+        }
+
+        Buffer New;
+        New.PageAmount = (STL::Channel::GetSize(MessageSize, Capacity) + 4095) / 4096;
+        New.Address = (STL::Channel*)PageAllocator::RequestPages(New.PageAmount);
+        if (New.Address == nullptr)
+        {
+            return 0;
+        }
+        New.Address->Init(MessageSize, Capacity);
+
+        uint64_t Handle = Channels.Insert(New);
+        if (Handle == 0)
+        {
+            PageAllocator::FreePages(New.Address, New.PageAmount);
+        }
+
+        return Handle;
+    }
+
+    STL::Channel* OpenChannel(uint64_t Handle)
+    {
+        if (!Channels.Acquire(Handle))
+        {
+            return nullptr;
+        }
+
+        return Channels.Get(Handle)->Address;
+    }
+
+    void CloseChannel(uint64_t Handle)
+    {
+        Buffer Old;
+        if (Channels.Release(Handle, &Old))
+        {
+            PageAllocator::FreePages(Old.Address, Old.PageAmount);
+        }
+    }
+
+    uint64_t GetChannelAmount()
+    {
+        return Channels.GetAmount();
+    }
+
+    /// <summary>
+    /// Registers a waiter, the caller has interrupts disabled.
+    /// </summary>
+    bool AddWaiter(uint64_t ProcessID, volatile uint32_t* Address, uint32_t Expected)
+    {
+        if (*Address != Expected)
+        {
+            return false;
+        }
+
+        Waiter* Free = nullptr;
+        for (uint64_t i = 0; i < IPC_WAITER_AMOUNT; i++)
+        {
+            if (Waiters[i].Address == Address && Waiters[i].ProcessID == ProcessID)
+            {
+                return true;
+            }
+            else if (Waiters[i].Address == nullptr && Free == nullptr)
+            {
+                Free = &Waiters[i];
+            }
+        }
+
+        if (Free == nullptr)
+        {
+            return false;
+        }
+
+        Free->ProcessID = ProcessID;
+        Free->Address = Address;
+        Free->Woken = false;
+        return true;
+    }
+
+    bool Wait(uint64_t ProcessID, volatile uint32_t* Address, uint32_t Expected)
+    {
+        //Procedures run from interrupts, a write and wake from one must not land between the check and the registration.
+        uint64_t Flags = CPU::DisableInterrupts();
+        bool Result = AddWaiter(ProcessID, Address, Expected);
+        CPU::RestoreInterrupts(Flags);
+
+        return Result;
+    }
+
+    uint64_t Wake(volatile uint32_t* Address)
+    {
+        uint64_t Flags = CPU::DisableInterrupts();
+
+        uint64_t Amount = 0;
+        for (uint64_t i = 0; i < IPC_WAITER_AMOUNT; i++)
+        {
+            if (Waiters[i].Address == Address && !Waiters[i].Woken)
+            {
+                Waiters[i].Woken = true;
+                Amount++;
+            }
+        }
+
+        PendingWakes |= Amount != 0;
+
+        CPU::RestoreInterrupts(Flags);
+        return Amount;
+    }
+
+    void RemoveWaiters(uint64_t ProcessID)
+    {
+        uint64_t Flags = CPU::DisableInterrupts();
+
+        for (uint64_t i = 0; i < IPC_WAITER_AMOUNT; i++)
+        {
+            if (Waiters[i].ProcessID == ProcessID)
+            {
+                Waiters[i].Address = nullptr;
+            }
+        }
+
+        CPU::RestoreInterrupts(Flags);
+    }
+
+    void DeliverWakes()
+    {
+        if (!PendingWakes)
+        {
+            return;
+        }
+        PendingWakes = false;
+
+        for (uint64_t i = 0; i < IPC_WAITER_AMOUNT; i++)
+        {
+            //Only the entry is taken with interrupts disabled, the message is sent with them enabled again.
+            uint64_t Flags = CPU::DisableInterrupts();
+
+            if (Waiters[i].Address == nullptr || !Waiters[i].Woken)
+            {
+                CPU::RestoreInterrupts(Flags);
+                continue;
+            }
+
+            //Freed first, so the process can wait again while handling the message.
+            volatile uint32_t* Address = Waiters[i].Address;
+            uint64_t ProcessID = Waiters[i].ProcessID;
+            Waiters[i].Address = nullptr;
+
+            CPU::RestoreInterrupts(Flags);
+
+            Process* Target = ProcessHandler::GetProcess(ProcessID);
+            if (Target != nullptr)
+            {
+                Target->SendMessage(STL::PROM::WAKE, (STL::PROI)Address);
+            }
+        }
+    }
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "STL/IPC/Channel.h"
+
+#define IPC_CHANNEL_AMOUNT 64
+#define IPC_WAITER_AMOUNT 64
+
+/// <summary>
+/// Channels between processes and the futex like waits a side of a channel blocks with.
+/// Processes do not block, a wait is a request for a WAKE message that is delivered by the process loop.
+/// </summary>
+namespace IPC
+{
+    /// <summary>
+    /// Creates a channel in physically contiguous pages with one reference, returns 0 if the sizes are invalid or out of memory.
+    /// </summary>
+    uint64_t CreateChannel(uint32_t MessageSize, uint32_t Capacity);
+
+    /// <summary>
+    /// Takes a reference to a channel and returns it, or nullptr if the handle is no longer valid.
+    /// </summary>
+    STL::Channel* OpenChannel(uint64_t Handle);
+
+    /// <summary>
+    /// Drops a reference, the channel is freed with the last one.
+    /// </summary>
+    void CloseChannel(uint64_t Handle);
+
+    uint64_t GetChannelAmount();
+
+    /// <summary>
+    /// Registers the process to be woken through Address, returns false if Address does not hold Expected or there is no room.
+    /// Checking the value and registering can not be interrupted by a wake, so a wake after the value changed is never lost.
+    /// </summary>
+    bool Wait(uint64_t ProcessID, volatile uint32_t* Address, uint32_t Expected);
+
+    /// <summary>
+    /// Marks every process waiting on Address as woken and returns how many there were.
+    /// </summary>
+    uint64_t Wake(volatile uint32_t* Address);
+
+    /// <summary>
+    /// Forgets the waits of a process that is being destroyed.
+    /// </summary>
+    void RemoveWaiters(uint64_t ProcessID);
+
+    /// <summary>
+    /// Sends the WAKE messages of the processes woken since the last call, called by the process loop.
+    /// </summary>
+    void DeliverWakes();
+}
@@ -8,11 +8,49 @@
 #include "Input/Mouse.h"
 #include "PIT/PIT.h"
 #include "ProcessHandler/ProcessHandler.h"
+#include "Serial/Serial.h"
+#include "Profiling/Profiler.h"
+#include "Log/Log.h"
+#include "Memory/GDT/GDT.h"
+#include "CPU/CPU.h"
+#include "Syscall/Syscall.h"
+#include "ELF/ELF.h"
+#include "SharedPage/SharedPage.h"
+
+#define PAGE_FAULT_PRESENT (1 << 0)
 
 namespace InteruptHandlers
 {        
+    /// <summary>
+    /// If the fault happened in ring 3, changes the frame so the handler returns to UserAbort instead and returns true.
+    /// With UserMemory set a fault in a syscall made from ring 3 is also the fault of the user code, which passed the memory.
+    /// </summary>
+    bool AbortUser(InterruptFrame* frame, const char* Message, bool UserMemory = false)
+    {
+        bool InUserCall = UserMemory && (frame->CodeSegment & 3) == 0 && Syscall::GetCPU()->InUserCall;
+        if ((frame->CodeSegment & 3) != 3 && !InUserCall)
+        {
+            return false;
+        }
+
+        Log::Warning(Message);
+
+        Syscall::GetCPU()->InUserCall = false;
+        frame->InstructionPointer = InUserCall ? (uint64_t)UserCallAbort : (uint64_t)UserAbort;
+        frame->CodeSegment = GDT_KERNEL_CODE;
+        frame->Flags = 0x2;
+        frame->StackPointer = Syscall::GetCPU()->ReturnStack;
+        frame->StackSegment = GDT_KERNEL_DATA;
+        return true;
+    }
+
     __attribute__((interrupt)) void DivideByZero(InterruptFrame* frame)
     {
+        if (AbortUser(frame, "Division By Zero Detected in user code"))
+        {
+            return;
+        }
+
         Debug::Error("Division By Zero Detected");
         while(true)
         {
@@ -58,6 +96,11 @@ namespace InteruptHandlers
 
     __attribute__((interrupt)) void InvalidOP(InterruptFrame* frame)
     {
+        if (AbortUser(frame, "Invalid OP Code Detected in user code"))
+        {
+            return;
+        }
+
         Debug::Error("Invalid OP Code Detected");
         while(true)
         {
@@ -110,8 +153,13 @@ namespace InteruptHandlers
         }
     }
 
-    __attribute__((interrupt)) void GeneralProtectionFault(InterruptFrame* frame)
+    __attribute__((interrupt)) void GeneralProtectionFault(InterruptFrame* frame, uint64_t ErrorCode)
     {
+        if (AbortUser(frame, "General Protection Fault in user code"))
+        {
+            return;
+        }
+
         Debug::Error("General Protection Fault");
         while(true)
         {
@@ -119,8 +167,33 @@ namespace InteruptHandlers
         }
     }
 
-    __attribute__((interrupt)) void PageFault(InterruptFrame* frame)
+    __attribute__((interrupt)) void PageFault(InterruptFrame* frame, uint64_t ErrorCode)
     {
+        uint64_t Address;
+        asm volatile ("MOV %%CR2, %0" : "=r"(Address));
+
+        bool UserAddress = AddressSpace::IsUser((void*)Address);
+
+        //Pages of user programs are filled in on first touch, by the program or by a syscall reading its memory.
+        if (!(ErrorCode & PAGE_FAULT_PRESENT) && UserAddress)
+        {
+            //The handler calls code that may use SSE.
+            __attribute__((aligned(64))) uint8_t FPUState[CPU_FPU_STATE_SIZE];
+            CPU::SaveFPU(FPUState);
+            bool Handled = ELF::HandlePageFault(Address);
+            CPU::RestoreFPU(FPUState);
+
+            if (Handled)
+            {
+                return;
+            }
+        }
+
+        if (AbortUser(frame, "Page Fault in user code", UserAddress))
+        {
+            return;
+        }
+
         Debug::Error("Page Fault");
         while(true)
         {
@@ -141,8 +214,20 @@ namespace InteruptHandlers
     {
         static uint64_t OldRTCTick = 0;
 
+        //Saves what the IRQ interrupted, user code or a kernel using SIMD. Handlers nest once user code or a syscall runs with interrupts enabled, so each frame keeps its own area.
+        __attribute__((aligned(64))) uint8_t FPUState[CPU_FPU_STATE_SIZE];
+        CPU::SaveFPU(FPUState);
+
         PIT::Tick();
 
+        Profiler::Sample(frame->InstructionPointer);
+
+        //Only ring 3 is interrupted, a program stuck in a syscall is caught on a later tick.
+        if (ELF::IsOverdue())
+        {
+            AbortUser(frame, "Program ran out of time");
+        }
+
         /// If multiple of one second update time and date.
         if (PIT::Ticks >= OldRTCTick + 100)
         {
@@ -150,9 +235,13 @@ namespace InteruptHandlers
             OldRTCTick = PIT::Ticks;
         }
 
+        SharedPage::Tick();
+
         /// Notify processes of interupt.
         ProcessHandler::PITInterupt();
 
+        CPU::RestoreFPU(FPUState);
+
         IO::OutByte(PIC1_COMMAND, PIC_EOI);
     }
 
@@ -160,6 +249,9 @@ namespace InteruptHandlers
     {        
         uint8_t ScanCode = IO::InByte(0x60);
 
+        __attribute__((aligned(64))) uint8_t FPUState[CPU_FPU_STATE_SIZE];
+        CPU::SaveFPU(FPUState);
+
         KeyBoard::HandleScanCode(ScanCode);
 
         if (!(ScanCode & (0b10000000))) //If key was pressed down
@@ -167,6 +259,8 @@ namespace InteruptHandlers
             ProcessHandler::KeyBoardInterupt();
         }
 
+        CPU::RestoreFPU(FPUState);
+
         /// Notify processes of interupt.
         IO::OutByte(PIC1_COMMAND, PIC_EOI);
     }
@@ -201,10 +295,15 @@ namespace InteruptHandlers
             MousePacket[2] = MouseData;
             MouseCycle = 0;
             
+            __attribute__((aligned(64))) uint8_t FPUState[CPU_FPU_STATE_SIZE];
+            CPU::SaveFPU(FPUState);
+
             Mouse::HandleMousePacket(MousePacket);
             
             /// Notify processes of interupt.
             ProcessHandler::MouseInterupt();
+
+            CPU::RestoreFPU(FPUState);
         }
         break;
         }
@@ -212,4 +311,14 @@ namespace InteruptHandlers
         IO::OutByte(PIC2_COMMAND, PIC_EOI);
         IO::OutByte(PIC1_COMMAND, PIC_EOI);
     }    
+
+    __attribute__((interrupt)) void Serial(InterruptFrame* frame)
+    {
+        __attribute__((aligned(64))) uint8_t FPUState[CPU_FPU_STATE_SIZE];
+        CPU::SaveFPU(FPUState);
+        Serial::HandleInterrupt();
+        CPU::RestoreFPU(FPUState);
+
+        IO::OutByte(PIC1_COMMAND, PIC_EOI);
+    }
 }
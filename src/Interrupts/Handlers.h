@@ -1,11 +1,23 @@
 #pragma once
 
+#include <stdint.h>
+
 namespace InteruptHandlers
 {
-    struct InterruptFrame;
+    /// <summary>
+    /// The frame pushed by the cpu when an interrupt is taken.
+    /// </summary>
+    struct InterruptFrame
+    {
+        uint64_t InstructionPointer;
+        uint64_t CodeSegment;
+        uint64_t Flags;
+        uint64_t StackPointer;
+        uint64_t StackSegment;
+    };
 
     /// <summary>
-    /// Exception interrupt handlers.
+    /// Exception interrupt handlers, faults caused by user code only abandon that code.
     /// </summary>
 
     __attribute__((interrupt)) void DivideByZero(InterruptFrame* frame);
@@ -30,9 +42,9 @@ namespace InteruptHandlers
 
     __attribute__((interrupt)) void StackSegmentFault(InterruptFrame* frame);
 
-    __attribute__((interrupt)) void GeneralProtectionFault(InterruptFrame* frame);
+    __attribute__((interrupt)) void GeneralProtectionFault(InterruptFrame* frame, uint64_t ErrorCode);
 
-    __attribute__((interrupt)) void PageFault(InterruptFrame* frame);
+    __attribute__((interrupt)) void PageFault(InterruptFrame* frame, uint64_t ErrorCode);
 
     __attribute__((interrupt)) void FloatingPoint(InterruptFrame* frame);
 
@@ -45,4 +57,6 @@ namespace InteruptHandlers
     __attribute__((interrupt)) void Keyboard(InterruptFrame* frame);
 
     __attribute__((interrupt)) void Mouse(InterruptFrame* frame);
+
+    __attribute__((interrupt)) void Serial(InterruptFrame* frame);
 }
@@ -2,6 +2,7 @@
 #include "Handlers.h"
 #include "IO/IO.h"
 #include "Input/Mouse.h"
+#include "Serial/Serial.h"
 #include "Memory/Paging/PageAllocator.h"
 
 namespace IDT
@@ -32,7 +33,7 @@ namespace IDT
 
     void EnableInterrupts()
     {
-        IO::OutByte(PIC1_DATA, 0b11111000);
+        IO::OutByte(PIC1_DATA, 0b11101000);
         IO::OutByte(PIC2_DATA, 0b11101111);
     }
 
@@ -67,6 +68,7 @@ namespace IDT
 
         idtr.SetHandler(0x20, (uint64_t)InteruptHandlers::PIT);
         idtr.SetHandler(0x21, (uint64_t)InteruptHandlers::Keyboard);
+        idtr.SetHandler(0x24, (uint64_t)InteruptHandlers::Serial);
         idtr.SetHandler(0x2C, (uint64_t)InteruptHandlers::Mouse);
 
         asm("LIDT %0" : : "m" (idtr));
@@ -106,5 +108,7 @@ namespace IDT
         EnableInterrupts();
 
         asm ("sti");
+
+        Serial::EnableInterrupts();
     }
 }
@@ -0,0 +1,331 @@
+#include "Log.h"
+
+#include "STL/String/cstr.h"
+#include "STL/Memory/Memory.h"
+
+#include "TSC/TSC.h"
+#include "Serial/Serial.h"
+
+#define LOG_LINE_SIZE (LOG_MESSAGE_SIZE + 32)
+#define LOG_DUMP_AMOUNT 64
+
+namespace Log
+{
+    uint8_t MinimumLevel = (uint8_t)Level::Debug;
+
+    Record Records[LOG_RECORD_AMOUNT];
+
+    /// <summary>
+    /// The total amount of records ever reserved, the next record is written at Head % LOG_RECORD_AMOUNT.
+    /// </summary>
+    volatile uint64_t Head = 0;
+
+    /// <summary>
+    /// Serial consumer state.
+    /// </summary>
+    uint64_t SerialTail = 0;
+    char SerialLine[LOG_LINE_SIZE];
+    uint64_t SerialLineLength = 0;
+    uint64_t SerialLinePosition = 0;
+    uint64_t Dropped = 0;
+
+    char Dump[LOG_DUMP_AMOUNT * (LOG_LINE_SIZE + 16) + 128];
+
+    enum class ReadResult
+    {
+        Ok,
+        Pending,
+        Overwritten
+    };
+
+    void Append(Level Severity, uint64_t TSC, const char* Line, uint64_t Length)
+    {
+        uint64_t Index = __atomic_fetch_add(&Head, 1, __ATOMIC_RELAXED);
+        Record& Entry = Records[Index % LOG_RECORD_AMOUNT];
+
+        //Readers must see the record as incomplete before any of its contents change.
+        __atomic_store_n(&Entry.Sequence, 0, __ATOMIC_RELAXED);
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+
+        uint8_t EntryLength = 0;
+        for (uint64_t i = 0; i < Length; i++)
+        {
+            if (Line[i] != '\r')
+            {
+                Entry.Message[EntryLength++] = Line[i];
+            }
+        }
+        Entry.Length = EntryLength;
+        Entry.Severity = Severity;
+        Entry.TSC = TSC;
+
+        __atomic_store_n(&Entry.Sequence, Index + 1, __ATOMIC_RELEASE);
+    }
+
+    ReadResult ReadRecord(uint64_t Index, Record& Copy)
+    {
+        if (Head - Index > LOG_RECORD_AMOUNT)
+        {
+            return ReadResult::Overwritten;
+        }
+
+        Record& Entry = Records[Index % LOG_RECORD_AMOUNT];
+        if (__atomic_load_n(&Entry.Sequence, __ATOMIC_ACQUIRE) != Index + 1)
+        {
+            return Head - Index > LOG_RECORD_AMOUNT ? ReadResult::Overwritten : ReadResult::Pending;
+        }
+
+        Copy.TSC = Entry.TSC;
+        Copy.Severity = Entry.Severity;
+        Copy.Length = Entry.Length;
+        STL::CopyMemory(Entry.Message, Copy.Message, Copy.Length);
+
+        //If a writer lapped the ring while copying the copy is torn.
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (Entry.Sequence != Index + 1)
+        {
+            return ReadResult::Overwritten;
+        }
+
+        Copy.Sequence = Index + 1;
+        return ReadResult::Ok;
+    }
+
+    char* WriteNumber(char* Dest, uint64_t Number, uint64_t MinDigits)
+    {
+        char Digits[20];
+        uint64_t DigitAmount = 0;
+        do
+        {
+            Digits[DigitAmount++] = '0' + Number % 10;
+            Number /= 10;
+        }
+        while (Number != 0);
+
+        while (MinDigits > DigitAmount)
+        {
+            *Dest++ = ' ';
+            MinDigits--;
+        }
+        while (DigitAmount > 0)
+        {
+            *Dest++ = Digits[--DigitAmount];
+        }
+
+        return Dest;
+    }
+
+    /// <summary>
+    /// Formats a record as "[seconds.microseconds] LEVEL message" without a line ending.
+    /// </summary>
+    char* FormatRecord(char* Dest, Record& Entry)
+    {
+        uint64_t Microseconds = TSC::ToMicroseconds(Entry.TSC);
+        uint64_t Fraction = Microseconds % 1000000;
+
+        *Dest++ = '[';
+        Dest = WriteNumber(Dest, Microseconds / 1000000, 5);
+        *Dest++ = '.';
+        for (uint64_t Divisor = 100000; Divisor > 0; Divisor /= 10)
+        {
+            *Dest++ = '0' + (Fraction / Divisor) % 10;
+        }
+        *Dest++ = ']';
+        *Dest++ = ' ';
+
+        const char* Name = LevelToString(Entry.Severity);
+        for (uint64_t i = 0; i < 6; i++)
+        {
+            *Dest++ = *Name != 0 ? *Name++ : ' ';
+        }
+
+        STL::CopyMemory(Entry.Message, Dest, Entry.Length);
+        return Dest + Entry.Length;
+    }
+
+    void Write(Level Severity, const char* Message)
+    {
+        if ((uint8_t)Severity < MinimumLevel || Message == nullptr)
+        {
+            return;
+        }
+
+        uint64_t TSC = TSC::Read();
+
+        const char* Line = Message;
+        while (*Line != 0)
+        {
+            while (*Line == '\r')
+            {
+                Line++;
+            }
+
+            uint64_t Length = 0;
+            while (Line[Length] != 0 && Line[Length] != '\n' && Length < LOG_MESSAGE_SIZE)
+            {
+                Length++;
+            }
+
+            if (Length > 0)
+            {
+                Append(Severity, TSC, Line, Length);
+            }
+
+            Line += Length;
+            if (*Line == '\n')
+            {
+                Line++;
+            }
+        }
+
+        Serial::Kick();
+    }
+
+    void Debug(const char* Message)
+    {
+        Write(Level::Debug, Message);
+    }
+
+    void Info(const char* Message)
+    {
+        Write(Level::Info, Message);
+    }
+
+    void Warning(const char* Message)
+    {
+        Write(Level::Warning, Message);
+    }
+
+    void Error(const char* Message)
+    {
+        Write(Level::Error, Message);
+    }
+
+    bool NextSerialByte(char& Chr)
+    {
+        while (SerialLinePosition >= SerialLineLength)
+        {
+            if (SerialTail == Head)
+            {
+                return false;
+            }
+
+            Record Entry;
+            switch (ReadRecord(SerialTail, Entry))
+            {
+            case ReadResult::Ok:
+            {
+                char* End = FormatRecord(SerialLine, Entry);
+                *End++ = '\r';
+                *End++ = '\n';
+                SerialLineLength = End - SerialLine;
+                SerialLinePosition = 0;
+                SerialTail++;
+            }
+            break;
+            case ReadResult::Pending:
+            {
+                //The writer of this record will kick the serial port again once it is done.
+                return false;
+            }
+            break;
+            case ReadResult::Overwritten:
+            {
+                uint64_t Oldest = Head - LOG_RECORD_AMOUNT;
+                Oldest = Oldest > SerialTail ? Oldest : SerialTail + 1;
+                Dropped += Oldest - SerialTail;
+                SerialTail = Oldest;
+            }
+            break;
+            }
+        }
+
+        Chr = SerialLine[SerialLinePosition++];
+        return true;
+    }
+
+    void Flush()
+    {
+        char Chr;
+        while (NextSerialByte(Chr))
+        {
+            Serial::Write(Chr);
+        }
+    }
+
+    const char* GetDump()
+    {
+        char* CurrentLocation = Dump;
+
+        uint64_t End = Head;
+        uint64_t Start = End > LOG_DUMP_AMOUNT ? End - LOG_DUMP_AMOUNT : 0;
+
+        for (uint64_t i = Start; i < End; i++)
+        {
+            Record Entry;
+            if (ReadRecord(i, Entry) != ReadResult::Ok)
+            {
+                continue;
+            }
+
+            switch (Entry.Severity)
+            {
+            case Level::Debug:
+            {
+                CurrentLocation = STL::CopyString(CurrentLocation, FOREGROUND_COLOR(150, 150, 150)) + 1;
+            }
+            break;
+            case Level::Warning:
+            {
+                CurrentLocation = STL::CopyString(CurrentLocation, FOREGROUND_COLOR(229, 192, 123)) + 1;
+            }
+            break;
+            case Level::Error:
+            {
+                CurrentLocation = STL::CopyString(CurrentLocation, FOREGROUND_COLOR(224, 108, 117)) + 1;
+            }
+            break;
+            default:
+            {
+                CurrentLocation = STL::CopyString(CurrentLocation, FOREGROUND_COLOR(255, 255, 255)) + 1;
+            }
+            break;
+            }
+
+            CurrentLocation = FormatRecord(CurrentLocation, Entry);
+            CurrentLocation = STL::CopyString(CurrentLocation, NEWLINE) + 1;
+        }
+
+        CurrentLocation = STL::CopyString(CurrentLocation, FOREGROUND_COLOR(255, 255, 255)) + 1;
+        if (Dropped != 0)
+        {
+            CurrentLocation = STL::CopyString(CurrentLocation, "Records dropped before reaching serial: ") + 1;
+            CurrentLocation = WriteNumber(CurrentLocation, Dropped, 0);
+        }
+
+        *CurrentLocation = 0;
+        return Dump;
+    }
+
+    uint64_t GetDroppedAmount()
+    {
+        return Dropped;
+    }
+
+    const char* LevelToString(Level Severity)
+    {
+        switch (Severity)
+        {
+        case Level::Debug:
+            return "DEBUG";
+        case Level::Info:
+            return "INFO";
+        case Level::Warning:
+            return "WARN";
+        case Level::Error:
+            return "ERROR";
+        }
+
+        return "?";
+    }
+}
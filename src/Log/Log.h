@@ -0,0 +1,72 @@
+#pragma once
+
+#include <stdint.h>
+
+#define LOG_RECORD_AMOUNT 512 //Must be a power of two.
+#define LOG_MESSAGE_SIZE 104
+
+namespace Log
+{
+    enum class Level : uint8_t
+    {
+        Debug,
+        Info,
+        Warning,
+        Error
+    };
+
+    /// <summary>
+    /// A single line in the kernel log.
+    /// Sequence is the records position in the log plus one, it is zero while the record is being written.
+    /// </summary>
+    struct Record
+    {
+        volatile uint64_t Sequence;
+        uint64_t TSC;
+        Level Severity;
+        uint8_t Length;
+        char Message[LOG_MESSAGE_SIZE];
+    };
+
+    /// <summary>
+    /// Messages below this level are discarded.
+    /// </summary>
+    extern uint8_t MinimumLevel;
+
+    /// <summary>
+    /// Appends the message to the log ring, one record per line. Never blocks and is safe to call from interrupts.
+    /// When the ring is full the oldest records are overwritten.
+    /// </summary>
+    void Write(Level Severity, const char* Message);
+
+    void Debug(const char* Message);
+
+    void Info(const char* Message);
+
+    void Warning(const char* Message);
+
+    void Error(const char* Message);
+
+    /// <summary>
+    /// Gets the next byte of formatted log output that has not yet been sent to the serial port.
+    /// Must only be called by a single consumer at a time, normally the serial interrupt.
+    /// </summary>
+    bool NextSerialByte(char& Chr);
+
+    /// <summary>
+    /// Writes all pending log output to the serial port by polling, used when interrupts are unavailable.
+    /// </summary>
+    void Flush();
+
+    /// <summary>
+    /// Returns the log records still in the ring as text.
+    /// </summary>
+    const char* GetDump();
+
+    /// <summary>
+    /// Returns the amount of records that were overwritten before the serial port could send them.
+    /// </summary>
+    uint64_t GetDroppedAmount();
+
+    const char* LevelToString(Level Severity);
+}
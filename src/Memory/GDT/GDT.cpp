@@ -6,14 +6,27 @@ GDT DefaultGDT = {
     {0, 0, 0, 0x9A, 0xA0, 0}, //KernelCode
     {0, 0, 0, 0x92, 0xA0, 0}, //KernelData
     {0, 0, 0, 0x00, 0x00, 0}, //UserNull
-    {0, 0, 0, 0x9A, 0xA0, 0}, //UserCode
-    {0, 0, 0, 0x92, 0xA0, 0}, //UserData
+    {0, 0, 0, 0xF2, 0xA0, 0}, //UserData
+    {0, 0, 0, 0xFA, 0xA0, 0}, //UserCode
+    {{0, 0, 0, 0x89, 0x00, 0}, 0, 0}, //TSS
 };
 
+TSS DefaultTSS;
+
 void InitGDT()
 {
+    uint64_t Base = (uint64_t)&DefaultTSS;
+    DefaultTSS.IOMapBase = sizeof(TSS); //No IO permission bitmap.
+    DefaultGDT.TSS.Low.Limit0 = sizeof(TSS) - 1;
+    DefaultGDT.TSS.Low.Base0 = Base & 0xFFFF;
+    DefaultGDT.TSS.Low.Base1 = (Base >> 16) & 0xFF;
+    DefaultGDT.TSS.Low.Base2 = (Base >> 24) & 0xFF;
+    DefaultGDT.TSS.Base3 = Base >> 32;
+
     static GDTDesc GDTDescriptor;
 	GDTDescriptor.Size = sizeof(GDT) - 1;
 	GDTDescriptor.Offset = (uint64_t)&DefaultGDT;
 	LoadGDT(&GDTDescriptor);
-}
\ No newline at end of file
+
+    asm volatile ("LTR %0" : : "r"((uint16_t)GDT_TSS));
+}
@@ -2,6 +2,13 @@
 
 #include <stdint.h>
 
+#define GDT_KERNEL_CODE 0x08
+#define GDT_KERNEL_DATA 0x10
+#define GDT_USER_BASE 0x18
+#define GDT_USER_DATA (0x20 | 3)
+#define GDT_USER_CODE (0x28 | 3)
+#define GDT_TSS 0x30
+
 struct GDTDesc
 {
     uint16_t Size;
@@ -18,21 +25,51 @@ struct GDTEntry
     uint8_t Base2;
 }__attribute__((packed));
 
+/// <summary>
+/// A 16 byte system segment descriptor, the base of a 64 bit TSS does not fit in a normal entry.
+/// </summary>
+struct GDTSystemEntry
+{
+    GDTEntry Low;
+    uint32_t Base3;
+    uint32_t Reserved;
+}__attribute__((packed));
+
+/// <summary>
+/// The stacks the cpu switches to when an interrupt is taken in ring 3.
+/// </summary>
+struct TSS
+{
+    uint32_t Reserved0;
+    uint64_t RSP[3];
+    uint64_t Reserved1;
+    uint64_t IST[7];
+    uint64_t Reserved2;
+    uint16_t Reserved3;
+    uint16_t IOMapBase;
+}__attribute__((packed));
+
 struct GDT
 {
     GDTEntry Null;
     GDTEntry KernelCode;
     GDTEntry KernelData;
     GDTEntry UserNull;
+    GDTEntry UserData; //SYSRET expects the user data segment directly below the user code segment.
     GDTEntry UserCode;
-    GDTEntry UserData;
+    GDTSystemEntry TSS;
 }__attribute__((packed)) __attribute__((aligned(0x1000)));
 
 extern GDT DefaultGDT;
 
+extern TSS DefaultTSS;
+
 /// <summary>
 /// Found in GDT.asm
 /// </summary>
 extern "C" void LoadGDT(GDTDesc* GDTDescriptor);
 
-void InitGDT();
\ No newline at end of file
+/// <summary>
+/// Loads the GDT and the TSS, the kernel stack of the TSS is set by Syscall::Init.
+/// </summary>
+void InitGDT();
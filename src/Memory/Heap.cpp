@@ -2,11 +2,53 @@
 
 #include "Memory/Paging/PageAllocator.h"
 #include "Memory/Paging/PageTable.h"
+#include "Log/Log.h"
 
 namespace Heap
 {
     Segment* FirstSegment = nullptr;
-    Segment* LastSegment = nullptr;
+
+    /// <summary>
+    /// The first virtual address after the mapped heap pages, always page aligned.
+    /// </summary>
+    uint64_t HeapEnd = HEAP_START;
+
+    bool Trace = false;
+
+    void TraceOperation(char Operation, void* Address, uint64_t Size)
+    {
+        char Line[64] = "heap ";
+        char* CurrentLocation = Line + 5;
+
+        auto WriteNumber = [&](uint64_t Number, uint64_t Base)
+        {
+            char Digits[20];
+            uint64_t DigitAmount = 0;
+            do
+            {
+                Digits[DigitAmount++] = "0123456789abcdef"[Number % Base];
+                Number /= Base;
+            }
+            while (Number != 0);
+
+            while (DigitAmount > 0)
+            {
+                *CurrentLocation++ = Digits[--DigitAmount];
+            }
+        };
+
+        *CurrentLocation++ = Operation;
+        *CurrentLocation++ = ' ';
+        if (Operation == 'A')
+        {
+            WriteNumber(Size, 10);
+            *CurrentLocation++ = ' ';
+        }
+        WriteNumber((uint64_t)Address, 16);
+        *CurrentLocation = 0;
+
+        Log::Debug(Line);
+    }
 
     void* Segment::GetStart()
     {
@@ -20,20 +62,21 @@ namespace Heap
 
     void Segment::Split(uint64_t NewSize)
     {
-        uint64_t SplitSize = this->Size - NewSize - sizeof(Segment);
-
-        if (this->Size < 64 || SplitSize < 4096)
+        //Checked before subtracting, a remainder smaller than a header would wrap around.
+        if (this->Size < NewSize + sizeof(Segment) + 4096)
         {
             return; 
         }
 
+        uint64_t SplitSize = this->Size - NewSize - sizeof(Segment);
+
         Segment* NewSegment = (Segment*)((uint64_t)this->GetStart() + NewSize);
         NewSegment->Next = this->Next;
         NewSegment->Size = SplitSize;
         NewSegment->Free = true;
 
         this->Next = NewSegment;
-        this->Size = NewSize - sizeof(Segment);
+        this->Size = NewSize;
     }
 
     Segment* GetFirstSegment()
@@ -44,18 +87,8 @@ namespace Heap
     void Init()
     {
         FirstSegment = (Segment*)HEAP_START;
-        void* Address = FirstSegment;
-        for (uint64_t i = 0; i < (HEAP_STARTSIZE + sizeof(Segment)) / 4096 + 1; i++)
-        {
-            PageTableManager::MapAddress(Address, PageAllocator::RequestPage());
-            Address = (void*)((uint64_t)Address + 4096);
-        }
-
-        FirstSegment->Size = HEAP_STARTSIZE;
-        FirstSegment->Next = nullptr;
-        FirstSegment->Free = true;
-        
-        LastSegment = FirstSegment;
+        HeapEnd = HEAP_START;
+        Reserve(HEAP_STARTSIZE);
     }
 
     uint64_t GetUsedSize()
@@ -121,15 +154,8 @@ namespace Heap
         return SegmentAmount;
     }
 
-    void* Allocate(uint64_t Size)
+    void* FindSegment(uint64_t Size)
     {
-        if (Size == 0)
-        {
-            return nullptr;
-        }
-
-        Size = Size + (64 - (Size % 64));
-
         Segment* CurrentSegment = FirstSegment;
         while (true)
         {
@@ -156,11 +182,33 @@ namespace Heap
         }
 
         Reserve(Size);
-        return Allocate(Size);
+        return FindSegment(Size);
+    }
+
+    void* Allocate(uint64_t Size)
+    {
+        if (Size == 0)
+        {
+            return nullptr;
+        }
+
+        void* Address = FindSegment(Size + (64 - (Size % 64)));
+
+        if (Trace)
+        {
+            TraceOperation('A', Address, Size);
+        }
+
+        return Address;
     }
 
     void Free(void* Address)
     {
+        if (Trace)
+        {
+            TraceOperation('F', Address, 0);
+        }
+
         Segment* segment = (Segment*)((uint64_t)Address - sizeof(Segment));
         segment->Free = true;
 
@@ -174,8 +222,13 @@ namespace Heap
 
             if (CurrentSegment->Free && CurrentSegment->Next->Free)
             {
-                CurrentSegment->Size += CurrentSegment->Next->Size + sizeof(Segment);
-                CurrentSegment->Next = CurrentSegment->Next->Next;
+                //Only neighbours in memory can be merged.
+                if (CurrentSegment->GetEnd() == (void*)CurrentSegment->Next)
+                {
+                    CurrentSegment->Size += CurrentSegment->Next->Size + sizeof(Segment);
+                    CurrentSegment->Next = CurrentSegment->Next->Next;
+                    continue;
+                }
             }
 
             CurrentSegment = CurrentSegment->Next;
@@ -184,22 +237,31 @@ namespace Heap
 
     void Reserve(uint64_t Size)
     {   
-        Size = Size + (4096 - (Size % 4096));
-        Segment* NewSegment = (Segment*)LastSegment->GetEnd();
+        //New segments always start on a fresh page so a page holding live data is never mapped again.
+        Segment* NewSegment = (Segment*)HeapEnd;
+        uint64_t End = HeapEnd + Size + sizeof(Segment);
+        End = (End + 4095) & ~(uint64_t)4095;
 
-        void* Address = NewSegment;
-        for (uint64_t i = 0; i < (Size + sizeof(Segment)) / 4096 + 1; i++)
+        while (HeapEnd < End)
         {
-            PageTableManager::MapAddress(Address, PageAllocator::RequestPage());
-            Address = (void*)((uint64_t)Address + 4096);
+            PageTableManager::MapAddress((void*)HeapEnd, PageAllocator::RequestPage());
+            HeapEnd += 4096;
         }
 
-        NewSegment->Size = Size;
+        NewSegment->Size = HeapEnd - (uint64_t)NewSegment->GetStart();
         NewSegment->Next = nullptr;
         NewSegment->Free = true;
 
+        if (NewSegment == FirstSegment)
+        {
+            return;
+        }
+
+        Segment* LastSegment = FirstSegment;
+        while (LastSegment->Next != nullptr)
+        {
+            LastSegment = LastSegment->Next;
+        }
         LastSegment->Next = NewSegment;
-        
-        LastSegment = NewSegment;
     }
-}
\ No newline at end of file
+}
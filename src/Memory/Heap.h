@@ -7,6 +7,12 @@
 
 namespace Heap
 {
+    /// <summary>
+    /// When set every allocation and free is written to the kernel log as "heap A [SIZE] [ADDRESS]" or "heap F [ADDRESS]",
+    /// the host replay tool reads this format.
+    /// </summary>
+    extern bool Trace;
+
     struct Segment
     {
         Segment* Next;
@@ -0,0 +1,235 @@
+#include "AddressSpace.h"
+#include "PageAllocator.h"
+
+#include "STL/Memory/Memory.h"
+#include "CPU/CPU.h"
+#include "Memory/Heap.h"
+
+#define CR0_WP (1 << 16)
+#define CR4_PCIDE (1 << 17)
+#define CR3_NO_FLUSH (1ull << 63)
+#define INVPCID_SINGLE_CONTEXT 1
+
+namespace AddressSpace
+{
+    uint64_t UsedPCIDs[ADDRESS_SPACE_PCID_AMOUNT / 64];
+
+    /// <summary>
+    /// PCIDs of destroyed spaces whose TLB entries could not be invalidated without INVPCID.
+    /// </summary>
+    uint64_t StalePCIDs[ADDRESS_SPACE_PCID_AMOUNT / 64];
+
+    uint64_t NextPCID = 1;
+
+    bool PCIDEnabled = false;
+
+    Space* Current = nullptr;
+
+    void Init()
+    {
+        UsedPCIDs[0] = 1; //PCID 0 belongs to the kernel.
+
+        //Read only user pages, like shared segments and the system page, have to stay read only for syscalls writing user memory.
+        uint64_t CR0;
+        asm volatile ("MOV %%CR0, %0" : "=r"(CR0));
+        CR0 |= CR0_WP;
+        asm volatile ("MOV %0, %%CR0" : : "r"(CR0));
+
+        if (!CPU::HasPCID())
+        {
+            return;
+        }
+
+        //The kernel page tables are page aligned and use PCID 0, as required to set PCIDE.
+        uint64_t CR4;
+        asm volatile ("MOV %%CR4, %0" : "=r"(CR4));
+        CR4 |= CR4_PCIDE;
+        asm volatile ("MOV %0, %%CR4" : : "r"(CR4));
+
+        PCIDEnabled = true;
+    }
+
+    /// <summary>
+    /// Returns a free PCID, or 0 if there is none. Goes round the PCIDs so a freed one is reused as late as possible.
+    /// </summary>
+    uint16_t AllocatePCID()
+    {
+        for (uint64_t i = 0; i < ADDRESS_SPACE_PCID_AMOUNT; i++)
+        {
+            uint64_t PCID = (NextPCID + i) % ADDRESS_SPACE_PCID_AMOUNT;
+            if (!(UsedPCIDs[PCID / 64] & (1ull << (PCID % 64))))
+            {
+                UsedPCIDs[PCID / 64] |= 1ull << (PCID % 64);
+                NextPCID = PCID + 1;
+                return PCID;
+            }
+        }
+
+        return 0;
+    }
+
+    bool IsUser(void* VirtualAddress)
+    {
+        return (uint64_t)VirtualAddress >= USER_SPACE_START && (uint64_t)VirtualAddress < USER_SPACE_END;
+    }
+
+    bool IsUser(void* VirtualAddress, uint64_t Size)
+    {
+        return IsUser(VirtualAddress) && Size <= USER_SPACE_END - (uint64_t)VirtualAddress;
+    }
+
+    Space* Create()
+    {
+        uint16_t PCID = 0;
+        if (PCIDEnabled)
+        {
+            PCID = AllocatePCID();
+            if (PCID == 0)
+            {
+                return nullptr;
+            }
+        }
+
+        Space* NewSpace = (Space*)Heap::Allocate(sizeof(Space));
+        NewSpace->PCID = PCID;
+        NewSpace->Stale = StalePCIDs[PCID / 64] & (1ull << (PCID % 64));
+        StalePCIDs[PCID / 64] &= ~(1ull << (PCID % 64));
+
+        NewSpace->PML4 = (PageTable*)PageAllocator::RequestPage();
+        STL::SetMemory(NewSpace->PML4, 0, 4096);
+        STL::CopyMemory(PageTableManager::PML4, NewSpace->PML4, KERNEL_PML4_ENTRIES * sizeof(PageDirEntry));
+
+        return NewSpace;
+    }
+
+    void Destroy(Space* Target)
+    {
+        if (Current == Target)
+        {
+            Switch(nullptr);
+        }
+
+        for (uint64_t i = KERNEL_PML4_ENTRIES; i < USER_SPACE_END / 0x8000000000; i++)
+        {
+            if (!Target->PML4->Entries[i].Present)
+            {
+                continue;
+            }
+
+            PageTable* PDP = (PageTable*)((uint64_t)Target->PML4->Entries[i].Address << 12);
+            for (uint64_t j = 0; j < 512; j++)
+            {
+                if (!PDP->Entries[j].Present)
+                {
+                    continue;
+                }
+
+                PageTable* PD = (PageTable*)((uint64_t)PDP->Entries[j].Address << 12);
+                for (uint64_t k = 0; k < 512; k++)
+                {
+                    if (!PD->Entries[k].Present)
+                    {
+                        continue;
+                    }
+
+                    PageTable* PT = (PageTable*)((uint64_t)PD->Entries[k].Address << 12);
+                    for (uint64_t l = 0; l < 512; l++)
+                    {
+                        if (PT->Entries[l].Present && (PT->Entries[l].Available & PAGE_OWNED))
+                        {
+                            PageAllocator::FreePage((void*)((uint64_t)PT->Entries[l].Address << 12));
+                        }
+                    }
+                    PageAllocator::FreePage(PT);
+                }
+                PageAllocator::FreePage(PD);
+            }
+            PageAllocator::FreePage(PDP);
+        }
+        PageAllocator::FreePage(Target->PML4);
+
+        //The TLB may still translate through the freed tables, so the PCID can only be reused once its entries are gone.
+        if (PCIDEnabled)
+        {
+            if (CPU::HasINVPCID())
+            {
+                struct
+                {
+                    uint64_t PCID;
+                    uint64_t Address;
+                } Descriptor = {Target->PCID, 0};
+
+                asm volatile ("INVPCID %0, %1" : : "m"(Descriptor), "r"((uint64_t)INVPCID_SINGLE_CONTEXT) : "memory");
+            }
+            else
+            {
+                StalePCIDs[Target->PCID / 64] |= 1ull << (Target->PCID % 64);
+            }
+
+            UsedPCIDs[Target->PCID / 64] &= ~(1ull << (Target->PCID % 64));
+        }
+
+        Heap::Free(Target);
+    }
+
+    bool Map(Space* Target, void* VirtualAddress, void* PhysicalAddress, bool Writable)
+    {
+        if (!IsUser(VirtualAddress))
+        {
+            return false;
+        }
+
+        PageDirEntry* Entry = PageTableManager::MapAddress(Target->PML4, VirtualAddress, PhysicalAddress, true);
+        Entry->ReadWrite = Writable;
+        return true;
+    }
+
+    void* Allocate(Space* Target, void* VirtualAddress)
+    {
+        if (!IsUser(VirtualAddress))
+        {
+            return nullptr;
+        }
+
+        void* Page = PageAllocator::RequestPage();
+        STL::SetMemory(Page, 0, 4096);
+
+        PageDirEntry* Entry = PageTableManager::MapAddress(Target->PML4, VirtualAddress, Page, true);
+        Entry->Available = PAGE_OWNED;
+
+        return Page;
+    }
+
+    void Switch(Space* Target)
+    {
+        if (Target == Current)
+        {
+            return;
+        }
+
+        uint64_t CR3;
+        if (Target == nullptr)
+        {
+            CR3 = (uint64_t)PageTableManager::PML4 | (PCIDEnabled ? CR3_NO_FLUSH : 0);
+        }
+        else
+        {
+            CR3 = (uint64_t)Target->PML4 | Target->PCID;
+
+            //Without the no flush bit the entries tagged with the PCID are dropped, only needed the first time a stale PCID is used.
+            if (PCIDEnabled && !Target->Stale)
+            {
+                CR3 |= CR3_NO_FLUSH;
+            }
+            Target->Stale = false;
+        }
+
+        asm volatile ("MOV %0, %%CR3" : : "r"(CR3) : "memory");
+        Current = Target;
+    }
+
+    Space* GetCurrent()
+    {
+        return Current;
+    }
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "PageTable.h"
+
+#define USER_SPACE_START 0x200000000000 //The first address past the KERNEL_PML4_ENTRIES shared entries.
+#define USER_SPACE_END 0x800000000000 //The end of the lower half.
+
+#define ADDRESS_SPACE_PCID_AMOUNT 4096
+
+#define PAGE_OWNED 1 //Available bits of a page that belongs to its address space and is freed with it.
+
+/// <summary>
+/// Page tables for user code, each space shares the kernel entries and has its own user region.
+/// When the cpu supports it every space is tagged with a PCID, so switching between them keeps the TLB.
+/// </summary>
+namespace AddressSpace
+{
+    struct Space
+    {
+        PageTable* PML4;
+
+        /// <summary>
+        /// 0 for the kernel or when PCIDs are not supported.
+        /// </summary>
+        uint16_t PCID;
+
+        /// <summary>
+        /// True while the TLB may still hold entries left behind by an earlier space with the same PCID.
+        /// </summary>
+        bool Stale;
+    };
+
+    /// <summary>
+    /// Enables PCIDs if the cpu has them, the kernel page tables have to be loaded first.
+    /// </summary>
+    void Init();
+
+    /// <summary>
+    /// Returns true if the address is in the user region.
+    /// </summary>
+    bool IsUser(void* VirtualAddress);
+
+    /// <summary>
+    /// Returns true if all Size bytes from VirtualAddress are in the user region, used to check memory passed in by user code.
+    /// </summary>
+    bool IsUser(void* VirtualAddress, uint64_t Size);
+
+    /// <summary>
+    /// Creates a space with an empty user region, returns nullptr if out of PCIDs.
+    /// </summary>
+    Space* Create();
+
+    /// <summary>
+    /// Frees the page tables and owned pages of a space, switching to the kernel if it is in use.
+    /// </summary>
+    void Destroy(Space* Target);
+
+    /// <summary>
+    /// Maps a user page to memory that is not owned by the space, the page must not be mapped yet.
+    /// Memory shared with other spaces should not be writable.
+    /// </summary>
+    bool Map(Space* Target, void* VirtualAddress, void* PhysicalAddress, bool Writable = true);
+
+    /// <summary>
+    /// Maps a cleared page owned by the space and returns the address the kernel can reach it through, or nullptr.
+    /// </summary>
+    void* Allocate(Space* Target, void* VirtualAddress);
+
+    /// <summary>
+    /// Loads the page tables of a space, or of the kernel if Target is nullptr.
+    /// </summary>
+    void Switch(Space* Target);
+
+    /// <summary>
+    /// Returns the loaded space, or nullptr if it is the kernel.
+    /// </summary>
+    Space* GetCurrent();
+}
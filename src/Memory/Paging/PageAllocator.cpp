@@ -108,6 +108,29 @@ namespace PageAllocator
         return nullptr;
     }
 
+    void* RequestPages(uint64_t Count)
+    {
+        uint64_t RunStart = FirstFreePage;
+        for (uint64_t i = FirstFreePage; i < PageAmount; i++)
+        {
+            if (GetPageStatus(i))
+            {
+                RunStart = i + 1;
+            }
+            else if (i + 1 - RunStart == Count)
+            {
+                LockPages((void*)(RunStart * 4096), Count);
+                if (RunStart == FirstFreePage)
+                {
+                    FirstFreePage = i + 1;
+                }
+                return (void*)(RunStart * 4096);
+            }
+        }
+
+        return nullptr;
+    }
+
     void* LockPage(void* Address)
     {
         uint64_t PageIndex = (uint64_t)Address / 4096;
@@ -15,6 +15,11 @@ namespace PageAllocator
 
     void* RequestPage();
 
+    /// <summary>
+    /// Returns Count physically contiguous pages, or nullptr if no free run is long enough.
+    /// </summary>
+    void* RequestPages(uint64_t Count);
+
     uint64_t GetFreePages();
 
     uint64_t GetLockedPages();
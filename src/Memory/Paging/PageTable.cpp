@@ -3,6 +3,7 @@
 #include "PageAllocator.h"
 
 #include "STL/Memory/Memory.h"
+#include "Profiling/BootTrace.h"
 
 namespace PageTableManager
 {
@@ -17,21 +18,41 @@ namespace PageTableManager
         {
             MapAddress((void*)((uint64_t)ScreenBuffer->Base + i), (void*)((uint64_t)ScreenBuffer->Base + i));
         }
+        BootTrace::Mark("Framebuffer map");
 
         for (uint64_t i = 0; i < PageAllocator::PageAmount; i++)
         {
             MapAddress((void*)(i * 4096), (void*)(i * 4096));
         }
+        BootTrace::Mark("Identity map");
+
+        //Every kernel entry gets its table now, so mappings made later are seen by address spaces created earlier.
+        for (uint64_t i = 0; i < KERNEL_PML4_ENTRIES; i++)
+        {
+            if (!PML4->Entries[i].Present)
+            {
+                PageTable* PDP = (PageTable*)PageAllocator::RequestPage();
+                STL::SetMemory(PDP, 0, 4096);
+                PML4->Entries[i].Address = (uint64_t)PDP >> 12;
+                PML4->Entries[i].Present = true;
+                PML4->Entries[i].ReadWrite = true;
+            }
+        }
 
         asm ("mov %0, %%cr3" : : "r" (PML4));
     }
 
-    void MapAddress(void* VirtualAddress, void* PhysicalAddress)
+    void MapAddress(void* VirtualAddress, void* PhysicalAddress, bool User)
+    {
+        MapAddress(PML4, VirtualAddress, PhysicalAddress, User);
+    }
+
+    PageDirEntry* MapAddress(PageTable* Root, void* VirtualAddress, void* PhysicalAddress, bool User)
     {
         PageIndexer Indexer = PageIndexer((uint64_t)VirtualAddress);
         PageDirEntry PDE;
 
-        PDE = PML4->Entries[Indexer.PDP];
+        PDE = Root->Entries[Indexer.PDP];
         PageTable* PDP;
         if (!PDE.Present)
         {
@@ -40,11 +61,18 @@ namespace PageTableManager
             PDE.Address = (uint64_t)PDP >> 12;
             PDE.Present = true;
             PDE.ReadWrite = true;
-            PML4->Entries[Indexer.PDP] = PDE;
+            PDE.UserSuper = User;
+            Root->Entries[Indexer.PDP] = PDE;
         }
         else
         {
             PDP = (PageTable*)((uint64_t)PDE.Address << 12);
+
+            if (User && !PDE.UserSuper)
+            {
+                PDE.UserSuper = true;
+                Root->Entries[Indexer.PDP] = PDE;
+            }
         }
         
         
@@ -57,11 +85,18 @@ namespace PageTableManager
             PDE.Address = (uint64_t)PD >> 12;
             PDE.Present = true;
             PDE.ReadWrite = true;
+            PDE.UserSuper = User;
             PDP->Entries[Indexer.PD] = PDE;
         }
         else
         {
             PD = (PageTable*)((uint64_t)PDE.Address << 12);
+
+            if (User && !PDE.UserSuper)
+            {
+                PDE.UserSuper = true;
+                PDP->Entries[Indexer.PD] = PDE;
+            }
         }
 
         PDE = PD->Entries[Indexer.PT];
@@ -73,17 +108,67 @@ namespace PageTableManager
             PDE.Address = (uint64_t)PT >> 12;
             PDE.Present = true;
             PDE.ReadWrite = true;
+            PDE.UserSuper = User;
             PD->Entries[Indexer.PT] = PDE;
         }
         else
         {
             PT = (PageTable*)((uint64_t)PDE.Address << 12);
+
+            if (User && !PDE.UserSuper)
+            {
+                PDE.UserSuper = true;
+                PD->Entries[Indexer.PT] = PDE;
+            }
         }
 
         PDE = PT->Entries[Indexer.P];
         PDE.Address = (uint64_t)PhysicalAddress >> 12;
         PDE.Present = true;
         PDE.ReadWrite = true;
+        PDE.UserSuper = User;
         PT->Entries[Indexer.P] = PDE;
+
+        return &PT->Entries[Indexer.P];
+    }
+
+    bool IsEmpty(PageTable* Table)
+    {
+        for (uint64_t i = 0; i < 512; i++)
+        {
+            if (Table->Entries[i].Present)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void UnmapAddress(void* VirtualAddress)
+    {
+        PageIndexer Indexer = PageIndexer((uint64_t)VirtualAddress);
+
+        PageTable* Tables[4] = {PML4};
+        uint64_t Indices[4] = {Indexer.PDP, Indexer.PD, Indexer.PT, Indexer.P};
+        for (uint64_t i = 0; i < 3; i++)
+        {
+            PageDirEntry& Entry = Tables[i]->Entries[Indices[i]];
+            if (!Entry.Present)
+            {
+                return;
+            }
+            Tables[i + 1] = (PageTable*)((uint64_t)Entry.Address << 12);
+        }
+
+        Tables[3]->Entries[Indices[3]] = PageDirEntry();
+        asm volatile ("INVLPG (%0)" : : "r"(VirtualAddress) : "memory");
+
+        //The PDP tables of the kernel stay, every address space shares them.
+        for (uint64_t i = 3; i >= 2 && IsEmpty(Tables[i]); i--)
+        {
+            Tables[i - 1]->Entries[Indices[i - 1]] = PageDirEntry();
+            PageAllocator::FreePage(Tables[i]);
+        }
     }
 }
\ No newline at end of file
@@ -25,9 +25,30 @@ struct PageTable
     PageDirEntry Entries[512];
 }__attribute__((aligned(0x1000)));
 
+#define KERNEL_PML4_ENTRIES 64 //The kernel only maps below 0x200000000000, so every address space can share these entries.
+
 namespace PageTableManager
 {
+    /// <summary>
+    /// The page tables of the kernel, address spaces share its first KERNEL_PML4_ENTRIES entries.
+    /// </summary>
+    extern PageTable* PML4;
+
     void Init(STL::Framebuffer* ScreenBuffer);
 
-    void MapAddress(void* VirtualAddress, void* PhysicalAddress);
+    /// <summary>
+    /// Maps a page, a user page and the tables leading to it can also be accessed from ring 3.
+    /// </summary>
+    void MapAddress(void* VirtualAddress, void* PhysicalAddress, bool User = false);
+
+    /// <summary>
+    /// Maps a page in the page tables starting at Root and returns the entry mapping it.
+    /// </summary>
+    PageDirEntry* MapAddress(PageTable* Root, void* VirtualAddress, void* PhysicalAddress, bool User);
+
+    /// <summary>
+    /// Unmaps a page of the kernel and frees the page table and page directory leading to it once they are empty.
+    /// The mapped page itself is not freed.
+    /// </summary>
+    void UnmapAddress(void* VirtualAddress);
 }
\ No newline at end of file
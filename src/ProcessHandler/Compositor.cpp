@@ -1,41 +1,172 @@
 #include "Compositor.h"
 #include "ProcessHandler.h"
 
+#include "STL/String/cstr.h"
+
+#include "TSC/TSC.h"
+
 namespace Compositor
 {
     bool RedrawRequest = false;
     bool BufferSwapRequest = false;
 
-    void Update(uint32_t i)
+    uint64_t TargetFPS = COMPOSITOR_DEFAULT_FPS;
+
+    /// <summary>
+    /// The TSC value the next frame is scheduled for, frames are kept on a grid of the frame period.
+    /// </summary>
+    uint64_t NextFrame = 0;
+
+    uint64_t FrameTimes[COMPOSITOR_FRAME_SAMPLES];
+    uint64_t FrameAmount = 0;
+    uint64_t DroppedFrames = 0;
+
+    char FrameStats[512];
+
+    uint64_t GetFramePeriod()
     {
-        for (uint32_t j = i + 1; j < ProcessHandler::Processes.Length(); j++)
+        return TargetFPS != 0 ? TSC::GetFrequency() / TargetFPS : 0;
+    }
+
+    void Update(Process* Target)
+    {
+        //Blending onto the previous frame of the same window would accumulate, everything behind it has to be drawn again.
+        if (!Target->IsOpaque())
+        {
+            RedrawRequest = true;
+            return;
+        }
+
+        for (Process* Current = ProcessTable::GetAbove(Target); Current != nullptr; Current = ProcessTable::GetAbove(Current))
         {
-            if (ProcessHandler::Processes[i]->Contains(ProcessHandler::Processes[j]))
+            if (Target->Contains(Current))
             {
                 RedrawRequest = true;
                 return;
             }
         }
-        ProcessHandler::Processes[i]->Render();
+        Target->Render(false);
         BufferSwapRequest = true;
     }
 
-    void Update()
+    bool Update()
     {
         if (RedrawRequest)
         {        
-            for (uint32_t i = 0; i < ProcessHandler::Processes.Length(); i++)
+            for (Process* Current = ProcessTable::GetBottom(); Current != nullptr; Current = ProcessTable::GetAbove(Current))
             {
-                ProcessHandler::Processes[i]->Render();
+                Current->Render();
             }    
-            Renderer::SwapBuffers();
+            Renderer::SwapDamage();
             RedrawRequest = false;
             BufferSwapRequest = false;     
+            return true;
         }
         else if (BufferSwapRequest)
         {                
-            Renderer::SwapBuffers();
+            Renderer::SwapDamage();
             BufferSwapRequest = false;
+            return true;
+        }
+
+        return false;
+    }
+
+    bool FrameDue()
+    {
+        return TargetFPS == 0 || TSC::Read() >= NextFrame;
+    }
+
+    void EndFrame(uint64_t Start)
+    {
+        uint64_t End = TSC::Read();
+        uint64_t Period = GetFramePeriod();
+
+        FrameTimes[FrameAmount % COMPOSITOR_FRAME_SAMPLES] = End - Start;
+        FrameAmount++;
+
+        if (Period == 0)
+        {
+            return;
+        }
+
+        //After an idle stretch there is no frame to drop, the grid just starts over.
+        if (Start >= NextFrame + Period)
+        {
+            NextFrame = Start;
+        }
+
+        NextFrame += Period;
+        if (End > NextFrame)
+        {
+            uint64_t Missed = (End - NextFrame) / Period + 1;
+            DroppedFrames += Missed;
+            NextFrame += Missed * Period;
+        }
+    }
+
+    const char* GetFrameStats()
+    {
+        uint64_t Amount = FrameAmount < COMPOSITOR_FRAME_SAMPLES ? FrameAmount : COMPOSITOR_FRAME_SAMPLES;
+        if (Amount == 0)
+        {
+            return "No frames presented";
+        }
+
+        uint64_t Sorted[COMPOSITOR_FRAME_SAMPLES];
+        uint64_t Total = 0;
+        for (uint64_t i = 0; i < Amount; i++)
+        {
+            uint64_t Value = FrameTimes[i];
+            uint64_t j = i;
+            while (j > 0 && Sorted[j - 1] > Value)
+            {
+                Sorted[j] = Sorted[j - 1];
+                j--;
+            }
+            Sorted[j] = Value;
+            Total += Value;
         }
+
+        char* CurrentLocation = FrameStats;
+
+        auto Write = [&](const char* Input) 
+        { 
+            CurrentLocation = STL::CopyString(CurrentLocation, Input) + 1;
+        }; 
+
+        auto WriteTime = [&](uint64_t Cycles) 
+        { 
+            uint64_t Microseconds = TSC::ToMicroseconds(Cycles);
+            uint64_t Fraction = Microseconds % 1000;
+
+            Write(STL::ToString(Microseconds / 1000));
+            Write(".");
+            Write(Fraction < 100 ? (Fraction < 10 ? "00" : "0") : "");
+            Write(STL::ToString(Fraction));
+            Write(" ms\n\r");
+        }; 
+
+        Write("Target: ");
+        Write(TargetFPS != 0 ? STL::ToString(TargetFPS) : "unlimited");
+        Write(" fps\n\rFrames: ");
+        Write(STL::ToString(FrameAmount));
+        Write("\n\rAverage: ");
+        WriteTime(Total / Amount);
+        Write("P95: ");
+        WriteTime(Sorted[(Amount * 95) / 100]);
+        Write("Worst: ");
+        WriteTime(Sorted[Amount - 1]);
+        Write("Dropped: ");
+        Write(STL::ToString(DroppedFrames));
+
+        *CurrentLocation = 0;
+        return FrameStats;
+    }
+
+    void ResetFrameStats()
+    {
+        FrameAmount = 0;
+        DroppedFrames = 0;
     }
-}
\ No newline at end of file
+}
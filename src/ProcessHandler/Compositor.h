@@ -2,12 +2,45 @@
 
 #include <stdint.h>
 
+class Process;
+
+#define COMPOSITOR_DEFAULT_FPS 60
+#define COMPOSITOR_FRAME_SAMPLES 128
+
 namespace Compositor
 {
     extern bool RedrawRequest;
     extern bool BufferSwapRequest;
 
-    void Update(uint32_t i);
+    /// <summary>
+    /// The rate frames are presented at, 0 presents as soon as there is something to draw.
+    /// </summary>
+    extern uint64_t TargetFPS;
+
+    /// <summary>
+    /// Renders the damage of a process that was just drawn, or requests a full redraw if something is drawn above or behind it.
+    /// </summary>
+    void Update(Process* Target);
+
+    /// <summary>
+    /// Renders and swaps whatever was requested since the last call, returns true if anything was presented.
+    /// </summary>
+    bool Update();
+
+    /// <summary>
+    /// Returns true once the frame period since the last presented frame has passed.
+    /// </summary>
+    bool FrameDue();
+
+    /// <summary>
+    /// Records the time since Start as the cost of a presented frame and schedules the next one, frames that could not start on time are counted as dropped.
+    /// </summary>
+    void EndFrame(uint64_t Start);
+
+    /// <summary>
+    /// Returns the average, p95 and worst frame time of the last frames and the amount of dropped frames.
+    /// </summary>
+    const char* GetFrameStats();
 
-    void Update();
-}
\ No newline at end of file
+    void ResetFrameStats();
+}
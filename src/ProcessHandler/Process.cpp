@@ -2,8 +2,11 @@
 #include "ProcessHandler.h"
 
 #include "STL/Math/Math.h"
+#include "STL/Graphics/Blend.h"
 
-#include "Memory/Heap.h"
+#include "Debug/Debug.h"
+#include "Memory/Paging/PageAllocator.h"
+#include "CPU/CPU.h"
 
 uint64_t Process::GetID()
 {
@@ -34,6 +37,8 @@ void Process::SetPos(STL::Point NewPos)
         this->Pos.X = STL::Clamp(this->Pos.X, (int32_t)0, (int32_t)(Renderer::Backbuffer.Width - this->FrameBuffer.Width));
         this->Pos.Y = STL::Clamp(this->Pos.Y, (int32_t)0, (int32_t)(Renderer::Backbuffer.Height - this->FrameBuffer.Height));        
     }
+
+    ProcessTable::InvalidateHitGrid();
 }
 
 STL::PROT Process::GetType()
@@ -48,56 +53,73 @@ const char* Process::GetTitle()
 
 STL::PROR Process::PopRequest()
 {
-    if (RequestAmount > 0)
-    {        
-        RequestAmount--;
-        return Requests[RequestAmount];
-    }   
-    return STL::PROR::SUCCESS;
+    //Requests are pushed from interrupts, so the ring is only touched with interrupts disabled.
+    uint64_t Flags = CPU::DisableInterrupts();
+
+    STL::PROR Request = STL::PROR::SUCCESS;
+    if (this->RequestHead != this->RequestTail)
+    {
+        Request = this->Requests[this->RequestHead % PROCESS_REQUEST_AMOUNT];
+        this->RequestHead++;
+        this->PendingRequests &= ~(1 << (uint8_t)Request);
+    }
+
+    CPU::RestoreInterrupts(Flags);
+
+    return Request;
 }
 
 void Process::PushRequest(STL::PROR Request)
 {
-    if (Request != STL::PROR::SUCCESS && RequestAmount < 16)
+    if (Request == STL::PROR::SUCCESS)
     {
-        Requests[RequestAmount] = Request;
-        RequestAmount++;
+        return;
+    }
+
+    uint64_t Flags = CPU::DisableInterrupts();
+
+    //A clear or draw that is already waiting covers this one, so a burst of input still causes a single redraw.
+    if ((Request == STL::PROR::DRAW || Request == STL::PROR::CLEAR) && (this->PendingRequests & (1 << (uint8_t)Request)))
+    {
+        this->CoalescedRequests++;
     }
+    else if (this->RequestTail - this->RequestHead >= PROCESS_REQUEST_AMOUNT)
+    {
+        this->DroppedRequests++;
+    }
+    else
+    {
+        this->Requests[this->RequestTail % PROCESS_REQUEST_AMOUNT] = Request;
+        this->RequestTail++;
+        this->PendingRequests |= 1 << (uint8_t)Request;
+    }
+
+    CPU::RestoreInterrupts(Flags);
 }
 
-STL::PROC Process::GetProcedure()
+uint64_t Process::GetDroppedRequests()
 {
-    return this->Procedure;
+    return this->DroppedRequests;
 }
 
-STL::Point Process::GetCloseButtonPos()
+uint64_t Process::GetCoalescedRequests()
 {
-    return CLOSE_BUTTON_OFFSET + STL::Point(this->FrameBuffer.Width, 0) + this->Pos; 
+    return this->CoalescedRequests;
 }
 
-void Process::SetDepth(uint64_t Depth)
+STL::PROC Process::GetProcedure()
 {
-    if (Depth > ProcessHandler::Processes.Length())
-    {
-        return;
-    }
-
-    this->Depth = Depth;
+    return this->Procedure;
+}
 
-    for (uint32_t i = 0; i < ProcessHandler::Processes.Length(); i++)
-    {
-        if (ProcessHandler::Processes[i] == this)
-        {
-            ProcessHandler::Processes[i] = ProcessHandler::Processes[Depth];
-            ProcessHandler::Processes[Depth] = this;
-            return;
-        }
-    }
+STL::Point Process::GetCloseButtonPos()
+{
+    return CLOSE_BUTTON_OFFSET + STL::Point(this->FrameBuffer.Width, 0) + this->Pos; 
 }
 
-void Process::UpdateDepth()
+uint64_t Process::GetDepth()
 {
-    this->SetDepth(this->Depth);
+    return this->Depth;
 }
 
 bool Process::Contains(STL::Point Other)
@@ -116,24 +138,71 @@ void Process::Clear()
 { 
     this->FrameBuffer.Clear();
     this->SendMessage(STL::PROM::CLEAR, &this->FrameBuffer);
+
+    this->DamageTopLeft = STL::Point(0, 0);
+    this->DamageBottomRight = STL::Point(this->FrameBuffer.Width, this->FrameBuffer.Height);
 }
 
 void Process::Kill()
 {
     this->SendMessage(STL::PROM::KILL, nullptr);
 
-    Heap::Free(FrameBuffer.Base);
+    //Whoever else still holds a reference, like a program the surface is mapped into, keeps the pixels alive.
+    Surface::Release(this->SurfaceHandle);
+    this->FrameBuffer.Base = nullptr;
+
+    if (this->Ring != nullptr)
+    {
+        PageAllocator::FreePages(this->Ring, (STL::SyscallRing::GetSize(this->Ring->Capacity) + 4095) / 4096);
+        this->Ring = nullptr;
+    }
 }
 
 void Process::Draw()
 {
-    this->SendMessage(STL::PROM::DRAW, &this->FrameBuffer);
+    STL::DINFO Info;
+    Info.Buffer = &this->FrameBuffer;
+    Info.DamageTopLeft = STL::Point(0, 0);
+    Info.DamageBottomRight = STL::Point(this->FrameBuffer.Width, this->FrameBuffer.Height);
+
+    this->SendMessage(STL::PROM::DRAW, &Info);
+
+    Info.DamageTopLeft.X = STL::Max(Info.DamageTopLeft.X, (int32_t)0);
+    Info.DamageTopLeft.Y = STL::Max(Info.DamageTopLeft.Y, (int32_t)0);
+    Info.DamageBottomRight.X = STL::Min(Info.DamageBottomRight.X, (int32_t)this->FrameBuffer.Width);
+    Info.DamageBottomRight.Y = STL::Min(Info.DamageBottomRight.Y, (int32_t)this->FrameBuffer.Height);
+    if (Info.DamageTopLeft.X >= Info.DamageBottomRight.X || Info.DamageTopLeft.Y >= Info.DamageBottomRight.Y)
+    {
+        return;
+    }
+
+    if (this->DamageTopLeft.X >= this->DamageBottomRight.X || this->DamageTopLeft.Y >= this->DamageBottomRight.Y)
+    {
+        this->DamageTopLeft = Info.DamageTopLeft;
+        this->DamageBottomRight = Info.DamageBottomRight;
+    }
+    else
+    {
+        this->DamageTopLeft = STL::Point(STL::Min(this->DamageTopLeft.X, Info.DamageTopLeft.X), STL::Min(this->DamageTopLeft.Y, Info.DamageTopLeft.Y));
+        this->DamageBottomRight = STL::Point(STL::Max(this->DamageBottomRight.X, Info.DamageBottomRight.X), STL::Max(this->DamageBottomRight.Y, Info.DamageBottomRight.Y));
+    }
 }
 
-void Process::Render()
+void Process::Render(bool Full)
 {
-    if (this->Type == STL::PROT::WINDOWED)
+    if (Full)
+    {
+        this->DamageTopLeft = STL::Point(0, 0);
+        this->DamageBottomRight = STL::Point(this->FrameBuffer.Width, this->FrameBuffer.Height);
+    }
+
+    if (this->Type == STL::PROT::WINDOWED && (Full || !this->FrameDrawn))
     {         
+        this->FrameDrawn = true;
+
+        Renderer::AddDamage(this->Pos - FRAME_OFFSET - STL::Point(RAISEDWIDTH, RAISEDWIDTH), 
+        this->Pos + STL::Point(this->FrameBuffer.Width + RAISEDWIDTH, this->FrameBuffer.Height + RAISEDWIDTH));
+
         STL::ARGB Background;
         STL::ARGB Foreground;
         if (this == ProcessHandler::FocusedProcess)
@@ -164,38 +233,120 @@ void Process::Render()
         return;
     }
 
-    //Copy this->FrameBuffer to Renderer::Backbuffer
+    //Copy the damaged part of this->FrameBuffer to Renderer::Backbuffer
+    STL::Point TopLeft = this->DamageTopLeft;
+    STL::Point BottomRight = this->DamageBottomRight;
+    this->DamageTopLeft = STL::Point(0, 0);
+    this->DamageBottomRight = STL::Point(0, 0);
+
+    if (TopLeft.X >= BottomRight.X || TopLeft.Y >= BottomRight.Y)
+    {
+        return;
+    }
 
-    void* Source = (uint8_t*)(this->FrameBuffer.Base);
-    void* Dest = (uint8_t*)(Renderer::Backbuffer.Base + this->Pos.X + Renderer::Backbuffer.PixelsPerScanline * this->Pos.Y);
+    Renderer::AddDamage(this->Pos + TopLeft, this->Pos + BottomRight);
 
-    for (uint32_t y = 0; y < this->FrameBuffer.Height; y++)
+    uint64_t Width = BottomRight.X - TopLeft.X;
+    void* Source = (uint8_t*)(this->FrameBuffer.Base + TopLeft.X + this->FrameBuffer.PixelsPerScanline * TopLeft.Y);
+    void* Dest = (uint8_t*)(Renderer::Backbuffer.Base + this->Pos.X + TopLeft.X + Renderer::Backbuffer.PixelsPerScanline * (this->Pos.Y + TopLeft.Y));
+
+    if (!this->IsOpaque())
+    {
+        for (int32_t y = TopLeft.Y; y < BottomRight.Y; y++)
+        {             
+            STL::BlendSpan((STL::ARGB*)Source, (STL::ARGB*)Dest, Width, this->Opacity, this->Alpha);
+            Source = (void*)((uint64_t)Source + this->FrameBuffer.PixelsPerScanline * 4);
+            Dest = (void*)((uint64_t)Dest + Renderer::Backbuffer.PixelsPerScanline * 4);   
+        }
+        return;
+    }
+
+    for (int32_t y = TopLeft.Y; y < BottomRight.Y; y++)
     {             
-        STL::CopyMemory(Source, Dest, this->FrameBuffer.PixelsPerScanline * 4);
+        STL::CopyMemory(Source, Dest, Width * 4);
         Source = (void*)((uint64_t)Source + this->FrameBuffer.PixelsPerScanline * 4);
         Dest = (void*)((uint64_t)Dest + Renderer::Backbuffer.PixelsPerScanline * 4);   
     }
 }
 
+bool Process::IsOpaque()
+{
+    return this->Opacity == 255 && !this->Alpha;
+}
+
 void Process::SendMessage(STL::PROM Message, STL::PROI Input)
 {
+    //Restored rather than cleared, a message sent from an IRQ can interrupt another process handling one.
+    Process* Previous = ProcessHandler::LastMessagedProcess;
     ProcessHandler::LastMessagedProcess = this;
 
     STL::PROR NewRequest = this->Procedure(Message, Input);
 
     this->PushRequest(NewRequest);
 
-    ProcessHandler::LastMessagedProcess = nullptr;
+    ProcessHandler::LastMessagedProcess = Previous;
+}
+
+Surface::Handle Process::GetSurface()
+{
+    return this->SurfaceHandle;
+}
+
+STL::SyscallRing* Process::SetupRing(uint32_t Capacity)
+{
+    if (this->Ring != nullptr)
+    {
+        return this->Ring;
+    }
+
+    if (Capacity == 0 || (Capacity & (Capacity - 1)) != 0)
+    {
+        return nullptr;
+    }
+
+    //Whole pages, so the rings could be mapped into a program as they are.
+    this->Ring = (STL::SyscallRing*)PageAllocator::RequestPages((STL::SyscallRing::GetSize(Capacity) + 4095) / 4096);
+    if (this->Ring != nullptr)
+    {
+        this->Ring->Init(Capacity);
+    }
+
+    return this->Ring;
+}
+
+STL::SyscallRing* Process::GetRing()
+{
+    return this->Ring;
+}
+
+void Process::CreateSurface(uint32_t Width, uint32_t Height)
+{
+    this->SurfaceHandle = Surface::Create(Width, Height);
+    if (this->SurfaceHandle == 0)
+    {
+        Debug::Error("Out of memory for a process surface");
+    }
+
+    this->FrameBuffer = *Surface::Get(this->SurfaceHandle);
 }
 
 Process::Process(STL::PROC Procedure)
 {
+    this->SurfaceHandle = 0;
+    this->Ring = nullptr;
     static uint64_t NewID = 0;
     NewID++;
 
     this->ID = NewID;
     this->Procedure = Procedure;
-    this->RequestAmount = 0;
+    this->RequestHead = 0;
+    this->RequestTail = 0;
+    this->PendingRequests = 0;
+    this->DroppedRequests = 0;
+    this->CoalescedRequests = 0;
+    this->DamageTopLeft = STL::Point(0, 0);
+    this->DamageBottomRight = STL::Point(0, 0);
+    this->FrameDrawn = false;
 
     STL::PINFO Info;
     this->SendMessage(STL::PROM::INIT, &Info);
@@ -204,29 +355,19 @@ Process::Process(STL::PROC Procedure)
 
     this->Pos = STL::Point(Info.Left, Info.Top);
     this->Title = Info.Title;
-    this->SetDepth(Info.Depth);
+    this->Opacity = Info.Opacity;
+    this->Alpha = Info.Alpha;
+    this->Depth = Info.Depth;
 
     if (Info.Type == STL::PROT::FULLSCREEN)
     {            
         this->Pos = STL::Point(0, 0);
-        this->FrameBuffer.Height = Renderer::Backbuffer.Height;  
-        this->FrameBuffer.Width = Renderer::Backbuffer.Width;
-        this->FrameBuffer.PixelsPerScanline = Renderer::Backbuffer.Width + 1;
-        this->FrameBuffer.Size = (this->FrameBuffer.Height + 1) * this->FrameBuffer.PixelsPerScanline * 4;
-        this->FrameBuffer.Base = (STL::ARGB*)Heap::Allocate(this->FrameBuffer.Size);
-    
-        this->FrameBuffer.Clear();
+        this->CreateSurface(Renderer::Backbuffer.Width, Renderer::Backbuffer.Height);
         this->PushRequest(STL::PROR::DRAW);
     }
     else if (Info.Type == STL::PROT::FRAMELESSWINDOW || Info.Type == STL::PROT::WINDOWED)
     {               
-        this->FrameBuffer.Height = Info.Height;  
-        this->FrameBuffer.Width = Info.Width;
-        this->FrameBuffer.PixelsPerScanline = Info.Width + 1;
-        this->FrameBuffer.Size = (this->FrameBuffer.Height + 1) * this->FrameBuffer.PixelsPerScanline * 4;
-        this->FrameBuffer.Base = (STL::ARGB*)Heap::Allocate(this->FrameBuffer.Size);
-
-        this->FrameBuffer.Clear();
+        this->CreateSurface(Info.Width, Info.Height);
         this->PushRequest(STL::PROR::DRAW);
     }
 } 
\ No newline at end of file
@@ -1,11 +1,15 @@
 #pragma once
 
 #include "STL/Process/Process.h"
+#include "STL/System/Ring.h"
 #include "STL/Graphics/Framebuffer.h"
 #include "STL/String/String.h"
 
 #include "Renderer/Renderer.h"
 
+#include "ProcessTable.h"
+#include "Surface.h"
+
 #define FRAME_OFFSET STL::Point(0, 30)
 #define CLOSE_BUTTON_SIZE STL::Point(16, 16)
 #define CLOSE_BUTTON_OFFSET STL::Point(((FRAME_OFFSET.X - CLOSE_BUTTON_SIZE.X) / 2 - CLOSE_BUTTON_SIZE.X), -FRAME_OFFSET.Y / 2 - CLOSE_BUTTON_SIZE.Y / 2)
@@ -13,6 +17,7 @@
 #define MOVING_WINDOW_OUTLINE_SPEED 10
 #define MOVING_WINDOW_OUTLINE_THICKNESS RAISEDWIDTH
 #define MOVING_WINDOW_OUTLINE_COLOR STL::ARGB(255, 224, 108, 117)
+#define PROCESS_REQUEST_AMOUNT 16
 
 class Process
 {
@@ -30,17 +35,45 @@ public:
 
     const char* GetTitle();
 
+    /// <summary>
+    /// Returns the oldest pending request, or SUCCESS if none are pending.
+    /// </summary>
     STL::PROR PopRequest();
 
     STL::PROC GetProcedure();
 
+    /// <summary>
+    /// The surface holding the framebuffer, the process keeps one reference until it is killed.
+    /// </summary>
+    Surface::Handle GetSurface();
+
+    /// <summary>
+    /// Returns the syscall rings of the process, creating them with Capacity entries the first time, or nullptr if Capacity is not a power of two.
+    /// The rings are freed when the process is killed.
+    /// </summary>
+    STL::SyscallRing* SetupRing(uint32_t Capacity);
+
+    /// <summary>
+    /// Returns the syscall rings of the process, or nullptr if it never set them up.
+    /// </summary>
+    STL::SyscallRing* GetRing();
+
     STL::Point GetCloseButtonPos();
 
+    /// <summary>
+    /// Queues a request behind the pending ones. A clear or draw that is already pending absorbs a new one,
+    /// a request that does not fit in the queue is dropped and counted.
+    /// </summary>
     void PushRequest(STL::PROR Request);
 
-    void SetDepth(uint64_t Depth);
+    uint64_t GetDroppedRequests();
+
+    uint64_t GetCoalescedRequests();
 
-    void UpdateDepth();
+    /// <summary>
+    /// The layer the process asked to be drawn in, processes in a higher layer are always drawn above.
+    /// </summary>
+    uint64_t GetDepth();
 
     bool Contains(STL::Point Other);
 
@@ -50,28 +83,54 @@ public:
 
     void Kill();
 
+    /// <summary>
+    /// Sends the draw message, the area the procedure reports as changed is added to the damage of the process.
+    /// </summary>
     void Draw();
 
-    void Render();
+    /// <summary>
+    /// Copies the process to the backbuffer. A full render also draws the window frame and copies the whole framebuffer,
+    /// otherwise only the damage since the last render is copied and the frame is only drawn if it was never drawn.
+    /// </summary>
+    void Render(bool Full = true);
+
+    bool IsOpaque();
 
     void SendMessage(STL::PROM Message, STL::PROI Input = nullptr);
     
     Process(STL::PROC Procedure);
 
+    ProcessTable::Links Links;
+
 private:
 
+    void CreateSurface(uint32_t Width, uint32_t Height);
+
     uint64_t ID;
 
     STL::PROT Type;
     STL::PROC Procedure;
     STL::Framebuffer FrameBuffer;
+    Surface::Handle SurfaceHandle;
+    STL::SyscallRing* Ring;
 
     STL::Point Pos;
     STL::Point OldPos;
     uint64_t Depth;
 
+    uint8_t Opacity;
+    bool Alpha;
+
+    STL::Point DamageTopLeft;
+    STL::Point DamageBottomRight;
+    bool FrameDrawn;
+
     STL::String Title;
 
-    uint64_t RequestAmount;
-    STL::PROR Requests[16];
+    STL::PROR Requests[PROCESS_REQUEST_AMOUNT];
+    uint64_t RequestHead;
+    uint64_t RequestTail;
+    uint8_t PendingRequests;
+    uint64_t DroppedRequests;
+    uint64_t CoalescedRequests;
 };
\ No newline at end of file
@@ -16,17 +16,24 @@
 #include "Input/KeyBoard.h"
 #include "Input/Mouse.h"
 #include "PIT/PIT.h"
+#include "TSC/TSC.h"
+#include "IPC/IPC.h"
+#include "System/System.h"
+#include "SharedPage/SharedPage.h"
 
 namespace ProcessHandler
 {        
-    STL::List<Process*> Processes;
-
     Process* LastMessagedProcess = nullptr;
     Process* FocusedProcess = nullptr;
     Process* MovingWindow = nullptr;
 
     STL::Point MovingWindowPosDelta = STL::Point(0, 0);
 
+    /// <summary>
+    /// A process focused by the mouse interrupt that the loop still has to raise.
+    /// </summary>
+    Process* PendingFocus = nullptr;
+
     void SetFocusedProcess(Process* NewFocus)
     {
         if (NewFocus == nullptr)
@@ -46,13 +53,28 @@ namespace ProcessHandler
         }
 
         FocusedProcess = NewFocus;       
+        ProcessTable::Focus(NewFocus);
 
         if (NewFocus->GetType() != STL::PROT::FULLSCREEN)
         {
-            FocusedProcess->SetDepth(Processes.Length() - 1);
+            ProcessTable::Raise(NewFocus);
         }  
     }
 
+    /// <summary>
+    /// Focuses a process from an interrupt. Keys go to it right away, raising it is left to the loop as it may be walking the z-order.
+    /// </summary>
+    void RequestFocus(Process* NewFocus)
+    {
+        if (FocusedProcess != nullptr && FocusedProcess->GetType() == STL::PROT::WINDOWED)
+        {                       
+            Compositor::RedrawRequest = true;
+        }
+
+        FocusedProcess = NewFocus;
+        PendingFocus = NewFocus;
+    }
+
     void KeyBoardInterupt()
     {
         if (FocusedProcess == nullptr)
@@ -79,41 +101,41 @@ namespace ProcessHandler
         }
         else
         {
-            for (uint32_t i = Processes.Length(); i --> 0; )
-            {                    
-                if (Mouse::LeftHeld && Processes[i]->GetType() == STL::PROT::WINDOWED && STL::Contains(Processes[i]->GetPos() - FRAME_OFFSET, Processes[i]->GetPos() + STL::Point(Processes[i]->GetSize().X, 0), Mouse::Position))
-                {               
-                    STL::Point CloseButtonPos = Processes[i]->GetCloseButtonPos();
-                    if (STL::Contains(CloseButtonPos, CloseButtonPos + CLOSE_BUTTON_SIZE, Mouse::Position)) //If over close button
-                    {
-                        KillProcess(Processes[i]->GetID());
-                        break;
-                    }
+            Process* Target = ProcessTable::HitTest(Mouse::Position);
+            if (Target == nullptr)
+            {
+                //Nothing is under the cursor.
+            }
+            else if (Target->Contains(Mouse::Position)) //If over window
+            {
+                STL::MINFO MouseInfo;
+                MouseInfo.Pos = Mouse::Position - Target->GetPos();
+                MouseInfo.LeftHeld = Mouse::LeftHeld;
+                MouseInfo.MiddleHeld = Mouse::MiddleHeld;
+                MouseInfo.RightHeld = Mouse::RightHeld;
 
-                    MovingWindow = Processes[i];
-                    MovingWindowPosDelta = Processes[i]->GetPos() - Mouse::Position;
+                Target->SendMessage(STL::PROM::MOUSE, &MouseInfo);     
 
-                    SetFocusedProcess(Processes[i]);    
-                    break;
-                }  
-                else if (Processes[i]->Contains(Mouse::Position)) //If over window
+                if (Mouse::LeftHeld)
                 {
-                    STL::MINFO MouseInfo;
-                    MouseInfo.Pos = Mouse::Position - Processes[i]->GetPos();
-                    MouseInfo.LeftHeld = Mouse::LeftHeld;
-                    MouseInfo.MiddleHeld = Mouse::MiddleHeld;
-                    MouseInfo.RightHeld = Mouse::RightHeld;
-
-                    Processes[i]->SendMessage(STL::PROM::MOUSE, &MouseInfo);     
-
-                    if (Mouse::LeftHeld)
-                    {
-                        SetFocusedProcess(Processes[i]);    
-                    } 
+                    RequestFocus(Target);    
+                } 
+            }
+            else if (Mouse::LeftHeld && Target->GetType() == STL::PROT::WINDOWED) //If over the title bar
+            {               
+                STL::Point CloseButtonPos = Target->GetCloseButtonPos();
+                if (STL::Contains(CloseButtonPos, CloseButtonPos + CLOSE_BUTTON_SIZE, Mouse::Position)) //If over close button
+                {
+                    KillProcess(Target->GetID());
+                }
+                else
+                {
+                    MovingWindow = Target;
+                    MovingWindowPosDelta = Target->GetPos() - Mouse::Position;
 
-                    break;
+                    RequestFocus(Target);    
                 }
-            }
+            }  
         }
 
         Mouse::LeftHeld = false;
@@ -125,73 +147,84 @@ namespace ProcessHandler
 
     void PITInterupt()
     {
-        for (uint32_t i = 0; i < Processes.Length(); i++)
+        for (Process* Current = ProcessTable::GetBottom(); Current != nullptr; Current = ProcessTable::GetAbove(Current))
         {
             uint64_t Tick = PIT::Ticks;
-            Processes[i]->SendMessage(STL::PROM::TICK, &Tick);
+            Current->SendMessage(STL::PROM::TICK, &Tick);
         }
     }
 
     void KillAllProcesses()
     {
-        for (uint32_t i = 0; i < Processes.Length(); i++)
+        FocusedProcess = nullptr;
+        LastMessagedProcess = nullptr;
+        MovingWindow = nullptr;
+        PendingFocus = nullptr;
+
+        Process* Current;
+        while ((Current = ProcessTable::GetTop()) != nullptr)
         {
-            Processes[i]->Kill();
-            delete Processes[i];
+            ProcessTable::Remove(Current);
+            Current->Kill();
+            delete Current;
         }
-        Processes.Clear();
     }
 
     Process* GetProcess(uint64_t ID)
     {
-        for (uint32_t i = 0; i < Processes.Length(); i++)
-        {
-            if (Processes[i]->GetID() == ID)
-            {
-                return Processes[i];
-            }
-        }
-        
-        return nullptr;
+        return ProcessTable::Get(ID);
     }
 
-    bool KillProcess(uint64_t ProcessID)
+    void DestroyProcess(Process* Target)
     {
-        for (uint32_t i = 0; i < Processes.Length(); i++)
+        ProcessTable::Remove(Target);
+
+        //Focus falls back to whichever process had it before.
+        if (Target == FocusedProcess)
         {
-            if (ProcessID == Processes[i]->GetID())
-            {
-                if (Processes[i] == FocusedProcess)
-                {
-                    FocusedProcess = nullptr;
-                }
+            FocusedProcess = ProcessTable::GetLastFocused();
+        }
 
-                if (Processes[i] == LastMessagedProcess)
-                {
-                    LastMessagedProcess = nullptr;
-                }
+        if (Target == LastMessagedProcess)
+        {
+            LastMessagedProcess = nullptr;
+        }
 
-                if (Processes[i] == MovingWindow)
-                {
-                    MovingWindow = nullptr;
-                }
+        if (Target == MovingWindow)
+        {
+            MovingWindow = nullptr;
+        }
 
-                Processes[i]->Kill();
-                delete Processes[i];
-                Processes.Erase(i);
-                Compositor::RedrawRequest = true;
-                return true;
-            }
+        if (Target == PendingFocus)
+        {
+            PendingFocus = nullptr;
         }
 
-        return false;
+        IPC::RemoveWaiters(Target->GetID());
+
+        Target->Kill();
+        delete Target;
+        Compositor::RedrawRequest = true;
+    }
+
+    bool KillProcess(uint64_t ProcessID)
+    {
+        Process* Target = ProcessTable::Get(ProcessID);
+        if (Target == nullptr)
+        {
+            return false;
+        }
+
+        //Processes are destroyed by the loop, so one is never freed while it is being walked over or is handling a message.
+        Target->PushRequest(STL::PROR::KILL);
+        return true;
     }
 
     uint64_t StartProcess(STL::PROC Procedure)
     {                    
-        for (uint32_t i = 0; i < Processes.Length(); i++)
+        for (Process* Current = ProcessTable::GetBottom(); Current != nullptr; Current = ProcessTable::GetAbove(Current))
         {
-            if (Processes[i]->GetProcedure() == Procedure)
+            if (Current->GetProcedure() == Procedure)
             {
                 return 0;
             }
@@ -201,72 +234,139 @@ namespace ProcessHandler
 
         if (NewProcess->GetType() == STL::PROT::FULLSCREEN)
         {
-            for (uint32_t i = 0; i < Processes.Length(); i++)
+            for (Process* Current = ProcessTable::GetBottom(); Current != nullptr; Current = ProcessTable::GetAbove(Current))
             {
-                if (Processes[i]->GetType() == STL::PROT::FULLSCREEN)
+                if (Current->GetType() == STL::PROT::FULLSCREEN)
                 {
-                    KillProcess(Processes[i]->GetID());
+                    KillProcess(Current->GetID());
                     break;
                 }
             }
         }
 
-        Processes.Push(NewProcess);
-        NewProcess->UpdateDepth();
+        ProcessTable::Insert(NewProcess);
 
         return NewProcess->GetID();
     }
 
+    /// <summary>
+    /// Takes the submissions of every process with syscall rings, so queued syscalls complete without the process entering the kernel.
+    /// </summary>
+    void PollRings()
+    {
+        for (Process* Current = ProcessTable::GetBottom(); Current != nullptr; Current = ProcessTable::GetAbove(Current))
+        {
+            if (Current->GetRing() != nullptr)
+            {
+                LastMessagedProcess = Current;
+                System::Drain(Current->GetRing());
+                LastMessagedProcess = nullptr;
+            }
+        }
+    }
+
     void Loop()
     {                
         StartProcess(tty::Procedure);
-        FocusedProcess = Processes[0];
+        SetFocusedProcess(ProcessTable::GetTop());
         
         while (true) 
         {   
-            for (uint32_t i = 0; i < Processes.Length(); i++)
+            Process* NewFocus = __atomic_exchange_n(&PendingFocus, nullptr, __ATOMIC_ACQ_REL);
+            if (NewFocus != nullptr)
             {
-                switch (Processes[i]->PopRequest())
-                {
-                case STL::PROR::CLEAR:
-                {
-                    Processes[i]->Clear();
-                    Compositor::Update(i);
-                }
-                break;
-                case STL::PROR::DRAW:
-                {
-                    Processes[i]->Draw();
-                    Compositor::Update(i);
-                }
-                break;
-                case STL::PROR::KILL:
-                {
-                    KillProcess(Processes[i]->GetID());
-                    i--;
-                    Compositor::RedrawRequest = true;
-                }
-                break;
-                case STL::PROR::RESET:
-                {
-                    KillAllProcesses();
-                    Loop();
-                }
-                break;
-                default:
+                SetFocusedProcess(NewFocus);
+            }
+
+            //Requests wait in the process until the next frame, then each process is cleared and drawn at most once.
+            if (Compositor::FrameDue())
+            {
+                uint64_t FrameStart = TSC::Read();
+
+                Process* Next;
+                for (Process* Current = ProcessTable::GetBottom(); Current != nullptr; Current = Next)
                 {
+                    Next = ProcessTable::GetAbove(Current);
+
+                    bool Clear = false;
+                    bool Draw = false;
+                    bool Kill = false;
+                    bool Reset = false;
+
+                    STL::PROR Request;
+                    while ((Request = Current->PopRequest()) != STL::PROR::SUCCESS)
+                    {
+                        switch (Request)
+                        {
+                        case STL::PROR::CLEAR:
+                        {
+                            Clear = true;
+                        }
+                        break;
+                        case STL::PROR::DRAW:
+                        {
+                            Draw = true;
+                        }
+                        break;
+                        case STL::PROR::KILL:
+                        {
+                            Kill = true;
+                        }
+                        break;
+                        case STL::PROR::RESET:
+                        {
+                            Reset = true;
+                        }
+                        break;
+                        default:
+                        {
 
+                        }
+                        break;
+                        }
+                    }
+
+                    if (Reset)
+                    {
+                        //The tty is started again below once no processes are left.
+                        KillAllProcesses();
+                        Compositor::RedrawRequest = true;
+                        break;
+                    }
+                    else if (Kill)
+                    {
+                        DestroyProcess(Current);
+                    }
+                    else if (Clear || Draw)
+                    {
+                        if (Clear)
+                        {
+                            Current->Clear();
+                        }
+                        if (Draw)
+                        {
+                            Current->Draw();
+                        }
+                        Compositor::Update(Current);
+                    }
                 }
-                break;
+
+                if (Compositor::Update())
+                {
+                    Compositor::EndFrame(FrameStart);
                 }
             }
 
-            Compositor::Update();
+            PollRings();
+            System::RunDeferred();
+            IPC::DeliverWakes();
+            SharedPage::UpdateCounters();
+            ProcessTable::UpdateHitGrid();
 
-            if (Processes.Length() == 0)
+            if (ProcessTable::GetAmount() == 0)
             {
                 StartProcess(tty::Procedure);
-                FocusedProcess = Processes[0];
+                SetFocusedProcess(ProcessTable::GetTop());
             }
 
             asm("HLT");
@@ -1,9 +1,9 @@
 #pragma once
 
 #include "Process.h"
+#include "ProcessTable.h"
 
 #include "STL/Process/Process.h"
-#include "STL/List/List.h"
 
 namespace ProcessHandler    
 {           
@@ -11,8 +11,6 @@ namespace ProcessHandler
     extern Process* LastMessagedProcess;
     extern Process* MovingWindow;
 
-    extern STL::List<Process*> Processes;
-
     void KeyBoardInterupt();
 
     void MouseInterupt();
@@ -23,6 +21,9 @@ namespace ProcessHandler
 
     Process* GetProcess(uint64_t ID);
 
+    /// <summary>
+    /// Requests a process to be killed, it is destroyed by the loop before the next frame. Returns false if there is no such process.
+    /// </summary>
     bool KillProcess(uint64_t ProcessID);
 
     uint64_t StartProcess(STL::PROC Procedure);
@@ -0,0 +1,434 @@
+#include "ProcessTable.h"
+#include "Process.h"
+
+#include "STL/Math/Math.h"
+
+#include "Renderer/Renderer.h"
+#include "Memory/Heap.h"
+#include "CPU/CPU.h"
+
+namespace ProcessTable
+{
+    struct Layer
+    {
+        Process* Bottom = nullptr;
+        Process* Top = nullptr;
+    };
+
+    struct HitCell
+    {
+        /// <summary>
+        /// The amount of processes covering the cell, PROCESS_GRID_CELL_CAPACITY + 1 if they did not fit.
+        /// </summary>
+        uint8_t Amount;
+
+        Process* Processes[PROCESS_GRID_CELL_CAPACITY];
+    };
+
+    //The mouse interrupt walks the lists, so they are only changed with interrupts disabled.
+    Process* Buckets[PROCESS_TABLE_BUCKET_AMOUNT];
+
+    Layer Layers[PROCESS_LAYER_AMOUNT];
+
+    Process* FocusChain = nullptr;
+    Process* FocusChainEnd = nullptr;
+
+    uint64_t Amount = 0;
+
+    HitCell* HitGrid = nullptr;
+    uint32_t HitGridWidth = 0;
+    uint32_t HitGridHeight = 0;
+    bool HitGridValid = false;
+
+    /// <summary>
+    /// The area a process takes up on screen, a windowed process also owns its title bar.
+    /// </summary>
+    void GetArea(Process* Target, STL::Point& TopLeft, STL::Point& BottomRight)
+    {
+        TopLeft = Target->GetPos();
+        BottomRight = Target->GetPos() + Target->GetSize();
+
+        if (Target->GetType() == STL::PROT::WINDOWED)
+        {
+            TopLeft -= FRAME_OFFSET;
+        }
+    }
+
+    void Unlink(Process* Target)
+    {
+        Layer& TargetLayer = Layers[Target->Links.Layer];
+
+        if (Target->Links.Below != nullptr)
+        {
+            Target->Links.Below->Links.Above = Target->Links.Above;
+        }
+        else
+        {
+            TargetLayer.Bottom = Target->Links.Above;
+        }
+
+        if (Target->Links.Above != nullptr)
+        {
+            Target->Links.Above->Links.Below = Target->Links.Below;
+        }
+        else
+        {
+            TargetLayer.Top = Target->Links.Below;
+        }
+
+        Target->Links.Above = nullptr;
+        Target->Links.Below = nullptr;
+    }
+
+    void LinkTop(Process* Target)
+    {
+        Layer& TargetLayer = Layers[Target->Links.Layer];
+
+        Target->Links.Below = TargetLayer.Top;
+        Target->Links.Above = nullptr;
+
+        if (TargetLayer.Top != nullptr)
+        {
+            TargetLayer.Top->Links.Above = Target;
+        }
+        else
+        {
+            TargetLayer.Bottom = Target;
+        }
+        TargetLayer.Top = Target;
+    }
+
+    void UnlinkFocus(Process* Target)
+    {
+        if (Target->Links.PreviousFocus != nullptr)
+        {
+            Target->Links.PreviousFocus->Links.NextFocus = Target->Links.NextFocus;
+        }
+        else if (FocusChain == Target)
+        {
+            FocusChain = Target->Links.NextFocus;
+        }
+
+        if (Target->Links.NextFocus != nullptr)
+        {
+            Target->Links.NextFocus->Links.PreviousFocus = Target->Links.PreviousFocus;
+        }
+        else if (FocusChainEnd == Target)
+        {
+            FocusChainEnd = Target->Links.PreviousFocus;
+        }
+
+        Target->Links.NextFocus = nullptr;
+        Target->Links.PreviousFocus = nullptr;
+    }
+
+    void Insert(Process* NewProcess)
+    {
+        uint64_t Flags = CPU::DisableInterrupts();
+
+        NewProcess->Links = Links();
+        NewProcess->Links.Layer = NewProcess->GetDepth() < PROCESS_LAYER_AMOUNT ? NewProcess->GetDepth() : PROCESS_LAYER_AMOUNT - 1;
+
+        uint64_t Bucket = NewProcess->GetID() % PROCESS_TABLE_BUCKET_AMOUNT;
+        NewProcess->Links.NextInBucket = Buckets[Bucket];
+        Buckets[Bucket] = NewProcess;
+
+        LinkTop(NewProcess);
+
+        //A new process has not been focused yet, so it is the last choice when focus falls back.
+        NewProcess->Links.PreviousFocus = FocusChainEnd;
+        if (FocusChainEnd != nullptr)
+        {
+            FocusChainEnd->Links.NextFocus = NewProcess;
+        }
+        else
+        {
+            FocusChain = NewProcess;
+        }
+        FocusChainEnd = NewProcess;
+
+        Amount++;
+        HitGridValid = false;
+
+        CPU::RestoreInterrupts(Flags);
+    }
+
+    void Remove(Process* OldProcess)
+    {
+        uint64_t Flags = CPU::DisableInterrupts();
+
+        Process** Slot = &Buckets[OldProcess->GetID() % PROCESS_TABLE_BUCKET_AMOUNT];
+        while (*Slot != nullptr)
+        {
+            if (*Slot == OldProcess)
+            {
+                *Slot = OldProcess->Links.NextInBucket;
+                break;
+            }
+            Slot = &(*Slot)->Links.NextInBucket;
+        }
+
+        Unlink(OldProcess);
+        UnlinkFocus(OldProcess);
+
+        Amount--;
+        HitGridValid = false;
+
+        CPU::RestoreInterrupts(Flags);
+    }
+
+    Process* Get(uint64_t ID)
+    {
+        Process* Current = Buckets[ID % PROCESS_TABLE_BUCKET_AMOUNT];
+        while (Current != nullptr && Current->GetID() != ID)
+        {
+            Current = Current->Links.NextInBucket;
+        }
+
+        return Current;
+    }
+
+    uint64_t GetAmount()
+    {
+        return Amount;
+    }
+
+    Process* GetBottom()
+    {
+        for (uint64_t i = 0; i < PROCESS_LAYER_AMOUNT; i++)
+        {
+            if (Layers[i].Bottom != nullptr)
+            {
+                return Layers[i].Bottom;
+            }
+        }
+
+        return nullptr;
+    }
+
+    Process* GetTop()
+    {
+        for (uint64_t i = PROCESS_LAYER_AMOUNT; i --> 0; )
+        {
+            if (Layers[i].Top != nullptr)
+            {
+                return Layers[i].Top;
+            }
+        }
+
+        return nullptr;
+    }
+
+    Process* GetAbove(Process* Target)
+    {
+        if (Target->Links.Above != nullptr)
+        {
+            return Target->Links.Above;
+        }
+
+        for (uint64_t i = Target->Links.Layer + 1; i < PROCESS_LAYER_AMOUNT; i++)
+        {
+            if (Layers[i].Bottom != nullptr)
+            {
+                return Layers[i].Bottom;
+            }
+        }
+
+        return nullptr;
+    }
+
+    Process* GetBelow(Process* Target)
+    {
+        if (Target->Links.Below != nullptr)
+        {
+            return Target->Links.Below;
+        }
+
+        for (uint64_t i = Target->Links.Layer; i --> 0; )
+        {
+            if (Layers[i].Top != nullptr)
+            {
+                return Layers[i].Top;
+            }
+        }
+
+        return nullptr;
+    }
+
+    void Raise(Process* Target)
+    {
+        if (Layers[Target->Links.Layer].Top == Target)
+        {
+            return;
+        }
+
+        uint64_t Flags = CPU::DisableInterrupts();
+
+        Unlink(Target);
+        LinkTop(Target);
+
+        HitGridValid = false;
+
+        CPU::RestoreInterrupts(Flags);
+    }
+
+    void Lower(Process* Target)
+    {
+        Layer& TargetLayer = Layers[Target->Links.Layer];
+        if (TargetLayer.Bottom == Target)
+        {
+            return;
+        }
+
+        uint64_t Flags = CPU::DisableInterrupts();
+
+        Unlink(Target);
+
+        Target->Links.Above = TargetLayer.Bottom;
+        TargetLayer.Bottom->Links.Below = Target;
+        TargetLayer.Bottom = Target;
+
+        HitGridValid = false;
+
+        CPU::RestoreInterrupts(Flags);
+    }
+
+    void Focus(Process* Target)
+    {
+        if (FocusChain == Target)
+        {
+            return;
+        }
+
+        uint64_t Flags = CPU::DisableInterrupts();
+
+        UnlinkFocus(Target);
+
+        Target->Links.NextFocus = FocusChain;
+        if (FocusChain != nullptr)
+        {
+            FocusChain->Links.PreviousFocus = Target;
+        }
+        else
+        {
+            FocusChainEnd = Target;
+        }
+        FocusChain = Target;
+
+        CPU::RestoreInterrupts(Flags);
+    }
+
+    Process* GetLastFocused()
+    {
+        return FocusChain;
+    }
+
+    void InvalidateHitGrid()
+    {
+        HitGridValid = false;
+    }
+
+    void UpdateHitGrid()
+    {
+        if (HitGridValid)
+        {
+            return;
+        }
+
+        //A window moved by the mouse interrupt halfway through would leave the grid outdated but marked valid.
+        uint64_t Flags = CPU::DisableInterrupts();
+
+        uint32_t Width = (Renderer::Backbuffer.Width + PROCESS_GRID_CELL_SIZE - 1) / PROCESS_GRID_CELL_SIZE;
+        uint32_t Height = (Renderer::Backbuffer.Height + PROCESS_GRID_CELL_SIZE - 1) / PROCESS_GRID_CELL_SIZE;
+
+        if (HitGrid == nullptr || Width != HitGridWidth || Height != HitGridHeight)
+        {
+            if (HitGrid != nullptr)
+            {
+                Heap::Free(HitGrid);
+            }
+
+            HitGridWidth = Width;
+            HitGridHeight = Height;
+            HitGrid = (HitCell*)Heap::Allocate(HitGridWidth * HitGridHeight * sizeof(HitCell));
+        }
+
+        for (uint32_t i = 0; i < HitGridWidth * HitGridHeight; i++)
+        {
+            HitGrid[i].Amount = 0;
+        }
+
+        //Walking from the top down leaves every cell sorted by z-order.
+        for (Process* Current = GetTop(); Current != nullptr; Current = GetBelow(Current))
+        {
+            STL::Point TopLeft;
+            STL::Point BottomRight;
+            GetArea(Current, TopLeft, BottomRight);
+
+            int32_t Left = STL::Max(TopLeft.X, (int32_t)0) / PROCESS_GRID_CELL_SIZE;
+            int32_t Top = STL::Max(TopLeft.Y, (int32_t)0) / PROCESS_GRID_CELL_SIZE;
+            int32_t Right = STL::Min(BottomRight.X / PROCESS_GRID_CELL_SIZE, (int32_t)HitGridWidth - 1);
+            int32_t Bottom = STL::Min(BottomRight.Y / PROCESS_GRID_CELL_SIZE, (int32_t)HitGridHeight - 1);
+
+            for (int32_t Y = Top; Y <= Bottom; Y++)
+            {
+                for (int32_t X = Left; X <= Right; X++)
+                {
+                    HitCell& Cell = HitGrid[Y * HitGridWidth + X];
+                    if (Cell.Amount < PROCESS_GRID_CELL_CAPACITY)
+                    {
+                        Cell.Processes[Cell.Amount] = Current;
+                        Cell.Amount++;
+                    }
+                    else
+                    {
+                        Cell.Amount = PROCESS_GRID_CELL_CAPACITY + 1;
+                    }
+                }
+            }
+        }
+
+        HitGridValid = true;
+
+        CPU::RestoreInterrupts(Flags);
+    }
+
+    Process* HitTest(STL::Point Pos)
+    {
+        auto Hits = [&](Process* Target)
+        {
+            STL::Point TopLeft;
+            STL::Point BottomRight;
+            GetArea(Target, TopLeft, BottomRight);
+            return STL::Contains(TopLeft, BottomRight, Pos);
+        };
+
+        if (HitGridValid && Pos.X >= 0 && Pos.Y >= 0 && Pos.X / PROCESS_GRID_CELL_SIZE < (int32_t)HitGridWidth && Pos.Y / PROCESS_GRID_CELL_SIZE < (int32_t)HitGridHeight)
+        {
+            HitCell& Cell = HitGrid[(Pos.Y / PROCESS_GRID_CELL_SIZE) * HitGridWidth + Pos.X / PROCESS_GRID_CELL_SIZE];
+            if (Cell.Amount <= PROCESS_GRID_CELL_CAPACITY)
+            {
+                for (uint8_t i = 0; i < Cell.Amount; i++)
+                {
+                    if (Hits(Cell.Processes[i]))
+                    {
+                        return Cell.Processes[i];
+                    }
+                }
+
+                return nullptr;
+            }
+        }
+
+        //Off screen, in a crowded cell or before the loop rebuilt the grid, fall back to walking every process.
+        for (Process* Current = GetTop(); Current != nullptr; Current = GetBelow(Current))
+        {
+            if (Hits(Current))
+            {
+                return Current;
+            }
+        }
+
+        return nullptr;
+    }
+}
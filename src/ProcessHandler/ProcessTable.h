@@ -0,0 +1,96 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "STL/Math/Point.h"
+
+#define PROCESS_TABLE_BUCKET_AMOUNT 64
+#define PROCESS_LAYER_AMOUNT 2
+#define PROCESS_GRID_CELL_SIZE 64
+#define PROCESS_GRID_CELL_CAPACITY 7
+
+class Process;
+
+namespace ProcessTable
+{
+    /// <summary>
+    /// The intrusive links of a process, only the process table changes them.
+    /// </summary>
+    struct Links
+    {
+        Process* Above = nullptr;
+        Process* Below = nullptr;
+
+        Process* NextFocus = nullptr;
+        Process* PreviousFocus = nullptr;
+
+        Process* NextInBucket = nullptr;
+
+        uint64_t Layer = 0;
+    };
+
+    /// <summary>
+    /// Adds a process on top of its layer and at the end of the focus chain.
+    /// </summary>
+    void Insert(Process* NewProcess);
+
+    void Remove(Process* OldProcess);
+
+    /// <summary>
+    /// Returns the process with the given ID through a hash map, or nullptr if there is none.
+    /// </summary>
+    Process* Get(uint64_t ID);
+
+    uint64_t GetAmount();
+
+    /// <summary>
+    /// Returns the bottommost process, processes are drawn from here upwards.
+    /// </summary>
+    Process* GetBottom();
+
+    Process* GetTop();
+
+    /// <summary>
+    /// Returns the process drawn directly above Target, crossing into higher layers, or nullptr if Target is the top.
+    /// </summary>
+    Process* GetAbove(Process* Target);
+
+    Process* GetBelow(Process* Target);
+
+    /// <summary>
+    /// Moves a process to the top of its layer.
+    /// </summary>
+    void Raise(Process* Target);
+
+    /// <summary>
+    /// Moves a process to the bottom of its layer.
+    /// </summary>
+    void Lower(Process* Target);
+
+    /// <summary>
+    /// Moves a process to the front of the focus chain.
+    /// </summary>
+    void Focus(Process* Target);
+
+    /// <summary>
+    /// Returns the most recently focused process that is still alive, or nullptr if there is none.
+    /// </summary>
+    Process* GetLastFocused();
+
+    /// <summary>
+    /// Returns the topmost process whose window, including its frame, contains Pos.
+    /// Found through a grid of screen cells listing the processes covering each cell from the top down,
+    /// while the grid is outdated every process is walked instead. Safe to call from interrupts.
+    /// </summary>
+    Process* HitTest(STL::Point Pos);
+
+    /// <summary>
+    /// Rebuilds the hit-test grid if the z-order or a position changed, called by the loop as it may use the heap.
+    /// </summary>
+    void UpdateHitGrid();
+
+    /// <summary>
+    /// Marks the hit-test grid as outdated, needed whenever a process moves.
+    /// </summary>
+    void InvalidateHitGrid();
+}
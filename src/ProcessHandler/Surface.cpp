@@ -0,0 +1,66 @@
+#include "Surface.h"
+
+#include "Memory/Paging/PageAllocator.h"
+
+#include "STL/Handle/HandleTable.h"
+
+namespace Surface
+{
+    struct Buffer
+    {
+        STL::Framebuffer Pixels;
+        uint64_t PageAmount;
+    };
+
+    STL::HandleTable<Buffer, SURFACE_AMOUNT> Surfaces;
+
+    Handle Create(uint32_t Width, uint32_t Height)
+    {
+        Buffer New;
+        New.Pixels.Width = Width;
+        New.Pixels.Height = Height;
+        New.Pixels.PixelsPerScanline = Width + 1;
+        New.Pixels.Size = (Height + 1) * New.Pixels.PixelsPerScanline * 4;
+
+        New.PageAmount = (New.Pixels.Size + 4095) / 4096;
+        New.Pixels.Base = (STL::ARGB*)PageAllocator::RequestPages(New.PageAmount);
+        if (New.Pixels.Base == nullptr)
+        {
+            return 0;
+        }
+        New.Pixels.Clear();
+
+        Handle Result = Surfaces.Insert(New);
+        if (Result == 0)
+        {
+            PageAllocator::FreePages(New.Pixels.Base, New.PageAmount);
+        }
+
+        return Result;
+    }
+
+    bool Acquire(Handle Target)
+    {
+        return Surfaces.Acquire(Target);
+    }
+
+    void Release(Handle Target)
+    {
+        Buffer Old;
+        if (Surfaces.Release(Target, &Old))
+        {
+            PageAllocator::FreePages(Old.Pixels.Base, Old.PageAmount);
+        }
+    }
+
+    STL::Framebuffer* Get(Handle Target)
+    {
+        Buffer* Current = Surfaces.Get(Target);
+        return Current != nullptr ? &Current->Pixels : nullptr;
+    }
+
+    uint64_t GetAmount()
+    {
+        return Surfaces.GetAmount();
+    }
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "STL/Graphics/Framebuffer.h"
+
+#define SURFACE_AMOUNT 64
+
+/// <summary>
+/// Window surfaces in physically contiguous pages, the kernel reaches them through the identity map.
+/// A process draws into its surface and the compositor reads the same pixels, without a copy in between.
+/// </summary>
+namespace Surface
+{
+    /// <summary>
+    /// Names a surface, a handle stops being valid once the surface is destroyed. 0 is never a valid handle.
+    /// </summary>
+    typedef uint64_t Handle;
+
+    /// <summary>
+    /// Creates a cleared surface with one reference, returns 0 if out of surfaces or memory.
+    /// The framebuffer has one spare row and column, like the heap framebuffers processes used before.
+    /// </summary>
+    Handle Create(uint32_t Width, uint32_t Height);
+
+    /// <summary>
+    /// Adds a reference, returns false if the handle is no longer valid.
+    /// </summary>
+    bool Acquire(Handle Target);
+
+    /// <summary>
+    /// Drops a reference, the pages are freed with the last one.
+    /// </summary>
+    void Release(Handle Target);
+
+    /// <summary>
+    /// Returns the framebuffer of a surface, or nullptr if the handle is no longer valid.
+    /// </summary>
+    STL::Framebuffer* Get(Handle Target);
+
+    /// <summary>
+    /// Returns the amount of surfaces alive.
+    /// </summary>
+    uint64_t GetAmount();
+}
@@ -0,0 +1,525 @@
+#include "Bench.h"
+
+#include "STL/String/cstr.h"
+#include "STL/Memory/Memory.h"
+#include "STL/Graphics/Framebuffer.h"
+#include "STL/Graphics/Blend.h"
+
+#include "TSC/TSC.h"
+#include "Memory/Heap.h"
+#include "Memory/Paging/PageAllocator.h"
+#include "Memory/Paging/PageTable.h"
+#include "Memory/Paging/AddressSpace.h"
+#include "Renderer/Renderer.h"
+#include "ProcessHandler/Compositor.h"
+#include "System/System.h"
+#include "Syscall/Syscall.h"
+#include "IPC/IPC.h"
+#include "ProcessHandler/ProcessHandler.h"
+#include "SharedPage/SharedPage.h"
+
+#define BENCH_NAME_WIDTH 28
+#define BENCH_COLUMN_WIDTH 14
+#define BENCH_MAX_RESULTS 32
+
+#define BENCH_MAP_BASE 0x180000000000 //Unused virtual address range for the MapAddress benchmark.
+#define BENCH_SURFACE_SIZE 256
+#define BENCH_SYSCALL_AMOUNT 64
+#define BENCH_MESSAGE_SIZE 64
+#define BENCH_MESSAGE_AMOUNT 64
+
+namespace Bench
+{
+    uint64_t Samples[BENCH_MAX_ITERATIONS];
+
+    char Output[(BENCH_MAX_RESULTS + 4) * 96];
+
+    //The channels the two benchmark processes talk over, Ping is written by the writer and Pong by the reader.
+    STL::Channel* Ping = nullptr;
+    STL::Channel* Pong = nullptr;
+
+    volatile uint64_t Received = 0;
+
+    bool Echo = false; //If not set the reader only counts what it reads.
+
+    void InitProcess(STL::PINFO* Info)
+    {
+        //Has to have a surface, one pixel nobody sees.
+        Info->Type = STL::PROT::FRAMELESSWINDOW;
+        Info->Depth = 0;
+        Info->Left = 0;
+        Info->Top = 0;
+        Info->Width = 1;
+        Info->Height = 1;
+        Info->Title = "bench";
+        Info->Opacity = 0;
+    }
+
+    /// <summary>
+    /// Empties Source on every WAKE and asks for the next one, calling Handle for each message.
+    /// </summary>
+    template<typename Function>
+    void Drain(STL::Channel* Source, Function Handle)
+    {
+        uint8_t Message[BENCH_MESSAGE_SIZE];
+        while (true)
+        {
+            while (Source->Read(Message))
+            {
+                Handle(Message);
+            }
+
+            //Done once waiting, or if the wait failed with nothing to read.
+            if (Source->WaitReadable() || Source->GetAmount() == 0)
+            {
+                return;
+            }
+        }
+    }
+
+    /// <summary>
+    /// Sends each message back over Pong, or counts it if Echo is not set.
+    /// </summary>
+    STL::PROR ReaderProcedure(STL::PROM Message, STL::PROI Input)
+    {
+        if (Message == STL::PROM::INIT)
+        {
+            InitProcess((STL::PINFO*)Input);
+        }
+
+        if (Message == STL::PROM::INIT || Message == STL::PROM::WAKE)
+        {
+            Drain(Ping, [](uint8_t* Current)
+            {
+                if (Echo)
+                {
+                    Pong->Write(Current);
+                }
+                else
+                {
+                    Received = Received + 1;
+                }
+            });
+        }
+
+        return STL::PROR::SUCCESS;
+    }
+
+    /// <summary>
+    /// Counts every message coming back over Pong and sends the next over Ping until BENCH_MESSAGE_AMOUNT came back.
+    /// </summary>
+    STL::PROR WriterProcedure(STL::PROM Message, STL::PROI Input)
+    {
+        if (Message == STL::PROM::INIT)
+        {
+            InitProcess((STL::PINFO*)Input);
+        }
+
+        if (Message == STL::PROM::INIT || Message == STL::PROM::WAKE)
+        {
+            Drain(Pong, [](uint8_t* Current)
+            {
+                Received = Received + 1;
+                if (Received < BENCH_MESSAGE_AMOUNT)
+                {
+                    Ping->Write(Current);
+                }
+            });
+        }
+
+        return STL::PROR::SUCCESS;
+    }
+
+    void Sort(uint64_t* Array, uint64_t Amount)
+    {
+        for (uint64_t i = 1; i < Amount; i++)
+        {
+            uint64_t Value = Array[i];
+            uint64_t j = i;
+            while (j > 0 && Array[j - 1] > Value)
+            {
+                Array[j] = Array[j - 1];
+                j--;
+            }
+            Array[j] = Value;
+        }
+    }
+
+    const char* Run(const char* Filter)
+    {
+        char* CurrentLocation = Output;
+        char* LineStart = Output;
+        uint64_t BenchAmount = 0;
+
+        auto Write = [&](const char* Input) 
+        { 
+            CurrentLocation = STL::CopyString(CurrentLocation, Input) + 1;
+        }; 
+
+        auto Pad = [&](uint64_t Column) 
+        { 
+            while ((uint64_t)(CurrentLocation - LineStart) < Column)
+            {
+                Write(" ");
+            }
+        }; 
+
+        auto NewLine = [&]() 
+        {
+            Write(NEWLINE);
+            LineStart = CurrentLocation;
+        };
+
+        auto WriteTime = [&](uint64_t Cycles) 
+        { 
+            Write(STL::ToString(TSC::ToNanoseconds(Cycles)));
+            Write(" ns");
+        }; 
+
+        //Times Body Iterations times, Setup and Teardown run around every iteration but are not timed.
+        auto Measure = [&](const char* Name, uint64_t Iterations, auto Setup, auto Body, auto Teardown) 
+        {
+            if (!STL::StartsWith(Name, Filter) || BenchAmount >= BENCH_MAX_RESULTS)
+            {
+                return;
+            }
+            BenchAmount++;
+
+            for (uint64_t i = 0; i < Iterations; i++)
+            {
+                Setup(i);
+                uint64_t Start = TSC::Read();
+                Body(i);
+                uint64_t End = TSC::Read();
+                Teardown(i);
+
+                Samples[i] = End - Start;
+            }
+
+            Sort(Samples, Iterations);
+
+            Write(Name);
+            Pad(BENCH_NAME_WIDTH);
+            WriteTime(Samples[0]);
+            Pad(BENCH_NAME_WIDTH + BENCH_COLUMN_WIDTH);
+            WriteTime(Samples[Iterations / 2]);
+            Pad(BENCH_NAME_WIDTH + BENCH_COLUMN_WIDTH * 2);
+            WriteTime(Samples[(Iterations * 99) / 100]);
+            NewLine();
+        };
+
+        auto Nothing = [](uint64_t) {};
+
+        Write("BENCHMARK");
+        Pad(BENCH_NAME_WIDTH);
+        Write("MIN");
+        Pad(BENCH_NAME_WIDTH + BENCH_COLUMN_WIDTH);
+        Write("MEDIAN");
+        Pad(BENCH_NAME_WIDTH + BENCH_COLUMN_WIDTH * 2);
+        Write("P99");
+        NewLine();
+
+        //Heap.
+        {
+            static void* Allocations[BENCH_MAX_ITERATIONS];
+
+            Measure("heap alloc+free 64", BENCH_MAX_ITERATIONS, Nothing, 
+            [&](uint64_t) { Heap::Free(Heap::Allocate(64)); }, Nothing);
+
+            Measure("heap alloc+free 4K", BENCH_MAX_ITERATIONS, Nothing, 
+            [&](uint64_t) { Heap::Free(Heap::Allocate(4096)); }, Nothing);
+
+            auto AllocateAll = [&](uint64_t i) 
+            {
+                for (uint64_t j = 0; i == 0 && j < BENCH_MAX_ITERATIONS; j++)
+                {
+                    Allocations[j] = Heap::Allocate(64);
+                }
+            };
+
+            auto FreeAll = [&](uint64_t i) 
+            {
+                for (uint64_t j = 0; i == BENCH_MAX_ITERATIONS - 1 && j < BENCH_MAX_ITERATIONS; j++)
+                {
+                    Heap::Free(Allocations[j]);
+                }
+            };
+
+            //Keeps every allocation alive so the segment list grows with each iteration.
+            Measure("heap alloc 64 x256 live", BENCH_MAX_ITERATIONS, Nothing, 
+            [&](uint64_t i) { Allocations[i] = Heap::Allocate(64); }, FreeAll);
+            
+            Measure("heap free 64 x256 live", BENCH_MAX_ITERATIONS, AllocateAll, 
+            [&](uint64_t i) { Heap::Free(Allocations[BENCH_MAX_ITERATIONS - i - 1]); }, Nothing);
+        }
+
+        //Paging.
+        {
+            static void* Pages[BENCH_MAX_ITERATIONS];
+
+            Measure("page request", BENCH_MAX_ITERATIONS, Nothing, 
+            [&](uint64_t i) { Pages[i] = PageAllocator::RequestPage(); }, 
+            [&](uint64_t i) { PageAllocator::FreePage(Pages[i]); });
+
+            //Every iteration maps a new virtual page to the same physical page, tables are only allocated on the first.
+            //The range is unmapped again before the page is freed, so no alias to it is left and every run allocates the tables.
+            void* Physical = PageAllocator::RequestPage();
+            Measure("page map", BENCH_MAX_ITERATIONS, Nothing, 
+            [&](uint64_t i) { PageTableManager::MapAddress((void*)(BENCH_MAP_BASE + i * 4096), Physical); }, Nothing);
+            for (uint64_t i = 0; i < BENCH_MAX_ITERATIONS; i++)
+            {
+                PageTableManager::UnmapAddress((void*)(BENCH_MAP_BASE + i * 4096));
+            }
+            PageAllocator::FreePage(Physical);
+        }
+
+        //Memory.
+        {
+            const uint64_t Sizes[] = {64, 4096, 65536, 1048576};
+            const char* CopyNames[] = {"copy 64", "copy 4K", "copy 64K", "copy 1M"};
+            const char* SetNames[] = {"set 64", "set 4K", "set 64K", "set 1M"};
+
+            uint8_t* Source = (uint8_t*)Heap::Allocate(Sizes[3]);
+            uint8_t* Dest = (uint8_t*)Heap::Allocate(Sizes[3]);
+
+            for (uint64_t i = 0; i < sizeof(Sizes) / sizeof(Sizes[0]); i++)
+            {
+                uint64_t Iterations = Sizes[i] >= 65536 ? 32 : BENCH_MAX_ITERATIONS;
+
+                Measure(CopyNames[i], Iterations, Nothing, 
+                [&](uint64_t) { STL::CopyMemory(Source, Dest, Sizes[i]); }, Nothing);
+
+                Measure(SetNames[i], Iterations, Nothing, 
+                [&](uint64_t) { STL::SetMemory(Dest, 0xAA, Sizes[i]); }, Nothing);
+            }
+
+            Heap::Free(Source);
+            Heap::Free(Dest);
+        }
+
+        //Drawing, done on a private surface so the screen is left alone.
+        {
+            STL::Framebuffer Surface;
+            Surface.Width = BENCH_SURFACE_SIZE;
+            Surface.Height = BENCH_SURFACE_SIZE;
+            Surface.PixelsPerScanline = BENCH_SURFACE_SIZE;
+            Surface.Size = BENCH_SURFACE_SIZE * BENCH_SURFACE_SIZE * 4;
+            Surface.Base = (STL::ARGB*)Heap::Allocate(Surface.Size);
+
+            Measure("draw rect 200x200", 64, Nothing, 
+            [&](uint64_t) { Surface.DrawRect(STL::Point(16, 16), STL::Point(216, 216), STL::ARGB(255, 40, 44, 52)); }, Nothing);
+
+            Measure("draw raised rect 200x200", 64, Nothing, 
+            [&](uint64_t) { Surface.DrawRaisedRect(STL::Point(16, 16), STL::Point(216, 216), STL::ARGB(255, 40, 44, 52)); }, Nothing);
+
+            Measure("draw rect clipped", 64, Nothing, 
+            [&](uint64_t) { Surface.DrawRect(STL::Point(-100, -100), STL::Point(100, 100), STL::ARGB(255, 40, 44, 52)); }, Nothing);
+
+            Measure("put char", BENCH_MAX_ITERATIONS, Nothing, 
+            [&](uint64_t i) { Surface.PutChar('A' + i % 26, STL::Point(32, 32), 1, STL::ARGB(255), STL::ARGB(0)); }, Nothing);
+
+            Measure("print 32 chars", 64, Nothing, 
+            [&](uint64_t) 
+            { 
+                STL::Point Pos = STL::Point(0, 0);
+                Surface.Print("The quick brown fox jumps over t", Pos); 
+            }, Nothing);
+
+            STL::ARGB* Layer = (STL::ARGB*)Heap::Allocate(Surface.Size);
+            STL::SetMemory(Layer, 0x80, Surface.Size);
+
+            Measure("blend 256x256 opacity", 64, Nothing, 
+            [&](uint64_t) { STL::BlendSpan(Layer, Surface.Base, BENCH_SURFACE_SIZE * BENCH_SURFACE_SIZE, 192, false); }, Nothing);
+
+            Measure("blend 256x256 alpha", 64, Nothing, 
+            [&](uint64_t) { STL::BlendSpan(Layer, Surface.Base, BENCH_SURFACE_SIZE * BENCH_SURFACE_SIZE, 255, true); }, Nothing);
+
+            Heap::Free(Layer);
+
+            Heap::Free(Surface.Base);
+        }
+
+        //Syscalls, all make the same call that does nothing for an ID no process has.
+        {
+            static AddressSpace::Space* UserSpace = nullptr;
+            if (UserSpace == nullptr)
+            {
+                UserSpace = AddressSpace::Create();
+
+                void* Code = AddressSpace::Allocate(UserSpace, (void*)USER_SPACE_START);
+                AddressSpace::Allocate(UserSpace, (void*)(USER_SPACE_START + 4096));
+                STL::CopyMemory(SyscallBenchStart, Code, SyscallBenchEnd - SyscallBenchStart);
+            }
+
+            Measure("syscall direct x64", 64, Nothing, 
+            [&](uint64_t) 
+            { 
+                for (uint64_t i = 0; i < BENCH_SYSCALL_AMOUNT; i++)
+                {
+                    System::Call(SYSCALL_KILL, 0);
+                }
+            }, Nothing);
+
+            //Includes entering ring 3 and the exit syscall once per 64 round trips.
+            AddressSpace::Switch(UserSpace);
+            Measure("syscall ring 3 x64", 64, Nothing, 
+            [&](uint64_t) { EnterUser(USER_SPACE_START, USER_SPACE_START + 8192); }, Nothing);
+            AddressSpace::Switch(nullptr);
+
+            //The same 64 calls queued on a syscall ring and run by one drain, as one RingEnter or a pass of the process loop would.
+            {
+                static STL::SyscallRing* Ring = nullptr;
+                if (Ring == nullptr)
+                {
+                    Ring = (STL::SyscallRing*)PageAllocator::RequestPages((STL::SyscallRing::GetSize(BENCH_SYSCALL_AMOUNT) + 4095) / 4096);
+                    Ring->Init(BENCH_SYSCALL_AMOUNT);
+                }
+
+                Measure("syscall ring batched x64", 64, Nothing, 
+                [&](uint64_t) 
+                { 
+                    for (uint64_t i = 0; i < BENCH_SYSCALL_AMOUNT; i++)
+                    {
+                        Ring->Submit(SYSCALL_KILL, 0, i);
+                    }
+
+                    System::Drain(Ring);
+
+                    STL::CQE Completion;
+                    while (Ring->Complete(Completion));
+                }, Nothing);
+            }
+
+            //A switch to a user space and back, what running a process for a frame costs on top of its work.
+            Measure("address space switch x2", 64, Nothing, 
+            [&](uint64_t) 
+            { 
+                AddressSpace::Switch(UserSpace);
+                AddressSpace::Switch(nullptr);
+            }, Nothing);
+
+            //Reading the time through the time syscall and without one through the system page.
+            Measure("time syscall x64", 64, Nothing, 
+            [&](uint64_t) 
+            { 
+                STL::TINFO Time;
+                for (uint64_t i = 0; i < BENCH_SYSCALL_AMOUNT; i++)
+                {
+                    System::Call(SYSCALL_TIME, (uint64_t)&Time);
+                }
+            }, Nothing);
+
+            Measure("system page time x64", 64, Nothing, 
+            [&](uint64_t) 
+            { 
+                STL::TINFO Time;
+                for (uint64_t i = 0; i < BENCH_SYSCALL_AMOUNT; i++)
+                {
+                    SharedPage::Get()->GetTime(&Time);
+                }
+            }, Nothing);
+
+            Measure("system page ns x64", 64, Nothing, 
+            [&](uint64_t) 
+            { 
+                for (uint64_t i = 0; i < BENCH_SYSCALL_AMOUNT; i++)
+                {
+                    SharedPage::Get()->GetNanoseconds();
+                }
+            }, Nothing);
+        }
+
+        //Channels between two processes. Every message makes its reader wait and the write wake it,
+        //the WAKE messages are delivered here the same way the process loop delivers them.
+        {
+            uint64_t PingHandle = IPC::CreateChannel(BENCH_MESSAGE_SIZE, BENCH_MESSAGE_AMOUNT);
+            uint64_t PongHandle = IPC::CreateChannel(BENCH_MESSAGE_SIZE, BENCH_MESSAGE_AMOUNT);
+            Ping = IPC::OpenChannel(PingHandle);
+            Pong = IPC::OpenChannel(PongHandle);
+            uint8_t Message[BENCH_MESSAGE_SIZE] = {};
+
+            uint64_t ReaderID = ProcessHandler::StartProcess(ReaderProcedure);
+            uint64_t WriterID = ProcessHandler::StartProcess(WriterProcedure);
+
+            auto Deliver = [&]()
+            {
+                while (Received < BENCH_MESSAGE_AMOUNT)
+                {
+                    IPC::DeliverWakes();
+                }
+            };
+
+            //Only one process runs a procedure, the ones from a previous run may not have been destroyed yet.
+            if (ReaderID != 0 && WriterID != 0)
+            {
+                //The first ping is sent here, the writer sends the rest as the pongs come back.
+                Echo = true;
+                Measure("channel ping-pong x64", 64, 
+                [&](uint64_t) { Received = 0; }, 
+                [&](uint64_t) 
+                { 
+                    Ping->Write(Message);
+                    Deliver();
+                }, Nothing);
+
+                //All messages are written at once and read with one wake.
+                Echo = false;
+                Measure("channel stream 64x64B", 64, 
+                [&](uint64_t) { Received = 0; }, 
+                [&](uint64_t) 
+                { 
+                    for (uint64_t i = 0; i < BENCH_MESSAGE_AMOUNT; i++)
+                    {
+                        Ping->Write(Message);
+                    }
+                    Deliver();
+                }, Nothing);
+            }
+
+            //The processes are destroyed by the loop, they stop waiting on the channels before those are freed.
+            IPC::RemoveWaiters(ReaderID);
+            IPC::RemoveWaiters(WriterID);
+            ProcessHandler::KillProcess(ReaderID);
+            ProcessHandler::KillProcess(WriterID);
+
+            //The slow path alone, a reader finding the ring empty and the writer waking it. No process has ID 0, so no message is sent.
+            Measure("channel wait and wake", 64, Nothing, 
+            [&](uint64_t) 
+            { 
+                IPC::Wait(0, &Ping->Tail, Ping->Tail);
+                IPC::Wake(&Ping->Tail);
+                IPC::DeliverWakes();
+            }, Nothing);
+
+            //Both the reference from creating and the one from opening.
+            IPC::CloseChannel(PingHandle);
+            IPC::CloseChannel(PingHandle);
+            IPC::CloseChannel(PongHandle);
+            IPC::CloseChannel(PongHandle);
+            Ping = nullptr;
+            Pong = nullptr;
+        }
+
+        //Presentation.
+        {
+            Measure("swap buffers", 32, Nothing, 
+            [&](uint64_t) { Renderer::SwapBuffers(); }, Nothing);
+
+            Measure("compositor full redraw", 32, 
+            [&](uint64_t) { Compositor::RedrawRequest = true; }, 
+            [&](uint64_t) { Compositor::Update(); }, Nothing);
+        }
+
+        if (BenchAmount == 0)
+        {
+            return "ERROR: No benchmark matches the filter";
+        }
+
+        Write("TSC frequency: ");
+        Write(STL::ToString(TSC::GetFrequency() / 1000000));
+        Write(" MHz");
+
+        *CurrentLocation = 0;
+        return Output;
+    }
+}
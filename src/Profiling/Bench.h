@@ -0,0 +1,14 @@
+#pragma once
+
+#include <stdint.h>
+
+#define BENCH_MAX_ITERATIONS 256
+
+namespace Bench
+{
+    /// <summary>
+    /// Runs every benchmark whose name starts with Filter, or all of them if Filter is empty, and returns the results as a table.
+    /// Each benchmark is timed per iteration with the TSC and reported as the min, median and 99th percentile.
+    /// </summary>
+    const char* Run(const char* Filter);
+}
@@ -0,0 +1,108 @@
+#include "BootTrace.h"
+
+#include "STL/String/cstr.h"
+
+#include "TSC/TSC.h"
+
+#define REPORT_NAME_WIDTH 36
+#define REPORT_TIME_WIDTH 16
+
+namespace BootTrace
+{
+    BootStage Stages[BOOTTRACE_MAX_STAGES];
+    uint64_t StageAmount = 0;
+
+    char Report[BOOTTRACE_MAX_STAGES * 80 + 256];
+
+    void Init(BootLoaderTrace* LoaderTrace)
+    {
+        StageAmount = 0;
+
+        if (LoaderTrace != nullptr)
+        {
+            for (uint64_t i = 0; i < LoaderTrace->Amount && i < BOOTLOADER_MAX_STAGES; i++)
+            {
+                Stages[StageAmount++] = LoaderTrace->Stages[i];
+            }
+        }
+
+        Mark("Bootloader handoff");
+    }
+
+    void Mark(const char* Name)
+    {
+        if (StageAmount >= BOOTTRACE_MAX_STAGES)
+        {
+            return;
+        }
+
+        Stages[StageAmount].Name = Name;
+        Stages[StageAmount].TSC = TSC::Read();
+        StageAmount++;
+    }
+
+    const char* GetReport()
+    {
+        char* CurrentLocation = Report;
+        char* LineStart = Report;
+
+        auto Write = [&](const char* Input) 
+        { 
+            CurrentLocation = STL::CopyString(CurrentLocation, Input) + 1;
+        }; 
+
+        auto Pad = [&](uint64_t Column) 
+        { 
+            while ((uint64_t)(CurrentLocation - LineStart) < Column)
+            {
+                Write(" ");
+            }
+        }; 
+
+        auto NewLine = [&]() 
+        {
+            Write("\n\r");
+            LineStart = CurrentLocation;
+        };
+
+        auto WriteTime = [&](uint64_t Cycles) 
+        { 
+            uint64_t Microseconds = TSC::ToMicroseconds(Cycles);
+            uint64_t Fraction = Microseconds % 1000;
+
+            Write(STL::ToString(Microseconds / 1000));
+            Write(".");
+            Write(Fraction < 100 ? (Fraction < 10 ? "00" : "0") : "");
+            Write(STL::ToString(Fraction));
+            Write(" ms");
+        }; 
+
+        Write("STAGE");
+        Pad(REPORT_NAME_WIDTH);
+        Write("TIME");
+        Pad(REPORT_NAME_WIDTH + REPORT_TIME_WIDTH);
+        Write("SINCE RESET");
+        NewLine();
+
+        //The TSC starts counting at reset, so the first stage is measured from zero.
+        uint64_t Previous = 0;
+        for (uint64_t i = 0; i < StageAmount; i++)
+        {
+            Write(Stages[i].Name);
+            Pad(REPORT_NAME_WIDTH);
+            WriteTime(Stages[i].TSC - Previous);
+            Pad(REPORT_NAME_WIDTH + REPORT_TIME_WIDTH);
+            WriteTime(Stages[i].TSC);
+            NewLine();
+
+            Previous = Stages[i].TSC;
+        }
+
+        Write("TSC frequency: ");
+        Write(STL::ToString(TSC::GetFrequency() / 1000000));
+        Write(" MHz");
+
+        *CurrentLocation = 0;
+        return Report;
+    }
+}
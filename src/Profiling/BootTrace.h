@@ -0,0 +1,42 @@
+#pragma once
+
+#include <stdint.h>
+
+#define BOOTLOADER_MAX_STAGES 16
+#define BOOTTRACE_MAX_STAGES 64
+
+/// <summary>
+/// A timestamp taken at the end of a boot stage.
+/// </summary>
+struct BootStage
+{
+    const char* Name;
+    uint64_t TSC;
+};
+
+/// <summary>
+/// The stages recorded by the bootloader, passed to the kernel in BootLoaderInfo.
+/// </summary>
+struct BootLoaderTrace
+{
+    uint64_t Amount;
+    BootStage Stages[BOOTLOADER_MAX_STAGES];
+};
+
+namespace BootTrace
+{
+    /// <summary>
+    /// Starts the kernel trace, the stages recorded by the bootloader are prepended to it.
+    /// </summary>
+    void Init(BootLoaderTrace* LoaderTrace);
+
+    /// <summary>
+    /// Records the TSC at the end of the stage called Name.
+    /// </summary>
+    void Mark(const char* Name);
+
+    /// <summary>
+    /// Returns a per-stage breakdown of the boot as plain text.
+    /// </summary>
+    const char* GetReport();
+}
@@ -0,0 +1,170 @@
+#include "Profiler.h"
+#include "Symbols.h"
+
+#include "STL/String/cstr.h"
+
+#include "Memory/Heap.h"
+#include "PIT/PIT.h"
+
+#define REPORT_COUNT_WIDTH 10
+#define REPORT_PERCENT_WIDTH 20
+
+namespace Profiler
+{
+    SampleBuffer Buffers[PROFILER_MAX_CPUS];
+
+    volatile bool Running = false;
+
+    char Report[(PROFILER_REPORT_AMOUNT + 8) * 128];
+
+    uint64_t GetCPUIndex()
+    {
+        //Only the bootstrap processor is started.
+        return 0;
+    }
+
+    void Start()
+    {
+        Running = false;
+
+        for (uint64_t i = 0; i < PROFILER_MAX_CPUS; i++)
+        {
+            Buffers[i].Amount = 0;
+            Buffers[i].Lost = 0;
+        }
+
+        Running = true;
+    }
+
+    void Stop()
+    {
+        Running = false;
+    }
+
+    bool IsRunning()
+    {
+        return Running;
+    }
+
+    void Sample(uint64_t InstructionPointer)
+    {
+        if (!Running)
+        {
+            return;
+        }
+
+        SampleBuffer& Buffer = Buffers[GetCPUIndex()];
+        if (Buffer.Amount < PROFILER_SAMPLE_AMOUNT)
+        {
+            Buffer.Samples[Buffer.Amount++] = InstructionPointer;
+        }
+        else
+        {
+            Buffer.Lost++;
+        }
+    }
+
+    const char* GetReport()
+    {
+        char* CurrentLocation = Report;
+        char* LineStart = Report;
+
+        auto Write = [&](const char* Input) 
+        { 
+            CurrentLocation = STL::CopyString(CurrentLocation, Input) + 1;
+        }; 
+
+        auto Pad = [&](uint64_t Column) 
+        { 
+            while ((uint64_t)(CurrentLocation - LineStart) < Column)
+            {
+                Write(" ");
+            }
+        }; 
+
+        auto NewLine = [&]() 
+        {
+            Write(NEWLINE);
+            LineStart = CurrentLocation;
+        };
+
+        if (Running)
+        {
+            Write("Stop the profiler before generating a report.");
+            *CurrentLocation = 0;
+            return Report;
+        }
+
+        uint64_t* Counts = (uint64_t*)Heap::Allocate((KernelSymbolAmount + 1) * sizeof(uint64_t));
+        for (uint64_t i = 0; i < KernelSymbolAmount + 1; i++)
+        {
+            Counts[i] = 0;
+        }
+
+        //Samples that do not fall inside a kernel function are counted in the last slot.
+        uint64_t Total = 0;
+        uint64_t Lost = 0;
+        for (uint64_t CPU = 0; CPU < PROFILER_MAX_CPUS; CPU++)
+        {
+            for (uint64_t i = 0; i < Buffers[CPU].Amount; i++)
+            {
+                int64_t Index = Symbols::FindIndex(Buffers[CPU].Samples[i]);
+                Counts[Index != -1 ? Index : KernelSymbolAmount]++;
+            }
+
+            Total += Buffers[CPU].Amount;
+            Lost += Buffers[CPU].Lost;
+        }
+
+        Write("SAMPLES");
+        Pad(REPORT_COUNT_WIDTH);
+        Write("PERCENT");
+        Pad(REPORT_PERCENT_WIDTH);
+        Write("FUNCTION");
+        NewLine();
+
+        for (uint64_t Entry = 0; Entry < PROFILER_REPORT_AMOUNT; Entry++)
+        {
+            uint64_t Best = 0;
+            for (uint64_t i = 1; i < KernelSymbolAmount + 1; i++)
+            {
+                if (Counts[i] > Counts[Best])
+                {
+                    Best = i;
+                }
+            }
+
+            if (Counts[Best] == 0)
+            {
+                break;
+            }
+
+            uint64_t Permille = (Counts[Best] * 1000) / Total;
+
+            Write(STL::ToString(Counts[Best]));
+            Pad(REPORT_COUNT_WIDTH);
+            Write(STL::ToString(Permille / 10));
+            Write(".");
+            Write(STL::ToString(Permille % 10));
+            Write("%");
+            Pad(REPORT_PERCENT_WIDTH);
+            Write(Best != KernelSymbolAmount ? KernelSymbols[Best].Name : "[unknown]");
+            NewLine();
+
+            Counts[Best] = 0;
+        }
+
+        Heap::Free(Counts);
+
+        Write("Total: ");
+        Write(STL::ToString(Total));
+        Write(" samples at ");
+        Write(STL::ToString(PIT::GetFrequency()));
+        Write(" Hz, ");
+        Write(STL::ToString(Lost));
+        Write(" lost");
+
+        *CurrentLocation = 0;
+        return Report;
+    }
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <stdint.h>
+
+#define PROFILER_MAX_CPUS 1
+#define PROFILER_SAMPLE_AMOUNT 16384
+#define PROFILER_REPORT_AMOUNT 24
+
+/// <summary>
+/// The samples taken on a single cpu, only ever written by that cpus timer interrupt.
+/// </summary>
+struct SampleBuffer
+{
+    uint64_t Samples[PROFILER_SAMPLE_AMOUNT];
+    uint64_t Amount;
+    uint64_t Lost;
+};
+
+namespace Profiler
+{
+    /// <summary>
+    /// Clears the sample buffers and starts sampling on every timer interrupt.
+    /// </summary>
+    void Start();
+
+    void Stop();
+
+    bool IsRunning();
+
+    /// <summary>
+    /// Records the interrupted instruction pointer, called by the timer interrupt.
+    /// </summary>
+    void Sample(uint64_t InstructionPointer);
+
+    /// <summary>
+    /// Returns a flat histogram of the samples grouped by kernel function, most sampled first.
+    /// </summary>
+    const char* GetReport();
+}
@@ -0,0 +1,38 @@
+#include "Symbols.h"
+
+extern uint64_t _KernelEnd;
+
+namespace Symbols
+{
+    int64_t FindIndex(uint64_t Address)
+    {
+        if (KernelSymbolAmount == 0 || Address < KernelSymbols[0].Address || Address >= (uint64_t)&_KernelEnd)
+        {
+            return -1;
+        }
+
+        //Find the last symbol that starts at or before the address.
+        uint64_t Low = 0;
+        uint64_t High = KernelSymbolAmount;
+        while (High - Low > 1)
+        {
+            uint64_t Middle = (Low + High) / 2;
+            if (KernelSymbols[Middle].Address <= Address)
+            {
+                Low = Middle;
+            }
+            else
+            {
+                High = Middle;
+            }
+        }
+
+        return Low;
+    }
+
+    const char* Lookup(uint64_t Address)
+    {
+        int64_t Index = FindIndex(Address);
+        return Index != -1 ? KernelSymbols[Index].Name : nullptr;
+    }
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <stdint.h>
+
+/// <summary>
+/// A kernel function, the table is generated from the linked kernel by a post-link step in the Makefile.
+/// </summary>
+struct KernelSymbol
+{
+    uint64_t Address;
+    const char* Name;
+};
+
+extern "C" const uint64_t KernelSymbolAmount;
+extern "C" const KernelSymbol KernelSymbols[];
+
+namespace Symbols
+{
+    /// <summary>
+    /// Returns the index of the symbol containing the address, or -1 if it is not inside the kernel.
+    /// </summary>
+    int64_t FindIndex(uint64_t Address);
+
+    /// <summary>
+    /// Returns the name of the function containing the address, or nullptr if it is not inside the kernel.
+    /// </summary>
+    const char* Lookup(uint64_t Address);
+}
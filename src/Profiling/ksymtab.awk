@@ -0,0 +1,38 @@
+# Turns the output of "nm -n -C --defined-only" into an assembly file that embeds the kernel
+# function symbols, sorted by address, in the .ksymtab section. Without input an empty table is
+# produced, which is used for the first link pass.
+
+BEGIN {
+    Amount = 0
+}
+
+$2 ~ /^[tTwW]$/ {
+    Name = $0
+    sub(/^[^ ]+ [^ ]+ /, "", Name)
+    sub(/\(.*/, "", Name)
+    gsub(/\\/, "\\\\", Name)
+    gsub(/"/, "\\\"", Name)
+
+    Addresses[Amount] = $1
+    Names[Amount] = Name
+    Amount++
+}
+
+END {
+    print ".section .ksymtab, \"a\""
+    print ".balign 8"
+    print ".global KernelSymbolAmount"
+    print "KernelSymbolAmount:"
+    print "    .quad " Amount
+    print ".global KernelSymbols"
+    print "KernelSymbols:"
+    for (i = 0; i < Amount; i++)
+    {
+        print "    .quad 0x" Addresses[i] ", .LName" i
+    }
+    for (i = 0; i < Amount; i++)
+    {
+        print ".LName" i ": .asciz \"" Names[i] "\""
+    }
+    print ".section .note.GNU-stack, \"\", @progbits"
+}
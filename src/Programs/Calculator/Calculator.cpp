@@ -4,8 +4,7 @@
 #include "STL/String/String.h"
 #include "STL/String/cstr.h"
 #include "STL/System/System.h"
-#include "STL/GUI/Button.h"
-#include "STL/GUI/Label.h"
+#include "STL/GUI/Widget.h"
 
 #define BUTTON_SIZE STL::Point(50, 50 / (16/9))
 
@@ -14,17 +13,19 @@
 
 namespace Calculator
 {
-    STL::Label Label;
+    STL::WidgetTree Widgets;
 
-    STL::Button NumButtons[10];
+    STL::WidgetID Label;
 
-    STL::Button AddButton;
-    STL::Button SubButton;
-    STL::Button MulButton;
-    STL::Button DivButton;
+    STL::WidgetID NumButtons[10];
 
-    STL::Button EqualButton;
-    STL::Button PointButton;
+    STL::WidgetID AddButton;
+    STL::WidgetID SubButton;
+    STL::WidgetID MulButton;
+    STL::WidgetID DivButton;
+
+    STL::WidgetID EqualButton;
+    STL::WidgetID PointButton;
 
     uint32_t PreviousNum = 0;
     uint32_t PreviousOperator = 0;
@@ -55,98 +56,51 @@ namespace Calculator
             ClearLabel = true;
             PreviousOperator = 0;
 
-            Label = STL::Label("0", LABEL_POS, LABEL_POS + LABEL_SIZE);
-            Label.Style = STL::LabelStyle::Sunken;
-            Label.Background = STL::ARGB(255);
-            Label.Foreground = STL::ARGB(0);
-            Label.Scale = 2;
-            Label.HorizontalAlign = STL::LabelAlign::Positive;
-
-            STL::Point Temp = GetButtonPosition(3, 2);
-            AddButton = STL::Button(STL::ARGB(200), "+", Temp, Temp + BUTTON_SIZE);
-            AddButton.Scale = 2;
-
-            Temp = GetButtonPosition(3, 1);
-            SubButton = STL::Button(STL::ARGB(200), "-", Temp, Temp + BUTTON_SIZE);
-            SubButton.Scale = 2;
-
-            Temp = GetButtonPosition(3, 0);
-            MulButton = STL::Button(STL::ARGB(200), "*", Temp, Temp + BUTTON_SIZE);
-            MulButton.Scale = 2;
-
-            Temp = GetButtonPosition(0, 3);
-            DivButton = STL::Button(STL::ARGB(200), "/", Temp, Temp + BUTTON_SIZE);
-            DivButton.Scale = 2;
+            Widgets.Init(STL::Point(Info->Width, Info->Height), STL::ARGB(200));
 
-            Temp = GetButtonPosition(3, 3);
-            EqualButton = STL::Button(STL::ARGB(200), "=", Temp, Temp + BUTTON_SIZE);
-            EqualButton.Scale = 2;
+            Label = Widgets.AddLabel(0, "0", LABEL_POS, LABEL_POS + LABEL_SIZE, STL::LabelStyle::Sunken, 2);
+            Widgets.Get(Label).Background = STL::ARGB(255);
+            Widgets.Get(Label).Foreground = STL::ARGB(0);
+            Widgets.Get(Label).HorizontalAlign = STL::LabelAlign::Positive;
 
-            Temp = GetButtonPosition(2, 3);
-            PointButton = STL::Button(STL::ARGB(200), ".", Temp, Temp + BUTTON_SIZE);
-            PointButton.Scale = 2;
-
-            Temp = GetButtonPosition(1, 3);
-            NumButtons[0] = STL::Button(STL::ARGB(200), "0", Temp, Temp + BUTTON_SIZE);
-            NumButtons[0].Scale = 2;
-
-            Temp = GetButtonPosition(0, 0);
-            NumButtons[1] = STL::Button(STL::ARGB(200), "1", Temp, Temp + BUTTON_SIZE);
-            NumButtons[1].Scale = 2;
-            
-            Temp = GetButtonPosition(1, 0);
-            NumButtons[2] = STL::Button(STL::ARGB(200), "2", Temp, Temp + BUTTON_SIZE);
-            NumButtons[2].Scale = 2;
-            
-            Temp = GetButtonPosition(2, 0);
-            NumButtons[3] = STL::Button(STL::ARGB(200), "3", Temp, Temp + BUTTON_SIZE);
-            NumButtons[3].Scale = 2;
-            
-            Temp = GetButtonPosition(0, 1);
-            NumButtons[4] = STL::Button(STL::ARGB(200), "4", Temp, Temp + BUTTON_SIZE);
-            NumButtons[4].Scale = 2;
-            
-            Temp = GetButtonPosition(1, 1);
-            NumButtons[5] = STL::Button(STL::ARGB(200), "5", Temp, Temp + BUTTON_SIZE);
-            NumButtons[5].Scale = 2;
-            
-            Temp = GetButtonPosition(2, 1);
-            NumButtons[6] = STL::Button(STL::ARGB(200), "6", Temp, Temp + BUTTON_SIZE);
-            NumButtons[6].Scale = 2;
-            
-            Temp = GetButtonPosition(0, 2);
-            NumButtons[7] = STL::Button(STL::ARGB(200), "7", Temp, Temp + BUTTON_SIZE);
-            NumButtons[7].Scale = 2;
-            
-            Temp = GetButtonPosition(1, 2);
-            NumButtons[8] = STL::Button(STL::ARGB(200), "8", Temp, Temp + BUTTON_SIZE);
-            NumButtons[8].Scale = 2;
-            
-            Temp = GetButtonPosition(2, 2);
-            NumButtons[9] = STL::Button(STL::ARGB(200), "9", Temp, Temp + BUTTON_SIZE);
-            NumButtons[9].Scale = 2;
+            auto NewButton = [](uint8_t X, uint8_t Y, const char* Text)
+            {
+                STL::Point TopLeft = GetButtonPosition(X, Y);
+                return Widgets.AddButton(0, Text, TopLeft, TopLeft + BUTTON_SIZE, STL::ARGB(200), 2);
+            };
+
+            MulButton = NewButton(3, 0, "*");
+            SubButton = NewButton(3, 1, "-");
+            AddButton = NewButton(3, 2, "+");
+            DivButton = NewButton(0, 3, "/");
+            PointButton = NewButton(2, 3, ".");
+            EqualButton = NewButton(3, 3, "=");
+
+            NumButtons[0] = NewButton(1, 3, "0");
+            NumButtons[1] = NewButton(0, 0, "1");
+            NumButtons[2] = NewButton(1, 0, "2");
+            NumButtons[3] = NewButton(2, 0, "3");
+            NumButtons[4] = NewButton(0, 1, "4");
+            NumButtons[5] = NewButton(1, 1, "5");
+            NumButtons[6] = NewButton(2, 1, "6");
+            NumButtons[7] = NewButton(0, 2, "7");
+            NumButtons[8] = NewButton(1, 2, "8");
+            NumButtons[9] = NewButton(2, 2, "9");
         }
         break;
         case STL::PROM::DRAW:
         {
-            STL::Framebuffer* Buffer = (STL::Framebuffer*)Input;
-
-            Buffer->DrawRect(STL::Point(0, 0), STL::Point(Buffer->Width, Buffer->Height), STL::ARGB(200));
-
-            Label.Draw(Buffer);
-
-            AddButton.Draw(Buffer);
-            SubButton.Draw(Buffer);
-            MulButton.Draw(Buffer);
-            DivButton.Draw(Buffer);
-
-            EqualButton.Draw(Buffer);
-            PointButton.Draw(Buffer);
-
-            for (int i = 0; i < 10; i++)
-            {
-                NumButtons[i].Draw(Buffer);
-            }
+            Widgets.Draw((STL::DINFO*)Input);
+        }
+        break;
+        case STL::PROM::CLEAR:
+        {
+            Widgets.InvalidateAll();
+        }
+        break;
+        case STL::PROM::KILL:
+        {
+            Widgets.Release();
         }
         break;
         case STL::PROM::KEYPRESS:
@@ -157,69 +111,74 @@ namespace Calculator
             {
                 if (ClearLabel)
                 {
-                    Label.Text = Key;
+                    Widgets.SetText(Label, "");
+                    Widgets.Get(Label).Text += Key;
                     ClearLabel = false; 
                 }
-                else if (Label.Text.Length() < LABEL_SIZE.X / 16 - 1)
+                else if (Widgets.Get(Label).Text.Length() < LABEL_SIZE.X / 16 - 1)
                 {
-                    Label.Text += Key;     
+                    Widgets.Get(Label).Text += Key;     
+                    Widgets.Invalidate(Label);
                 }
             }*/
             
-            return STL::PROR::DRAW;
+            return Widgets.IsDirty() ? STL::PROR::DRAW : STL::PROR::SUCCESS;
         }
         break;        
         case STL::PROM::MOUSE:
         {
             STL::MINFO MouseInfo = *(STL::MINFO*)Input;
 
+            STL::WidgetID Pressed = Widgets.HandleMouse(MouseInfo);
+            STL::String& Text = Widgets.Get(Label).Text;
+
             for (int i = 0; i < 10; i++)
             {
-                if (NumButtons[i].IsPressed(MouseInfo))
+                if (Pressed == NumButtons[i])
                 {
                     if (ClearLabel)
                     {
-                        Label.Text = NumButtons[i].Text;
+                        Text = Widgets.Get(NumButtons[i]).Text;
                         ClearLabel = false; 
                     }
-                    else if (Label.Text.Length() < (uint32_t)LABEL_SIZE.X / 16 - 1)
+                    else if (Text.Length() < (uint32_t)LABEL_SIZE.X / 16 - 1)
                     {
-                        Label.Text += NumButtons[i].Text;     
+                        Text += Widgets.Get(NumButtons[i]).Text;     
                     }
                 }
             }
 
-            if (EqualButton.IsPressed(MouseInfo))
+            if (Pressed == EqualButton)
             {
                 if (PreviousOperator == '+')
                 {
-                    uint64_t NewNum = PreviousNum + STL::ToInt(Label.Text.cstr());
-                    Label.Text = STL::ToString(NewNum);     
+                    uint64_t NewNum = PreviousNum + STL::ToInt(Text.cstr());
+                    Text = STL::ToString(NewNum);     
                     PreviousNum = 0;   
                 }
                 else if (PreviousOperator == '-')
                 {
-                    uint64_t NewNum = PreviousNum - STL::ToInt(Label.Text.cstr());
-                    Label.Text = STL::ToString(NewNum);     
+                    uint64_t NewNum = PreviousNum - STL::ToInt(Text.cstr());
+                    Text = STL::ToString(NewNum);     
                     PreviousNum = 0;               
                 }
                 else if (PreviousOperator == '*')
                 {
-                    uint64_t NewNum = PreviousNum * STL::ToInt(Label.Text.cstr());
-                    Label.Text = STL::ToString(NewNum); 
+                    uint64_t NewNum = PreviousNum * STL::ToInt(Text.cstr());
+                    Text = STL::ToString(NewNum); 
                     PreviousNum = 0;               
                 }
                 else if (PreviousOperator == '/')
                 {
-                    uint64_t Devisor = STL::ToInt(Label.Text.cstr());
+                    uint64_t Devisor = STL::ToInt(Text.cstr());
                     if (Devisor != 0)
                     {
                         uint64_t NewNum = PreviousNum / Devisor;
-                        Label.Text = STL::ToString(NewNum);                         
+                        Text = STL::ToString(NewNum);                         
                     }
                     else 
                     {
-                        Label.Text = "DIV BY ZERO!";
+                        Text = "DIV BY ZERO!";
                     }
                     PreviousNum = 0;               
                 }
@@ -228,55 +187,60 @@ namespace Calculator
                 PreviousOperator = 0;
             }
 
-            if (PointButton.IsPressed(MouseInfo))
+            if (Pressed == PointButton)
             {
                 
             }
 
-            if (AddButton.IsPressed(MouseInfo))
+            if (Pressed == AddButton)
             {
-                uint64_t NewNum = PreviousNum + STL::ToInt(Label.Text.cstr());
-                Label.Text = STL::ToString(NewNum);
+                uint64_t NewNum = PreviousNum + STL::ToInt(Text.cstr());
+                Text = STL::ToString(NewNum);
                 ClearLabel = true;
                 PreviousOperator = '+';
                 PreviousNum = NewNum;
             }
 
-            if (SubButton.IsPressed(MouseInfo))
+            if (Pressed == SubButton)
             {
-                uint64_t NewNum = PreviousNum - STL::ToInt(Label.Text.cstr());
-                Label.Text = STL::ToString(NewNum);
+                uint64_t NewNum = PreviousNum - STL::ToInt(Text.cstr());
+                Text = STL::ToString(NewNum);
                 ClearLabel = true;
                 PreviousOperator = '-';
                 PreviousNum = NewNum;
             }
 
-            if (MulButton.IsPressed(MouseInfo))
+            if (Pressed == MulButton)
             {
-                uint64_t NewNum = STL::ToInt(Label.Text.cstr());
-                Label.Text = STL::ToString(PreviousNum * NewNum);
+                uint64_t NewNum = STL::ToInt(Text.cstr());
+                Text = STL::ToString(PreviousNum * NewNum);
                 ClearLabel = true;
                 PreviousOperator = '*';
                 PreviousNum = NewNum;              
             }
 
-            if (DivButton.IsPressed(MouseInfo))
+            if (Pressed == DivButton)
             {
-                uint64_t NewNum = STL::ToInt(Label.Text.cstr());
+                uint64_t NewNum = STL::ToInt(Text.cstr());
                 if (NewNum != 0)
                 {
-                    Label.Text = STL::ToString(PreviousNum / NewNum);
+                    Text = STL::ToString(PreviousNum / NewNum);
                 }
                 else 
                 {
-                    Label.Text = "DIV BY ZERO!";
+                    Text = "DIV BY ZERO!";
                 }
                 ClearLabel = true;
                 PreviousOperator = '/';
                 PreviousNum = NewNum;
             }
 
-            return STL::PROR::DRAW;
+            if (Pressed != WIDGET_NONE)
+            {
+                Widgets.Invalidate(Label);
+            }
+
+            return Widgets.IsDirty() ? STL::PROR::DRAW : STL::PROR::SUCCESS;
         }
         break;
         default:
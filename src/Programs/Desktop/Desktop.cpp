@@ -24,7 +24,7 @@ namespace Desktop
         if (AnimationCounter > 60)
         {
             STL::System("set drawmouse 1");
-            STL::System("start topbar");
+            STL::Start(STL::PROG::TOPBAR);
 
             StartAnimation(nullptr);
 
@@ -54,7 +54,7 @@ namespace Desktop
         break;
         case STL::PROM::DRAW:
         {
-            STL::Framebuffer* Buffer = (STL::Framebuffer*)Input;
+            STL::Framebuffer* Buffer = ((STL::DINFO*)Input)->Buffer;
 
             if (CurrentAnimation != nullptr)
             {
@@ -3,14 +3,15 @@
 #include "STL/System/System.h"
 #include "STL/Graphics/Framebuffer.h"
 #include "STL/String/cstr.h"
-#include "STL/GUI/Button.h"
+#include "STL/GUI/Widget.h"
 
 namespace StartMenu
 {        
     struct StartableProcess
     {
-        STL::Button Button;
+        STL::WidgetID Button;
         STL::String Name;
+        STL::PROG Program;
 
         StartableProcess() = default;
     };
@@ -18,21 +19,7 @@ namespace StartMenu
     const uint64_t StartableProcessesAmount = 2;
     StartableProcess StartableProcesses[StartableProcessesAmount];
 
-    void(*CurrentAnimation)(STL::Framebuffer*);
-    uint64_t AnimationCounter = 0;
-
-    inline void StartAnimation(void(*Animation)(STL::Framebuffer*))
-    {
-        AnimationCounter = 0;
-        CurrentAnimation = Animation;
-    }
-
-    void OpenAnimation(STL::Framebuffer* Buffer)
-    {
-        Buffer->DrawRaisedRect(STL::Point(RAISEDWIDTH, RAISEDWIDTH), STL::Point(Buffer->Width - RAISEDWIDTH, Buffer->Height - RAISEDWIDTH), STL::ARGB(200));
-    
-        StartAnimation(nullptr);
-    }
+    STL::WidgetTree Widgets;
 
     STL::PROR Procedure(STL::PROM Message, STL::PROI Input)
     {    
@@ -43,72 +30,59 @@ namespace StartMenu
             STL::PINFO* Info = (STL::PINFO*)Input;
 
             StartableProcesses[0].Name = "Calculator";
+            StartableProcesses[0].Program = STL::PROG::CALCULATOR;
             StartableProcesses[1].Name = "Terminal";
-
-            for (uint64_t i = 0; i < StartableProcessesAmount; i++)
-            {
-                STL::Point TopLeft = STL::Point(RAISEDWIDTH * 3, RAISEDWIDTH * ((i + 1) * 3) + i * (RAISEDWIDTH * 2 + 25));
-                STL::Point BottomRight = STL::Point(200 - RAISEDWIDTH * 3, RAISEDWIDTH * ((i + 1) * 3) + ((i + 1)) * (RAISEDWIDTH * 2 + 25));
-
-                StartableProcesses[i].Button = STL::Button(STL::ARGB(200), StartableProcesses[i].Name.cstr(), TopLeft, BottomRight);
-            }
+            StartableProcesses[1].Program = STL::PROG::TERMINAL;
 
             Info->Type = STL::PROT::FRAMELESSWINDOW;
             Info->Depth = 1;
             Info->Left = 25;
             Info->Top = 50;
             Info->Width = 200;
-            Info->Height = StartableProcesses[StartableProcessesAmount - 1].Button.BottomRight.Y + RAISEDWIDTH * 3;
+            Info->Height = RAISEDWIDTH * (StartableProcessesAmount * 3) + StartableProcessesAmount * (RAISEDWIDTH * 2 + 25) + RAISEDWIDTH * 3;
             Info->Title = "StartMenu";
+            Info->Opacity = 224; //Lets the desktop show through the menu.
 
-            StartAnimation(OpenAnimation);
-        }
-        break;
-        case STL::PROM::DRAW:
-        {
-            STL::Framebuffer* Buffer = (STL::Framebuffer*)Input;
-
-            if (CurrentAnimation != nullptr)
-            {
-                CurrentAnimation(Buffer);
-                AnimationCounter++;
-
-                if (CurrentAnimation == nullptr)
-                {
-                    return STL::PROR::DRAW;
-                }
-            }   
+            Widgets.Init(STL::Point(Info->Width, Info->Height), STL::ARGB(200), STL::LabelStyle::Raised);
 
             for (uint64_t i = 0; i < StartableProcessesAmount; i++)
             {
-                StartableProcesses[i].Button.Draw(Buffer);
+                STL::Point TopLeft = STL::Point(RAISEDWIDTH * 3, RAISEDWIDTH * ((i + 1) * 3) + i * (RAISEDWIDTH * 2 + 25));
+                STL::Point BottomRight = STL::Point(200 - RAISEDWIDTH * 3, RAISEDWIDTH * ((i + 1) * 3) + ((i + 1)) * (RAISEDWIDTH * 2 + 25));
+
+                StartableProcesses[i].Button = Widgets.AddButton(0, StartableProcesses[i].Name.cstr(), TopLeft, BottomRight, STL::ARGB(200));
             }
         }
         break;
-        case STL::PROM::TICK:
-        {            
-            if (CurrentAnimation != nullptr)
-            {
-                return STL::PROR::DRAW;
-            }
+        case STL::PROM::DRAW:
+        {
+            Widgets.Draw((STL::DINFO*)Input);
+        }
+        break;
+        case STL::PROM::CLEAR:
+        {
+            Widgets.InvalidateAll();
+        }
+        break;
+        case STL::PROM::KILL:
+        {
+            Widgets.Release();
         }
         break;
         case STL::PROM::MOUSE:
         {
             STL::MINFO MouseInfo = *(STL::MINFO*)Input;
 
+            STL::WidgetID Pressed = Widgets.HandleMouse(MouseInfo);
             for (uint64_t i = 0; i < StartableProcessesAmount; i++)
             {
-                if (StartableProcesses[i].Button.IsPressed(MouseInfo))
+                if (Pressed == StartableProcesses[i].Button)
                 {
-                    STL::String Command;
-                    Command = "start ";
-                    Command += StartableProcesses[i].Name;
-                    STL::System(Command.cstr());
+                    STL::Start(StartableProcesses[i].Program);
                 }
             }
 
-            return STL::PROR::DRAW;
+            return Widgets.IsDirty() ? STL::PROR::DRAW : STL::PROR::SUCCESS;
         }
         break;
         default:
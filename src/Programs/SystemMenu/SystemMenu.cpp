@@ -41,6 +41,7 @@ namespace SystemMenu
             Info->Width = 200;
             Info->Height = RAISEDWIDTH * 12 + 3 * (RAISEDWIDTH * 2 + 25);
             Info->Title = "SystemMenu";
+            Info->Opacity = 224;
 
             TTYButton = STL::Button(STL::ARGB(200), "To TTY", STL::Point(RAISEDWIDTH * 3, RAISEDWIDTH * 3), 
                                         STL::Point(Info->Width - RAISEDWIDTH * 3, RAISEDWIDTH * 3 + (RAISEDWIDTH * 2 + 25)));
@@ -54,7 +55,7 @@ namespace SystemMenu
         break;
         case STL::PROM::DRAW:
         {
-            STL::Framebuffer* Buffer = (STL::Framebuffer*)Input;
+            STL::Framebuffer* Buffer = ((STL::DINFO*)Input)->Buffer;
 
             if (CurrentAnimation != nullptr)
             {
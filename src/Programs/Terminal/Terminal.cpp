@@ -1,7 +1,7 @@
 #include "Terminal.h"
 
 #include "STL/Graphics/Framebuffer.h"
-#include "STL/String/String.h"
+#include "STL/Console/Console.h"
 #include "STL/String/cstr.h"
 #include "STL/System/System.h"
 
@@ -14,16 +14,14 @@ namespace Terminal
     uint64_t PrevTick = 0;
 
     char Command[64];
-    STL::String Text;
-    STL::Point CursorPos = STL::Point(0, 0);
+    STL::Console Console;
 
-    bool RedrawText = false;
     bool DrawUnderline = false;
-    bool ClearCommand = false;
+    bool DrawEdge = false;
 
     void Write(const char* cstr)
     {
-        Text += cstr;
+        Console.Write(cstr);
     }
 
     STL::PROR Procedure(STL::PROM Message, STL::PROI Input)
@@ -41,9 +39,8 @@ namespace Terminal
             Info->Height = 650;
             Info->Title = "Terminal";
 
-            Text = "";
             Command[0] = 0;
-            CursorPos = STL::Point(0, 0);
+            Console.Init((Info->Width - NEWLINE_OFFSET * 2) / 8, (Info->Height - NEWLINE_OFFSET * 2) / 16);
             
             Write("\n\r");
             Write("Welcome to the Terminal of ");
@@ -54,7 +51,7 @@ namespace Terminal
             Write("\n\r");
             Write("> ");
 
-            RedrawText = true;
+            DrawEdge = true;
         }
         break;
         case STL::PROM::TICK:
@@ -72,72 +69,23 @@ namespace Terminal
         break;
         case STL::PROM::DRAW:
         {
-            STL::Framebuffer* Buffer = (STL::Framebuffer*)Input;
+            STL::Framebuffer* Buffer = ((STL::DINFO*)Input)->Buffer;
 
-            //Clear command
-            for (uint32_t i = 0; i < STL::Length(Command) + 2; i++)
+            //Draw Edge
+            if (DrawEdge)
             {
-                Buffer->PutChar(' ', STL::Point(CursorPos.X + 8 * i, CursorPos.Y), 1, STL::ARGB(255), STL::ARGB(0));
-            }            
-
-            //Scroll up
-            if (CursorPos.Y + STL::LineAmount(Text.cstr()) * 16 + NEWLINE_OFFSET * 2 > Buffer->Height)
-            {
-                uint64_t Amount = (CursorPos.Y + STL::LineAmount(Text.cstr()) * 16 + NEWLINE_OFFSET * 2) - Buffer->Height;
-                
-                for (uint32_t y = NEWLINE_OFFSET; y < Buffer->Height - NEWLINE_OFFSET - Amount; y++)
-                {
-                    for (uint32_t x = NEWLINE_OFFSET; x < Buffer->Width - NEWLINE_OFFSET; x++)
-                    {
-                        *(STL::ARGB*)((uint64_t)Buffer->Base + x * 4 + y * Buffer->PixelsPerScanline * 4) = 
-                        *(STL::ARGB*)((uint64_t)Buffer->Base + x * 4 + (y + Amount) * Buffer->PixelsPerScanline * 4);
-                    }
-                }
-
-                for (uint32_t y = Buffer->Height - NEWLINE_OFFSET - Amount; y < Buffer->Height; y++)
-                {
-                    for (uint32_t x = NEWLINE_OFFSET; x < Buffer->Width - NEWLINE_OFFSET; x++)
-                    {
-                        *(STL::ARGB*)((uint64_t)Buffer->Base + x * 4 + y * Buffer->PixelsPerScanline * 4) = STL::ARGB(0);
-                    }
-                }
-
-                CursorPos.Y -= Amount; 
-                if (CursorPos.Y < 0)
-                {
-                    CursorPos.Y = 0;
-                }
-            }
-
-            if (RedrawText)
-            {               
-                //Print text 
-                Buffer->Print(Text.cstr(), CursorPos, 1, STL::ARGB(255), STL::ARGB(0), NEWLINE_OFFSET);
-                Text = "";
-                Command[0] = 0;
-                RedrawText = false;
-
-                //Draw Edge
                 Buffer->DrawRect(STL::Point(0, 0), STL::Point(Buffer->Width, RAISEDWIDTH  * 2), STL::ARGB(200));
                 Buffer->DrawRect(STL::Point(0, 0), STL::Point(RAISEDWIDTH * 2, Buffer->Height), STL::ARGB(200));
                 Buffer->DrawRect(STL::Point(Buffer->Width - RAISEDWIDTH * 2, 0), STL::Point(Buffer->Width, Buffer->Height), STL::ARGB(200));
                 Buffer->DrawRect(STL::Point(0, Buffer->Height - RAISEDWIDTH * 2), STL::Point(Buffer->Width, Buffer->Height), STL::ARGB(200));
                 Buffer->DrawSunkenRectEdge(STL::Point(RAISEDWIDTH * 2, RAISEDWIDTH * 2), STL::Point(Buffer->Width - RAISEDWIDTH * 2, Buffer->Height - RAISEDWIDTH  * 2));
+                DrawEdge = false;
             }
 
-            //Print command
-            STL::Point Temp = CursorPos;
-            Buffer->Print(Command, Temp, 1, STL::ARGB(255), STL::ARGB(0), NEWLINE_OFFSET);
-
-            //Print underline
-            if (DrawUnderline)
-            {
-                Buffer->PutChar('_', Temp, 1, STL::ARGB(255), STL::ARGB(0));
-            }
-            else
-            {
-                Buffer->PutChar(' ', Temp, 1, STL::ARGB(255), STL::ARGB(0));
-            }
+            //Only the lines that changed are drawn
+            Console.Resize((Buffer->Width - NEWLINE_OFFSET * 2) / 8, (Buffer->Height - NEWLINE_OFFSET * 2) / 16);
+            Console.SetCursorVisible(DrawUnderline);
+            Console.Draw(Buffer, STL::Point(NEWLINE_OFFSET, NEWLINE_OFFSET));
         }
         break;
         case STL::PROM::KEYPRESS:
@@ -146,11 +94,10 @@ namespace Terminal
 
             if (Key == ENTER)
             {   
-                Text += Command;
-                Text += "\n\r";
-                Text += STL::System(Command);
-                Text += "\n\r> ";
-                RedrawText = true;
+                Write("\n\r");
+                Write(STL::System(Command));
+                Write("\n\r> ");
+                Command[0] = 0;
             }
             else if (Key == BACKSPACE)
             {
@@ -160,32 +107,45 @@ namespace Terminal
                 {
                     Command[CommandLength - 1] = 0;
                     Command[CommandLength] = 0;
+                    Write("\b \b");
                 }
             }
-            else
+            else if (Key >= ' ' && Key < 127)
             {               
                 uint64_t CommandLength = STL::Length(Command);
                 if (CommandLength < 63)
                 {
                     Command[CommandLength] = Key;
                     Command[CommandLength + 1] = 0;
+                    Console.Write((char)Key);
                 }
             }
 
             return STL::PROR::DRAW;
         }
         break;
+        case STL::PROM::OUTPUT:
+        {
+            //Comes after the prompt, which is written again with whatever was typed since.
+            Write("\n\r");
+            Write((const char*)Input);
+            Write("\n\r> ");
+            Write(Command);
+
+            return STL::PROR::DRAW;
+        }
+        break;
         case STL::PROM::CLEAR:
         {
-            Text = "";
             Command[0] = 0;
-            CursorPos = STL::Point(0, 0);
+            Console.Clear();
+            DrawEdge = true;
         }
         break;
         case STL::PROM::KILL:
         {
-            Text = "";
             Command[0] = 0;
+            Console.Release();
         }
         break;
         default:
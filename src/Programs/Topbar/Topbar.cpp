@@ -2,6 +2,7 @@
 
 #include "STL/Graphics/Framebuffer.h"
 #include "STL/System/System.h"
+#include "STL/System/SystemPage.h"
 #include "STL/GUI/Button.h"
 #include "STL/GUI/Label.h"
 
@@ -91,7 +92,7 @@ namespace Topbar
         break;
         case STL::PROM::DRAW:
         {
-            STL::Framebuffer* Buffer = (STL::Framebuffer*)Input;
+            STL::Framebuffer* Buffer = ((STL::DINFO*)Input)->Buffer;
             
             if (CurrentAnimation != nullptr)
             {
@@ -115,9 +116,26 @@ namespace Topbar
 
             if (CurrentAnimation != nullptr || CurrentTick % 100 == 0)
             {
-                TimeDateLabel.Text = STL::System("time");
-                TimeDateLabel.Text += " ";
-                TimeDateLabel.Text += STL::System("date");
+                STL::TINFO Time;
+                STL::GetSystemPage()->GetTime(&Time);
+
+                //HH:MM:SS DD/MM/YYYY
+                char TimeDate[20];
+                uint8_t Fields[] = {Time.Hour, Time.Minute, Time.Second, Time.Day, Time.Month, (uint8_t)(Time.Year / 100), (uint8_t)(Time.Year % 100)};
+                const char Separators[] = {':', ':', ' ', '/', '/', 0, 0};
+                char* CurrentLocation = TimeDate;
+                for (uint64_t i = 0; i < sizeof(Fields); i++)
+                {
+                    *CurrentLocation++ = '0' + Fields[i] / 10;
+                    *CurrentLocation++ = '0' + Fields[i] % 10;
+                    if (Separators[i] != 0)
+                    {
+                        *CurrentLocation++ = Separators[i];
+                    }
+                }
+                *CurrentLocation = 0;
+
+                TimeDateLabel.Text = TimeDate;
 
                 return STL::PROR::DRAW;
             }
@@ -131,13 +149,11 @@ namespace Topbar
             {
                 if (SystemMenuID == -1)
                 {
-                    SystemMenuID = STL::ToInt(STL::System("start systemmenu"));
+                    SystemMenuID = STL::Start(STL::PROG::SYSTEMMENU);
                 }
                 else
                 {
-                    STL::String Command = "kill ";
-                    Command += STL::ToString(SystemMenuID);
-                    STL::System(Command.cstr());
+                    STL::Kill(SystemMenuID);
                     SystemMenuID = -1;
                 }
             }
@@ -146,13 +162,11 @@ namespace Topbar
             {
                 if (StartMenuID == -1)
                 {
-                    StartMenuID = STL::ToInt(STL::System("start startmenu"));
+                    StartMenuID = STL::Start(STL::PROG::STARTMENU);
                 }
                 else
                 {
-                    STL::String Command = "kill ";
-                    Command += STL::ToString(StartMenuID);
-                    STL::System(Command.cstr());
+                    STL::Kill(StartMenuID);
                     StartMenuID = -1;
                 }
             }
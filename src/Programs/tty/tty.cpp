@@ -1,7 +1,7 @@
 #include "tty.h"
 
 #include "STL/Graphics/Framebuffer.h"
-#include "STL/String/String.h"
+#include "STL/Console/Console.h"
 #include "STL/String/cstr.h"
 #include "STL/System/System.h"
 
@@ -12,16 +12,13 @@ namespace tty
     uint64_t PrevTick = 0;
 
     char Command[64];
-    STL::String Text;
-    STL::Point CursorPos = STL::Point(0, 0);
+    STL::Console Console;
 
-    bool RedrawText = false;
     bool DrawUnderline = false;
-    bool ClearCommand = false;
 
     void Write(const char* cstr)
     {
-        Text += cstr;
+        Console.Write(cstr);
     }
 
     STL::PROR Procedure(STL::PROM Message, STL::PROI Input)
@@ -35,9 +32,8 @@ namespace tty
             Info->Title = "tty";
             Info->Depth = 0;
 
-            Text = "";
             Command[0] = 0;
-            CursorPos = STL::Point(0, 0);
+            Console.Init(CONSOLE_MAX_COLUMNS, 1);
             
             Write("\n\r");
             Write("Welcome to the tty of ");
@@ -47,8 +43,6 @@ namespace tty
             Write(STL::System("sysfetch"));
             Write("\n\r");
             Write("> ");
-
-            RedrawText = true;
         }
         break;
         case STL::PROM::TICK:
@@ -66,52 +60,11 @@ namespace tty
         break;
         case STL::PROM::DRAW:
         {
-            STL::Framebuffer* Buffer = (STL::Framebuffer*)Input;
-
-            if (RedrawText)
-            {                
-                for (uint32_t i = 0; i < STL::Length(Command) + 2; i++)
-                {
-                    Buffer->PutChar(' ', STL::Point(CursorPos.X + 8 * i, CursorPos.Y), 1, STL::ARGB(255), STL::ARGB(0));
-                }
-
-                if (CursorPos.Y + STL::LineAmount(Text.cstr()) * 16 > Buffer->Height)
-                {
-                    uint64_t Amount = (CursorPos.Y + STL::LineAmount(Text.cstr()) * 16) - Buffer->Height;
-                    Buffer->ScrollUp(Amount);
-                    CursorPos.Y -= Amount; 
-                    if (CursorPos.Y < 0)
-                    {
-                        CursorPos.Y = 0;
-                    }
-                }
+            STL::Framebuffer* Buffer = ((STL::DINFO*)Input)->Buffer;
 
-                Buffer->Print(Text.cstr(), CursorPos, 1, STL::ARGB(255), STL::ARGB(0));
-                Text = "";
-                Command[0] = 0;
-                RedrawText = false;
-            }
-
-            if (ClearCommand)
-            {
-                for (uint32_t i = 0; i < STL::Length(Command) + 2; i++)
-                {
-                    Buffer->PutChar(' ', STL::Point(CursorPos.X + 8 * i, CursorPos.Y), 1, STL::ARGB(255), STL::ARGB(0));
-                }
-                ClearCommand = false;
-            }
-            
-            STL::Point Temp = CursorPos;
-            Buffer->Print(Command, Temp, 1, STL::ARGB(255), STL::ARGB(0));
-
-            if (DrawUnderline)
-            {
-                Buffer->PutChar('_', Temp, 1, STL::ARGB(255), STL::ARGB(0));
-            }
-            else
-            {
-                Buffer->PutChar(' ', Temp, 1, STL::ARGB(255), STL::ARGB(0));
-            }
+            Console.Resize(Buffer->Width / 8, Buffer->Height / 16);
+            Console.SetCursorVisible(DrawUnderline);
+            Console.Draw(Buffer, STL::Point(0, 0));
         }
         break;
         case STL::PROM::KEYPRESS:
@@ -120,11 +73,10 @@ namespace tty
 
             if (Key == ENTER)
             {   
-                Text += Command;
-                Text += "\n\r";
-                Text += STL::System(Command);
-                Text += "\n\r> ";
-                RedrawText = true;
+                Write("\n\r");
+                Write(STL::System(Command));
+                Write("\n\r> ");
+                Command[0] = 0;
             }
             else if (Key == BACKSPACE)
             {
@@ -134,33 +86,44 @@ namespace tty
                 {
                     Command[CommandLength - 1] = 0;
                     Command[CommandLength] = 0;
-                    ClearCommand = true;
+                    Write("\b \b");
                 }
             }
-            else
+            else if (Key >= ' ' && Key < 127)
             {               
                 uint64_t CommandLength = STL::Length(Command);
                 if (CommandLength < 63)
                 {
                     Command[CommandLength] = Key;
                     Command[CommandLength + 1] = 0;
+                    Console.Write((char)Key);
                 }
             }
 
             return STL::PROR::DRAW;
         }
         break;
+        case STL::PROM::OUTPUT:
+        {
+            //Comes after the prompt, which is written again with whatever was typed since.
+            Write("\n\r");
+            Write((const char*)Input);
+            Write("\n\r> ");
+            Write(Command);
+
+            return STL::PROR::DRAW;
+        }
+        break;
         case STL::PROM::CLEAR:
         {
-            Text = "";
             Command[0] = 0;
-            CursorPos = STL::Point(0, 0);
+            Console.Clear();
         }
         break;
         case STL::PROM::KILL:
         {
-            Text = "";
             Command[0] = 0;
+            Console.Release();
         }
         break;
         default:
@@ -0,0 +1,137 @@
+#include "RAMFS.h"
+
+#include "STL/String/cstr.h"
+
+#define TAR_BLOCK_SIZE 512
+
+#define TAR_TYPE_FILE '0'
+#define TAR_TYPE_OLDFILE '\0'
+
+namespace RAMFS
+{
+    struct TarHeader
+    {
+        char Name[100];
+        char Mode[8];
+        char UID[8];
+        char GID[8];
+        char Size[12];
+        char ModifiedTime[12];
+        char CheckSum[8];
+        char Type;
+        char LinkName[100];
+        char Magic[6];
+        char Version[2];
+        char UserName[32];
+        char GroupName[32];
+        char DeviceMajor[8];
+        char DeviceMinor[8];
+        char Prefix[155];
+        char Padding[12];
+    } __attribute__((packed));
+
+    uint8_t* Base = nullptr;
+    uint64_t Size = 0;
+
+    uint64_t Offset = 0;
+
+    uint64_t ParseOctal(const char* String, uint64_t Length)
+    {
+        uint64_t Result = 0;
+        for (uint64_t i = 0; i < Length && String[i] >= '0' && String[i] <= '7'; i++)
+        {
+            Result = Result * 8 + (String[i] - '0');
+        }
+        return Result;
+    }
+
+    /// <summary>
+    /// Reads the header at Offset and moves Offset to the next header, returns false at the end of the archive.
+    /// </summary>
+    bool Next(uint64_t& Offset, File& Out)
+    {
+        while (Offset + TAR_BLOCK_SIZE <= Size)
+        {
+            TarHeader* Header = (TarHeader*)(Base + Offset);
+
+            if (Header->Name[0] == 0)
+            {
+                return false;
+            }
+
+            uint64_t FileSize = ParseOctal(Header->Size, sizeof(Header->Size));
+            uint64_t DataOffset = Offset + TAR_BLOCK_SIZE;
+
+            Offset = DataOffset + ((FileSize + TAR_BLOCK_SIZE - 1) / TAR_BLOCK_SIZE) * TAR_BLOCK_SIZE;
+
+            if ((Header->Type != TAR_TYPE_FILE && Header->Type != TAR_TYPE_OLDFILE) || DataOffset + FileSize > Size)
+            {
+                continue;
+            }
+
+            Out.Name = Header->Name;
+            Out.Data = Base + DataOffset;
+            Out.Size = FileSize;
+            return true;
+        }
+
+        return false;
+    }
+
+    void Init(InitrdInfo* Initrd)
+    {
+        Base = (uint8_t*)Initrd->Base;
+        Size = Initrd->Size;
+
+        ResetEnumeration();
+    }
+
+    bool Find(const char* Path, File& Out)
+    {
+        uint64_t SearchOffset = 0;
+        while (Next(SearchOffset, Out))
+        {
+            if (STL::Compare(Out.Name, Path))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void ResetEnumeration()
+    {
+        Offset = 0;
+    }
+
+    bool Enumerate(File& Out)
+    {
+        if (Next(Offset, Out))
+        {
+            return true;
+        }
+
+        Offset = 0;
+        return false;
+    }
+
+    uint64_t GetFileAmount()
+    {
+        uint64_t Amount = 0;
+
+        File Temp;
+        uint64_t SearchOffset = 0;
+        while (Next(SearchOffset, Temp))
+        {
+            Amount++;
+        }
+
+        return Amount;
+    }
+
+    uint64_t GetSize()
+    {
+        return Size;
+    }
+}
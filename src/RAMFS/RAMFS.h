@@ -0,0 +1,46 @@
+#pragma once
+
+#include <stdint.h>
+
+/// <summary>
+/// The initial ramdisk loaded by the bootloader, a ustar archive in one contiguous allocation.
+/// </summary>
+struct InitrdInfo
+{
+    void* Base;
+    uint64_t Size;
+};
+
+namespace RAMFS
+{
+    /// <summary>
+    /// A file in the initrd, Data points directly into the archive so no copy is ever made.
+    /// </summary>
+    struct File
+    {
+        const char* Name;
+        void* Data;
+        uint64_t Size;
+    };
+
+    void Init(InitrdInfo* Initrd);
+
+    /// <summary>
+    /// Sets Out to the file at Path and returns true, or returns false if no such file exists.
+    /// </summary>
+    bool Find(const char* Path, File& Out);
+
+    /// <summary>
+    //// Starts over enumeration to the first file.
+    /// </summary>
+    void ResetEnumeration();
+
+    /// <summary>
+    //// Sets out to be the next file and returns true untill there are no more files then it returns false.
+    /// </summary>
+    bool Enumerate(File& Out);
+
+    uint64_t GetFileAmount();
+
+    uint64_t GetSize();
+}
@@ -1,18 +1,44 @@
 #include "Renderer.h"
 
 #include "STL/String/cstr.h"
+#include "STL/Graphics/Graphics.h"
 
+#include "RAMFS/RAMFS.h"
 #include "PIT/PIT.h"
 #include "Memory/Heap.h"
 #include "Input/Mouse.h"
+#include "CPU/CPU.h"
 
 #include <stdint.h>
 
+#define PSF_MAGIC0 0x36
+#define PSF_MAGIC1 0x04
+#define MAX_FONTS 16
+
+#define CURSOR_SIZE 12
+#define MAX_PAGES 2
+
 namespace Renderer
 {
     STL::Framebuffer* Frontbuffer;
     STL::Framebuffer Backbuffer;
 
+    STL::Framebuffer Pages[MAX_PAGES];
+    uint32_t PageAmount = 0;
+    uint32_t VisiblePage = 0;
+    void (*FlipPage)(uint32_t Page) = nullptr;
+
+    /// <summary>
+    /// Called with every area of the frontbuffer that changed, for displays that do not scan out guest memory directly.
+    /// </summary>
+    void (*FlushArea)(STL::Point TopLeft, STL::Point BottomRight) = nullptr;
+
+    /// <summary>
+    /// The area of each page that is older than the backbuffer, empty if TopLeft is not above and left of BottomRight.
+    /// </summary>
+    STL::Point DamageTopLeft[MAX_PAGES];
+    STL::Point DamageBottomRight[MAX_PAGES];
+
     STL::Point CursorPos;
 
     STL::ARGB Background;
@@ -20,10 +46,20 @@ namespace Renderer
 
     bool DrawMouse; 
     STL::Point OldMousePos;
+
+    STL::ARGB SaveUnder[CURSOR_SIZE * CURSOR_SIZE];
+    bool CursorDrawn = false;
+    volatile bool Swapping = false;
     
     void Init(STL::Framebuffer* Screenbuffer)
     {
-        Frontbuffer = Screenbuffer;
+        Pages[0] = *Screenbuffer;
+        PageAmount = 1;
+        VisiblePage = 0;
+        FlipPage = nullptr;
+        FlushArea = nullptr;
+
+        Frontbuffer = &Pages[0];
         Backbuffer = *Frontbuffer;
         Backbuffer.Base = (STL::ARGB*)Heap::Allocate(Backbuffer.Size);
 
@@ -36,6 +72,104 @@ namespace Renderer
         DrawMouse = false;
     }
 
+    void SetDisplay(STL::Framebuffer* NewPages, uint32_t NewPageAmount, void (*Flip)(uint32_t Page), void (*Flush)(STL::Point TopLeft, STL::Point BottomRight))
+    {
+        uint64_t Flags = CPU::DisableInterrupts();
+
+        PageAmount = NewPageAmount > MAX_PAGES ? MAX_PAGES : NewPageAmount;
+        for (uint32_t i = 0; i < PageAmount; i++)
+        {
+            Pages[i] = NewPages[i];
+        }
+        VisiblePage = 0;
+        FlipPage = PageAmount > 1 ? Flip : nullptr;
+        FlushArea = Flush;
+        Frontbuffer = &Pages[0];
+        CursorDrawn = false;
+
+        if (Backbuffer.Width != Frontbuffer->Width || Backbuffer.Height != Frontbuffer->Height)
+        {
+            Heap::Free(Backbuffer.Base);
+            Backbuffer.Width = Frontbuffer->Width;
+            Backbuffer.Height = Frontbuffer->Height;
+            Backbuffer.PixelsPerScanline = Frontbuffer->Width;
+            Backbuffer.Size = (uint64_t)Backbuffer.Width * Backbuffer.Height * 4;
+            Backbuffer.Base = (STL::ARGB*)Heap::Allocate(Backbuffer.Size);
+            Backbuffer.Clear();
+        }
+
+        CPU::RestoreInterrupts(Flags);
+
+        SwapBuffers();
+    }
+
+    /// <summary>
+    /// Grows the area from TopLeft to BottomRight to also cover the area from OtherTopLeft to OtherBottomRight, either may be empty.
+    /// </summary>
+    void UniteArea(STL::Point& TopLeft, STL::Point& BottomRight, STL::Point OtherTopLeft, STL::Point OtherBottomRight)
+    {
+        if (OtherTopLeft.X >= OtherBottomRight.X || OtherTopLeft.Y >= OtherBottomRight.Y)
+        {
+            return;
+        }
+
+        if (TopLeft.X >= BottomRight.X || TopLeft.Y >= BottomRight.Y)
+        {
+            TopLeft = OtherTopLeft;
+            BottomRight = OtherBottomRight;
+        }
+        else
+        {
+            TopLeft = STL::Point(STL::Min(TopLeft.X, OtherTopLeft.X), STL::Min(TopLeft.Y, OtherTopLeft.Y));
+            BottomRight = STL::Point(STL::Max(BottomRight.X, OtherBottomRight.X), STL::Max(BottomRight.Y, OtherBottomRight.Y));
+        }
+    }
+
+    void AddDamage(STL::Point TopLeft, STL::Point BottomRight)
+    {
+        TopLeft.X = STL::Clamp(TopLeft.X, (int32_t)0, (int32_t)Backbuffer.Width);
+        TopLeft.Y = STL::Clamp(TopLeft.Y, (int32_t)0, (int32_t)Backbuffer.Height);
+        BottomRight.X = STL::Clamp(BottomRight.X, (int32_t)0, (int32_t)Backbuffer.Width);
+        BottomRight.Y = STL::Clamp(BottomRight.Y, (int32_t)0, (int32_t)Backbuffer.Height);
+
+        if (TopLeft.X >= BottomRight.X || TopLeft.Y >= BottomRight.Y)
+        {
+            return;
+        }
+
+        for (uint32_t i = 0; i < PageAmount; i++)
+        {
+            UniteArea(DamageTopLeft[i], DamageBottomRight[i], TopLeft, BottomRight);
+        }
+    }
+
+    void LoadFonts(const char* Directory)
+    {
+        static STL::PSF_FONT FontStorage[MAX_FONTS];
+        static STL::PSF_FONT* Fonts[MAX_FONTS];
+        uint8_t FontAmount = 0;
+
+        RAMFS::File File;
+        RAMFS::ResetEnumeration();
+        while (RAMFS::Enumerate(File))
+        {
+            STL::PSF_HEADER* Header = (STL::PSF_HEADER*)File.Data;
+
+            if (!STL::StartsWith(File.Name, Directory) || File.Size < sizeof(STL::PSF_HEADER) || 
+                Header->magic[0] != PSF_MAGIC0 || Header->magic[1] != PSF_MAGIC1 || FontAmount >= MAX_FONTS)
+            {
+                continue;
+            }
+
+            FontStorage[FontAmount].PSF_header = Header;
+            FontStorage[FontAmount].glyphBuffer = (char*)File.Data + sizeof(STL::PSF_HEADER);
+            Fonts[FontAmount] = &FontStorage[FontAmount];
+            FontAmount++;
+        }
+
+        STL::SetFonts(Fonts, FontAmount);
+    }
+
     void PutChar(char chr, STL::Point Pos, uint8_t Scale)
     {
         Backbuffer.PutChar(chr, Pos, Scale, Foreground, Background);
@@ -51,62 +185,175 @@ namespace Renderer
         Backbuffer.PutChar(Chr, CursorPos, Scale, Foreground, Background);
     }
 
+    /// <summary>
+    /// Returns the width of row Y of the cursor at Pos, clipped to the screen.
+    /// </summary>
+    int32_t CursorRowWidth(STL::Point Pos, int32_t Y)
+    {
+        if (Pos.Y + Y >= (int32_t)Frontbuffer->Height)
+        {
+            return 0;
+        }
+
+        int32_t Width = CURSOR_SIZE - Y;
+        if (Pos.X + Width > (int32_t)Frontbuffer->Width)
+        {
+            Width = (int32_t)Frontbuffer->Width - Pos.X;
+        }
+        return Width < 0 ? 0 : Width;
+    }
+
+    /// <summary>
+    /// Adds the area covered by the cursor at Pos, clipped to the screen, to the area from TopLeft to BottomRight.
+    /// </summary>
+    void UniteCursorArea(STL::Point& TopLeft, STL::Point& BottomRight, STL::Point Pos)
+    {
+        STL::Point CursorBottomRight = Pos + STL::Point(CURSOR_SIZE, CURSOR_SIZE);
+        CursorBottomRight.X = STL::Min(CursorBottomRight.X, (int32_t)Frontbuffer->Width);
+        CursorBottomRight.Y = STL::Min(CursorBottomRight.Y, (int32_t)Frontbuffer->Height);
+        UniteArea(TopLeft, BottomRight, Pos, CursorBottomRight);
+    }
+
+    /// <summary>
+    /// Puts the pixels saved from under the cursor back on the frontbuffer.
+    /// </summary>
+    void HideCursor()
+    {
+        if (!CursorDrawn)
+        {
+            return;
+        }
+
+        for (int32_t Y = 0; Y < CURSOR_SIZE; Y++)
+        {
+            STL::CopyMemory(SaveUnder + Y * CURSOR_SIZE, Frontbuffer->Base + (OldMousePos.Y + Y) * Frontbuffer->PixelsPerScanline + OldMousePos.X, 
+            CursorRowWidth(OldMousePos, Y) * 4);
+        }
+
+        CursorDrawn = false;
+    }
+
+    /// <summary>
+    /// Saves the pixels under the cursor at Pos from Source, which must match the frontbuffer there, and draws the cursor on the frontbuffer.
+    /// </summary>
+    void ShowCursor(STL::Point Pos, STL::Framebuffer* Source)
+    {
+        for (int32_t Y = 0; Y < CURSOR_SIZE; Y++)
+        {
+            int32_t Width = CursorRowWidth(Pos, Y);
+            STL::CopyMemory(Source->Base + (Pos.Y + Y) * Source->PixelsPerScanline + Pos.X, SaveUnder + Y * CURSOR_SIZE, Width * 4);
+            STL::SetMemory(Frontbuffer->Base + (Pos.Y + Y) * Frontbuffer->PixelsPerScanline + Pos.X, 255, Width * 4);
+        }
+
+        OldMousePos = Pos;
+        CursorDrawn = true;
+    }
+
     void RedrawMouse()
     {
+        //The swap draws the cursor at the latest position once it is done.
+        if (Swapping)
+        {
+            return;
+        }
+
+        STL::Point MousePos = Mouse::Position;
+        if (DrawMouse && CursorDrawn && MousePos.X == OldMousePos.X && MousePos.Y == OldMousePos.Y)
+        {
+            return;
+        }
+
+        STL::Point FlushTopLeft = STL::Point(0, 0);
+        STL::Point FlushBottomRight = STL::Point(0, 0);
+        if (CursorDrawn)
+        {
+            UniteCursorArea(FlushTopLeft, FlushBottomRight, OldMousePos);
+        }
+
+        HideCursor();
+
         if (DrawMouse)
-        {                   
-            STL::Point MousePos = Mouse::Position;
-                
-            for (int Y = 0; Y < 12; Y++)
-            {
-                STL::CopyMemory(Backbuffer.Base + (OldMousePos.Y + Y) * Backbuffer.PixelsPerScanline + (OldMousePos.X), 
-                Frontbuffer->Base + (OldMousePos.Y + Y) * Frontbuffer->PixelsPerScanline + (OldMousePos.X), (12 - Y) * 4);
-            }
+        {
+            ShowCursor(MousePos, Frontbuffer);
+            UniteCursorArea(FlushTopLeft, FlushBottomRight, MousePos);
+        }
 
-            OldMousePos = MousePos;
+        if (FlushArea != nullptr && FlushTopLeft.X < FlushBottomRight.X && FlushTopLeft.Y < FlushBottomRight.Y)
+        {
+            FlushArea(FlushTopLeft, FlushBottomRight);
+        }
+    }
 
-            for (int Y = 0; Y < 12; Y++)
-            {              
-                STL::SetMemory(Frontbuffer->Base + (MousePos.Y + Y) * Frontbuffer->PixelsPerScanline + (MousePos.X), 255, (12 - Y) * 4);
-            }
-        }  
+    /// <summary>
+    /// Copies the pixels from TopLeft up to BottomRight from the backbuffer to Target.
+    /// </summary>
+    void CopyArea(STL::Framebuffer* Target, STL::Point TopLeft, STL::Point BottomRight)
+    {
+        for (int32_t y = TopLeft.Y; y < BottomRight.Y; y++)
+        {
+            STL::CopyMemory(Backbuffer.Base + y * Backbuffer.PixelsPerScanline + TopLeft.X, 
+            Target->Base + y * Target->PixelsPerScanline + TopLeft.X, (BottomRight.X - TopLeft.X) * 4);
+        }
     }
 
-    void SwapBuffers()
+    void SwapDamage()
     {             
-        STL::ARGB BeforeCursor[16 * 16];
-    
-        if (DrawMouse)
+        Swapping = true;
+
+        //With more than one page the hidden page is brought up to date and then shown.
+        uint32_t Page = PageAmount > 1 ? (VisiblePage + 1) % PageAmount : VisiblePage;
+        STL::Framebuffer* Target = &Pages[Page];
+
+        STL::Point FlushTopLeft = DamageTopLeft[Page];
+        STL::Point FlushBottomRight = DamageBottomRight[Page];
+        if (FlushTopLeft.X < FlushBottomRight.X && FlushTopLeft.Y < FlushBottomRight.Y)
         {
-            DrawMouse = false;
-            STL::Point MousePos = Mouse::Position;
-            
-            for (int Y = 0; Y < 12; Y++)
-            {
-                for (int X = 0; X < 12 - Y; X++)
-                {
-                    BeforeCursor[X + Y * 16] = Backbuffer.GetPixel(STL::Point(MousePos.X + X,MousePos.Y + Y));
-                    Backbuffer.PutPixel(STL::Point(MousePos.X + X, MousePos.Y + Y), STL::ARGB(255));
-                }
-            }
+            CopyArea(Target, FlushTopLeft, FlushBottomRight);
+        }
+        DamageTopLeft[Page] = STL::Point(0, 0);
+        DamageBottomRight[Page] = STL::Point(0, 0);
+
+        uint64_t Flags = CPU::DisableInterrupts();
 
-            OldMousePos = MousePos;
+        //The old cursor is replaced with what is under it in the backbuffer, which is never older than the page.
+        if (CursorDrawn)
+        {
+            STL::Point Size = STL::Point(CURSOR_SIZE, CURSOR_SIZE);
+            STL::Point BottomRight = OldMousePos + Size;
+            BottomRight.X = STL::Min(BottomRight.X, (int32_t)Frontbuffer->Width);
+            BottomRight.Y = STL::Min(BottomRight.Y, (int32_t)Frontbuffer->Height);
+            CopyArea(Frontbuffer, OldMousePos, BottomRight);
+            CursorDrawn = false;
+            UniteCursorArea(FlushTopLeft, FlushBottomRight, OldMousePos);
+        }
 
-            STL::CopyMemory(Backbuffer.Base, Frontbuffer->Base, Backbuffer.Size);
+        Frontbuffer = Target;
+        if (DrawMouse)
+        {
+            ShowCursor(Mouse::Position, &Backbuffer);
+            UniteCursorArea(FlushTopLeft, FlushBottomRight, OldMousePos);
+        }
 
-            for (int Y = 0; Y < 12; Y++)
-            {
-                for (int X = 0; X < 12 - Y; X++)
-                {
-                    Backbuffer.PutPixel(STL::Point(MousePos.X + X, MousePos.Y + Y), BeforeCursor[X + Y * 16]);
-                }
-            }
-            DrawMouse = true;
+        if (Page != VisiblePage)
+        {
+            FlipPage(Page);
+            VisiblePage = Page;
         }
-        else
+
+        CPU::RestoreInterrupts(Flags);
+
+        //Still marked as swapping so a cursor move can not start a second flush while this one waits on the device.
+        if (FlushArea != nullptr && FlushTopLeft.X < FlushBottomRight.X && FlushTopLeft.Y < FlushBottomRight.Y)
         {
-            STL::CopyMemory(Backbuffer.Base, Frontbuffer->Base, Backbuffer.Size);
+            FlushArea(FlushTopLeft, FlushBottomRight);
         }
+        Swapping = false;
+    }
+
+    void SwapBuffers()
+    {             
+        AddDamage(STL::Point(0, 0), STL::Point(Backbuffer.Width, Backbuffer.Height));
+        SwapDamage();
     }
 
     STL::Point GetScreenSize()
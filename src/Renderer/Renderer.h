@@ -19,13 +19,41 @@ namespace Renderer
 
     void Init(STL::Framebuffer* Screenbuffer);
 
+    /// <summary>
+    /// Replaces the screen with PageAmount framebuffers of the same size, the backbuffer is resized to match.
+    /// With more than one page every swap draws into a hidden page and calls Flip to show it instead of copying into the visible one.
+    /// Flush, if not nullptr, is called with the bounding box of every change to the visible page once it is written.
+    /// </summary>
+    void SetDisplay(STL::Framebuffer* Pages, uint32_t PageAmount, void (*Flip)(uint32_t Page), void (*Flush)(STL::Point TopLeft, STL::Point BottomRight) = nullptr);
+
+    /// <summary>
+    /// Marks an area of the backbuffer as changed so the next SwapDamage copies it.
+    /// </summary>
+    void AddDamage(STL::Point TopLeft, STL::Point BottomRight);
+
+    /// <summary>
+    /// Registers every PSF font found under Directory in the initrd, the glyphs are used in place.
+    /// </summary>
+    void LoadFonts(const char* Directory);
+
     void Print(const char* str, uint8_t Scale = 1);
 
     void Print(char Chr, uint8_t Scale = 1);
 
+    /// <summary>
+    /// Moves the cursor on the frontbuffer, only the pixels under its old and new position are touched.
+    /// </summary>
     void RedrawMouse();
 
+    /// <summary>
+    /// Copies the backbuffer to the screen and draws the cursor on top of it.
+    /// </summary>
     void SwapBuffers();
 
+    /// <summary>
+    /// Like SwapBuffers but only copies the areas passed to AddDamage since the page being presented was last updated.
+    /// </summary>
+    void SwapDamage();
+
     STL::Point GetScreenSize();
 }
@@ -0,0 +1,436 @@
+#include "Console.h"
+
+#include "STL/Graphics/GlyphAtlas.h"
+#include "STL/Memory/Memory.h"
+#include "STL/System/System.h"
+
+namespace STL
+{
+    const ARGB Palette[16] =
+    {
+        ARGB(255, 0, 0, 0), ARGB(255, 170, 0, 0), ARGB(255, 0, 170, 0), ARGB(255, 170, 85, 0),
+        ARGB(255, 0, 0, 170), ARGB(255, 170, 0, 170), ARGB(255, 0, 170, 170), ARGB(255, 170, 170, 170),
+        ARGB(255, 85, 85, 85), ARGB(255, 255, 85, 85), ARGB(255, 85, 255, 85), ARGB(255, 255, 255, 85),
+        ARGB(255, 85, 85, 255), ARGB(255, 255, 85, 255), ARGB(255, 85, 255, 255), ARGB(255, 255, 255, 255)
+    };
+
+    void Console::Init(uint32_t Columns, uint32_t Rows, ARGB Foreground, ARGB Background)
+    {
+        if (this->Cells == nullptr)
+        {
+            this->Cells = (Cell*)Malloc(CONSOLE_SCROLLBACK * CONSOLE_MAX_COLUMNS * sizeof(Cell));
+        }
+
+        this->DefaultForeground = Foreground;
+        this->DefaultBackground = Background;
+        this->CursorVisible = false;
+
+        this->Resize(Columns, Rows);
+        this->Clear();
+    }
+
+    void Console::Release()
+    {
+        if (this->Cells != nullptr)
+        {
+            Free(this->Cells);
+        }
+        this->Cells = nullptr;
+    }
+
+    void Console::Resize(uint32_t Columns, uint32_t Rows)
+    {
+        Columns = Columns > CONSOLE_MAX_COLUMNS ? CONSOLE_MAX_COLUMNS : (Columns == 0 ? 1 : Columns);
+        Rows = Rows > CONSOLE_SCROLLBACK ? CONSOLE_SCROLLBACK : (Rows == 0 ? 1 : Rows);
+
+        if (this->Columns != Columns || this->Rows != Rows)
+        {
+            this->Columns = Columns;
+            this->Rows = Rows;
+            this->FullRedraw = true;
+        }
+    }
+
+    void Console::Write(char Chr)
+    {
+        switch (this->State)
+        {
+        case ConsoleState::NORMAL:
+        {
+            switch (Chr)
+            {
+            case '\n':
+            {
+                this->NewLine();
+            }
+            break;
+            case '\r':
+            {
+                this->CursorColumn = 0;
+            }
+            break;
+            case '\b':
+            {
+                if (this->CursorColumn > 0)
+                {
+                    this->CursorColumn--;
+                }
+            }
+            break;
+            case '\t':
+            {
+                do
+                {
+                    this->Put(' ');
+                }
+                while (this->CursorColumn % 8 != 0);
+            }
+            break;
+            case '\033':
+            {
+                this->State = ConsoleState::ESCAPE;
+            }
+            break;
+            default:
+            {
+                this->Put(Chr);
+            }
+            break;
+            }
+        }
+        break;
+        case ConsoleState::ESCAPE:
+        {
+            this->Parameters[0] = 0;
+            this->ParameterAmount = 1;
+            this->DigitAmount = 0;
+
+            if (Chr == 'F' || Chr == 'B')
+            {
+                this->ColorTarget = Chr;
+                this->Parameters[1] = 0;
+                this->Parameters[2] = 0;
+                this->State = ConsoleState::COLOR;
+            }
+            else if (Chr == '[')
+            {
+                this->State = ConsoleState::SEQUENCE;
+            }
+            else
+            {
+                this->State = ConsoleState::NORMAL;
+            }
+        }
+        break;
+        case ConsoleState::COLOR:
+        {
+            if (Chr < '0' || Chr > '9')
+            {
+                this->State = ConsoleState::NORMAL;
+                break;
+            }
+
+            this->Parameters[this->DigitAmount / 3] = this->Parameters[this->DigitAmount / 3] * 10 + (Chr - '0');
+            this->DigitAmount++;
+
+            if (this->DigitAmount == 9)
+            {
+                ARGB Color = ARGB(255, this->Parameters[0], this->Parameters[1], this->Parameters[2]);
+                if (this->ColorTarget == 'F')
+                {
+                    this->Foreground = Color;
+                }
+                else
+                {
+                    this->Background = Color;
+                }
+                this->State = ConsoleState::NORMAL;
+            }
+        }
+        break;
+        case ConsoleState::SEQUENCE:
+        {
+            if (Chr >= '0' && Chr <= '9')
+            {
+                this->Parameters[this->ParameterAmount - 1] = this->Parameters[this->ParameterAmount - 1] * 10 + (Chr - '0');
+            }
+            else if (Chr == ';')
+            {
+                if (this->ParameterAmount < CONSOLE_MAX_PARAMETERS)
+                {
+                    this->Parameters[this->ParameterAmount++] = 0;
+                }
+            }
+            else if (Chr >= 0x40 && Chr <= 0x7E)
+            {
+                this->Execute(Chr);
+                this->State = ConsoleState::NORMAL;
+            }
+        }
+        break;
+        }
+    }
+
+    void Console::Write(const char* cstr)
+    {
+        while (*cstr != 0)
+        {
+            this->Write(*cstr++);
+        }
+    }
+
+    void Console::Clear()
+    {
+        this->Foreground = this->DefaultForeground;
+        this->Background = this->DefaultBackground;
+
+        for (uint64_t Line = 0; Line < CONSOLE_SCROLLBACK; Line++)
+        {
+            this->ClearLine(Line, 0);
+        }
+
+        this->CursorLine = 0;
+        this->CursorColumn = 0;
+        this->LastLine = 0;
+        this->State = ConsoleState::NORMAL;
+        this->FullRedraw = true;
+    }
+
+    void Console::SetCursorVisible(bool Visible)
+    {
+        this->CursorVisible = Visible;
+    }
+
+    void Console::Invalidate()
+    {
+        this->FullRedraw = true;
+    }
+
+    void Console::Draw(Framebuffer* Buffer, Point Origin)
+    {
+        uint64_t Top = this->GetTop();
+
+        uint64_t PixelWidth = this->Columns * GLYPH_WIDTH;
+        uint64_t PixelHeight = this->Rows * GLYPH_HEIGHT;
+        PixelWidth = Origin.X + PixelWidth > Buffer->Width ? Buffer->Width - Origin.X : PixelWidth;
+        PixelHeight = Origin.Y + PixelHeight > Buffer->Height ? Buffer->Height - Origin.Y : PixelHeight;
+
+        //Move what is already on screen, only the lines that scrolled in have to be drawn.
+        if (!this->FullRedraw && Top != this->DrawnTop)
+        {
+            uint64_t Amount = (Top - this->DrawnTop) * GLYPH_HEIGHT;
+            if (Top < this->DrawnTop || Amount >= PixelHeight)
+            {
+                this->FullRedraw = true;
+            }
+            else
+            {
+                for (uint64_t y = 0; y < PixelHeight - Amount; y++)
+                {
+                    CopyMemory(Buffer->Base + (Origin.Y + y + Amount) * Buffer->PixelsPerScanline + Origin.X, 
+                    Buffer->Base + (Origin.Y + y) * Buffer->PixelsPerScanline + Origin.X, PixelWidth * sizeof(ARGB));
+                }
+            }
+        }
+
+        if (this->CursorLine != this->DrawnCursorLine || this->CursorColumn != this->DrawnCursorColumn || 
+            this->CursorVisible != this->DrawnCursorVisible)
+        {
+            this->Dirty[this->DrawnCursorLine % CONSOLE_SCROLLBACK] = true;
+            this->Dirty[this->CursorLine % CONSOLE_SCROLLBACK] = true;
+        }
+
+        for (uint32_t Row = 0; Row < this->Rows; Row++)
+        {
+            uint64_t Line = Top + Row;
+            if (!this->FullRedraw && !this->Dirty[Line % CONSOLE_SCROLLBACK])
+            {
+                continue;
+            }
+            this->Dirty[Line % CONSOLE_SCROLLBACK] = false;
+
+            Cell* Cells = this->GetLine(Line);
+            Point Pos = Point(Origin.X, Origin.Y + Row * GLYPH_HEIGHT);
+            for (uint32_t Column = 0; Column < this->Columns; Column++)
+            {
+                Buffer->PutChar(Cells[Column].Chr, Pos, 1, Cells[Column].Foreground, Cells[Column].Background);
+                Pos.X += GLYPH_WIDTH;
+            }
+
+            if (this->CursorVisible && Line == this->CursorLine && this->CursorColumn < this->Columns)
+            {
+                Cell& Cursor = Cells[this->CursorColumn];
+                Buffer->PutChar('_', Point(Origin.X + this->CursorColumn * GLYPH_WIDTH, Origin.Y + Row * GLYPH_HEIGHT), 1, 
+                Cursor.Foreground, Cursor.Background);
+            }
+        }
+
+        this->DrawnTop = Top;
+        this->DrawnCursorLine = this->CursorLine;
+        this->DrawnCursorColumn = this->CursorColumn;
+        this->DrawnCursorVisible = this->CursorVisible;
+        this->FullRedraw = false;
+    }
+
+    Cell* Console::GetLine(uint64_t Line)
+    {
+        return this->Cells + (Line % CONSOLE_SCROLLBACK) * CONSOLE_MAX_COLUMNS;
+    }
+
+    uint64_t Console::GetTop()
+    {
+        return this->LastLine >= this->Rows ? this->LastLine - this->Rows + 1 : 0;
+    }
+
+    void Console::ClearLine(uint64_t Line, uint32_t From)
+    {
+        Cell* Cells = this->GetLine(Line);
+        for (uint32_t Column = From; Column < CONSOLE_MAX_COLUMNS; Column++)
+        {
+            Cells[Column].Chr = ' ';
+            Cells[Column].Foreground = this->Foreground;
+            Cells[Column].Background = this->Background;
+        }
+        this->Dirty[Line % CONSOLE_SCROLLBACK] = true;
+    }
+
+    void Console::NewLine()
+    {
+        this->CursorLine++;
+
+        //Scrolling only advances the ring, the line that falls out of the scrollback is reused.
+        if (this->CursorLine > this->LastLine)
+        {
+            this->LastLine = this->CursorLine;
+            this->ClearLine(this->CursorLine, 0);
+        }
+    }
+
+    void Console::Put(char Chr)
+    {
+        if (this->CursorColumn >= this->Columns)
+        {
+            this->CursorColumn = 0;
+            this->NewLine();
+        }
+
+        Cell& Target = this->GetLine(this->CursorLine)[this->CursorColumn];
+        Target.Chr = Chr;
+        Target.Foreground = this->Foreground;
+        Target.Background = this->Background;
+
+        this->Dirty[this->CursorLine % CONSOLE_SCROLLBACK] = true;
+        this->CursorColumn++;
+    }
+
+    void Console::Execute(char Command)
+    {
+        switch (Command)
+        {
+        case 'm':
+        {
+            for (uint32_t i = 0; i < this->ParameterAmount; i++)
+            {
+                uint32_t Parameter = this->Parameters[i];
+
+                if (Parameter == 0)
+                {
+                    this->Foreground = this->DefaultForeground;
+                    this->Background = this->DefaultBackground;
+                }
+                else if (Parameter >= 30 && Parameter <= 37)
+                {
+                    this->Foreground = Palette[Parameter - 30];
+                }
+                else if (Parameter >= 90 && Parameter <= 97)
+                {
+                    this->Foreground = Palette[Parameter - 90 + 8];
+                }
+                else if (Parameter == 39)
+                {
+                    this->Foreground = this->DefaultForeground;
+                }
+                else if (Parameter >= 40 && Parameter <= 47)
+                {
+                    this->Background = Palette[Parameter - 40];
+                }
+                else if (Parameter >= 100 && Parameter <= 107)
+                {
+                    this->Background = Palette[Parameter - 100 + 8];
+                }
+                else if (Parameter == 49)
+                {
+                    this->Background = this->DefaultBackground;
+                }
+                else if ((Parameter == 38 || Parameter == 48) && i + 4 < this->ParameterAmount && this->Parameters[i + 1] == 2)
+                {
+                    ARGB Color = ARGB(255, this->Parameters[i + 2], this->Parameters[i + 3], this->Parameters[i + 4]);
+                    if (Parameter == 38)
+                    {
+                        this->Foreground = Color;
+                    }
+                    else
+                    {
+                        this->Background = Color;
+                    }
+                    i += 4;
+                }
+            }
+        }
+        break;
+        case 'J':
+        {
+            if (this->Parameters[0] == 2 || this->Parameters[0] == 3)
+            {
+                for (uint64_t Line = this->GetTop(); Line <= this->LastLine; Line++)
+                {
+                    this->ClearLine(Line, 0);
+                }
+            }
+            else if (this->Parameters[0] == 0)
+            {
+                this->ClearLine(this->CursorLine, this->CursorColumn);
+                for (uint64_t Line = this->CursorLine + 1; Line <= this->LastLine; Line++)
+                {
+                    this->ClearLine(Line, 0);
+                }
+            }
+        }
+        break;
+        case 'K':
+        {
+            if (this->Parameters[0] == 0)
+            {
+                this->ClearLine(this->CursorLine, this->CursorColumn);
+            }
+            else if (this->Parameters[0] == 2)
+            {
+                this->ClearLine(this->CursorLine, 0);
+            }
+        }
+        break;
+        case 'H':
+        case 'f':
+        {
+            uint32_t Row = this->Parameters[0] != 0 ? this->Parameters[0] : 1;
+            uint32_t Column = this->ParameterAmount > 1 && this->Parameters[1] != 0 ? this->Parameters[1] : 1;
+            Row = Row > this->Rows ? this->Rows : Row;
+            Column = Column > this->Columns ? this->Columns : Column;
+
+            //Lines below the last used one are still blank, moving there only extends the used lines.
+            this->CursorLine = this->GetTop() + Row - 1;
+            this->CursorColumn = Column - 1;
+            if (this->CursorLine > this->LastLine)
+            {
+                this->LastLine = this->CursorLine;
+            }
+        }
+        break;
+        default:
+        {
+
+        }
+        break;
+        }
+    }
+}
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "STL/Graphics/Framebuffer.h"
+#include "STL/Graphics/ARGB.h"
+#include "STL/Math/Point.h"
+
+#define CONSOLE_MAX_COLUMNS 256
+#define CONSOLE_SCROLLBACK 256
+#define CONSOLE_MAX_PARAMETERS 8
+
+namespace STL
+{
+    struct Cell
+    {
+        char Chr;
+        ARGB Foreground;
+        ARGB Background;
+    };
+
+    enum class ConsoleState
+    {
+        NORMAL,
+        ESCAPE,
+        COLOR,
+        SEQUENCE
+    };
+
+    /// <summary>
+    /// A character cell terminal, text is written into a ring of lines and only lines that changed are drawn.
+    /// Understands "\033F" and "\033B" followed by 9 digits as well as the ANSI sequences for colors (m), clearing (J, K) and moving the cursor (H).
+    /// </summary>
+    class Console
+    {
+    public:
+
+        /// <summary>
+        /// Allocates the line ring, must be called before anything else.
+        /// </summary>
+        void Init(uint32_t Columns, uint32_t Rows, ARGB Foreground = ARGB(255), ARGB Background = ARGB(0));
+
+        /// <summary>
+        /// Frees the line ring.
+        /// </summary>
+        void Release();
+
+        /// <summary>
+        /// Changes the amount of visible cells, the next draw redraws everything.
+        /// </summary>
+        void Resize(uint32_t Columns, uint32_t Rows);
+
+        void Write(char Chr);
+
+        void Write(const char* cstr);
+
+        /// <summary>
+        /// Blanks every line and moves the cursor to the top left.
+        /// </summary>
+        void Clear();
+
+        void SetCursorVisible(bool Visible);
+
+        /// <summary>
+        /// Draws the visible lines that changed since the last draw with their top left at Origin.
+        /// Scrolling moves the already drawn pixels instead of drawing the lines again.
+        /// </summary>
+        void Draw(Framebuffer* Buffer, Point Origin);
+
+        /// <summary>
+        /// Makes the next draw redraw every visible line, used when the framebuffer was cleared.
+        /// </summary>
+        void Invalidate();
+
+    private:
+
+        Cell* GetLine(uint64_t Line);
+
+        uint64_t GetTop();
+
+        void ClearLine(uint64_t Line, uint32_t From);
+
+        void NewLine();
+
+        void Put(char Chr);
+
+        void Execute(char Command);
+
+        Cell* Cells = nullptr;
+
+        bool Dirty[CONSOLE_SCROLLBACK];
+
+        uint32_t Columns = 0;
+
+        uint32_t Rows = 0;
+
+        uint64_t CursorLine = 0;
+
+        uint32_t CursorColumn = 0;
+
+        uint64_t LastLine = 0;
+
+        bool CursorVisible = false;
+
+        ARGB Foreground;
+
+        ARGB Background;
+
+        ARGB DefaultForeground;
+
+        ARGB DefaultBackground;
+
+        ConsoleState State = ConsoleState::NORMAL;
+
+        uint32_t Parameters[CONSOLE_MAX_PARAMETERS];
+
+        uint32_t ParameterAmount = 0;
+
+        uint32_t DigitAmount = 0;
+
+        char ColorTarget = 0;
+
+        uint64_t DrawnTop = 0;
+
+        uint64_t DrawnCursorLine = 0;
+
+        uint32_t DrawnCursorColumn = 0;
+
+        bool DrawnCursorVisible = false;
+
+        bool FullRedraw = true;
+    };
+}
@@ -0,0 +1,425 @@
+#include "Widget.h"
+
+#include "STL/String/cstr.h"
+#include "STL/Math/Math.h"
+#include "STL/Memory/Memory.h"
+#include "STL/System/System.h"
+
+#define GRID_CELL_BYTES (WIDGET_GRID_CELL_CAPACITY + 1)
+#define GRID_CELL_FULL 0xFF
+
+namespace STL
+{
+    bool Overlaps(Point TopLeft0, Point BottomRight0, Point TopLeft1, Point BottomRight1)
+    {
+        return TopLeft0.X < BottomRight1.X && BottomRight0.X > TopLeft1.X && TopLeft0.Y < BottomRight1.Y && BottomRight0.Y > TopLeft1.Y;
+    }
+
+    void WidgetTree::Init(Point Size, ARGB Background, LabelStyle Style)
+    {
+        this->Release();
+
+        this->GridWidth = (Size.X + WIDGET_GRID_CELL_SIZE - 1) / WIDGET_GRID_CELL_SIZE;
+        this->GridHeight = (Size.Y + WIDGET_GRID_CELL_SIZE - 1) / WIDGET_GRID_CELL_SIZE;
+        this->Grid = (uint8_t*)Malloc(this->GridWidth * this->GridHeight * GRID_CELL_BYTES);
+        SetMemory(this->Grid, 0, this->GridWidth * this->GridHeight * GRID_CELL_BYTES);
+
+        //The root container fills the framebuffer, a bevel has to fit inside it.
+        Point TopLeft = Point(0, 0);
+        Point BottomRight = Size;
+        if (Style != LabelStyle::Flat)
+        {
+            TopLeft = Point(RAISEDWIDTH, RAISEDWIDTH);
+            BottomRight = Size - RAISEDWIDTH;
+        }
+        this->AddContainer(WIDGET_NONE, TopLeft, BottomRight, Background, Style);
+    }
+
+    WidgetID WidgetTree::Add(WidgetType Type, WidgetID Parent, Point TopLeft, Point BottomRight)
+    {
+        if (this->WidgetAmount >= WIDGET_MAX_AMOUNT || (Parent != WIDGET_NONE && Parent >= this->WidgetAmount))
+        {
+            return WIDGET_NONE;
+        }
+
+        WidgetID ID = this->WidgetAmount++;
+        Widget& NewWidget = this->Widgets[ID];
+
+        NewWidget.Type = Type;
+        NewWidget.Parent = Parent;
+        NewWidget.TopLeft = TopLeft;
+        NewWidget.BottomRight = BottomRight;
+        NewWidget.Background = ARGB(200);
+        NewWidget.Foreground = ARGB(60);
+        NewWidget.Text = "";
+        NewWidget.Style = LabelStyle::Flat;
+        NewWidget.HorizontalAlign = LabelAlign::Center;
+        NewWidget.Scale = 1;
+        NewWidget.MaxLength = 0;
+        NewWidget.Pressed = false;
+        NewWidget.Dirty = true;
+
+        if (Type != WidgetType::Button && Type != WidgetType::TextField)
+        {
+            return ID;
+        }
+
+        //Only widgets that react to the mouse are put in the grid.
+        int32_t Left = Max(TopLeft.X, (int32_t)0) / WIDGET_GRID_CELL_SIZE;
+        int32_t Top = Max(TopLeft.Y, (int32_t)0) / WIDGET_GRID_CELL_SIZE;
+        int32_t Right = Min((BottomRight.X - 1) / WIDGET_GRID_CELL_SIZE, (int32_t)this->GridWidth - 1);
+        int32_t Bottom = Min((BottomRight.Y - 1) / WIDGET_GRID_CELL_SIZE, (int32_t)this->GridHeight - 1);
+
+        for (int32_t y = Top; y <= Bottom; y++)
+        {
+            for (int32_t x = Left; x <= Right; x++)
+            {
+                uint8_t* Cell = this->Grid + (y * this->GridWidth + x) * GRID_CELL_BYTES;
+                if (Cell[0] == GRID_CELL_FULL)
+                {
+                    continue;
+                }
+                else if (Cell[0] == WIDGET_GRID_CELL_CAPACITY)
+                {
+                    Cell[0] = GRID_CELL_FULL;
+                }
+                else
+                {
+                    Cell[1 + Cell[0]] = ID;
+                    Cell[0]++;
+                }
+            }
+        }
+
+        return ID;
+    }
+
+    /// <summary>
+    /// Caches the area a widget draws to, bevels are drawn outside of the area the widget fills.
+    /// </summary>
+    void UpdateBounds(Widget& Target)
+    {
+        bool Beveled = Target.Type == WidgetType::Button || Target.Type == WidgetType::TextField || Target.Style != LabelStyle::Flat;
+
+        Target.BoundsTopLeft = Beveled ? Target.TopLeft - RAISEDWIDTH : Target.TopLeft;
+        Target.BoundsBottomRight = Beveled ? Target.BottomRight + RAISEDWIDTH : Target.BottomRight;
+    }
+
+    WidgetID WidgetTree::AddContainer(WidgetID Parent, Point TopLeft, Point BottomRight, ARGB Background, LabelStyle Style)
+    {
+        WidgetID ID = this->Add(WidgetType::Container, Parent, TopLeft, BottomRight);
+        if (ID != WIDGET_NONE)
+        {
+            this->Widgets[ID].Background = Background;
+            this->Widgets[ID].Style = Style;
+            UpdateBounds(this->Widgets[ID]);
+        }
+        return ID;
+    }
+
+    WidgetID WidgetTree::AddButton(WidgetID Parent, const char* Text, Point TopLeft, Point BottomRight, ARGB Color, uint8_t Scale)
+    {
+        WidgetID ID = this->Add(WidgetType::Button, Parent, TopLeft, BottomRight);
+        if (ID != WIDGET_NONE)
+        {
+            this->Widgets[ID].Text = Text;
+            this->Widgets[ID].Background = Color;
+            this->Widgets[ID].Scale = Scale;
+            UpdateBounds(this->Widgets[ID]);
+        }
+        return ID;
+    }
+
+    WidgetID WidgetTree::AddLabel(WidgetID Parent, const char* Text, Point TopLeft, Point BottomRight, LabelStyle Style, uint8_t Scale)
+    {
+        WidgetID ID = this->Add(WidgetType::Label, Parent, TopLeft, BottomRight);
+        if (ID != WIDGET_NONE)
+        {
+            this->Widgets[ID].Text = Text;
+            this->Widgets[ID].Style = Style;
+            this->Widgets[ID].Scale = Scale;
+            UpdateBounds(this->Widgets[ID]);
+        }
+        return ID;
+    }
+
+    WidgetID WidgetTree::AddTextField(WidgetID Parent, Point TopLeft, Point BottomRight, uint32_t MaxLength, uint8_t Scale)
+    {
+        WidgetID ID = this->Add(WidgetType::TextField, Parent, TopLeft, BottomRight);
+        if (ID != WIDGET_NONE)
+        {
+            this->Widgets[ID].Background = ARGB(255);
+            this->Widgets[ID].Foreground = ARGB(0);
+            this->Widgets[ID].Style = LabelStyle::Sunken;
+            this->Widgets[ID].HorizontalAlign = LabelAlign::Negative;
+            this->Widgets[ID].MaxLength = MaxLength;
+            this->Widgets[ID].Scale = Scale;
+            UpdateBounds(this->Widgets[ID]);
+        }
+        return ID;
+    }
+
+    Widget& WidgetTree::Get(WidgetID ID)
+    {
+        return this->Widgets[ID];
+    }
+
+    void WidgetTree::SetText(WidgetID ID, const char* Text)
+    {
+        this->Widgets[ID].Text = Text;
+        this->Widgets[ID].Dirty = true;
+    }
+
+    void WidgetTree::Invalidate(WidgetID ID)
+    {
+        if (ID < this->WidgetAmount)
+        {
+            this->Widgets[ID].Dirty = true;
+        }
+    }
+
+    void WidgetTree::InvalidateAll()
+    {
+        for (uint32_t i = 0; i < this->WidgetAmount; i++)
+        {
+            this->Widgets[i].Dirty = true;
+        }
+    }
+
+    bool WidgetTree::IsDirty()
+    {
+        for (uint32_t i = 0; i < this->WidgetAmount; i++)
+        {
+            if (this->Widgets[i].Dirty)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void WidgetTree::DrawWidget(Framebuffer* Buffer, Widget& Target)
+    {
+        LabelStyle Style = Target.Style;
+        if (Target.Type == WidgetType::Button)
+        {
+            Style = Target.Pressed ? LabelStyle::Sunken : LabelStyle::Raised;
+        }
+
+        switch (Style)
+        {
+        case LabelStyle::Flat:
+        {
+            Buffer->DrawRect(Target.TopLeft, Target.BottomRight, Target.Background);
+        }
+        break;
+        case LabelStyle::Sunken:
+        {
+            Buffer->DrawSunkenRect(Target.TopLeft, Target.BottomRight, Target.Background);
+        }
+        break;
+        case LabelStyle::Raised:
+        {
+            Buffer->DrawRaisedRect(Target.TopLeft, Target.BottomRight, Target.Background);
+        }
+        break;
+        }
+
+        if (Target.Type == WidgetType::Container)
+        {
+            return;
+        }
+
+        //A focused text field is followed by a cursor, which takes up one more character.
+        bool HasFocus = this->Focused != WIDGET_NONE && &Target == &this->Widgets[this->Focused];
+        uint32_t TextWidth = (Target.Text.Length() + (HasFocus ? 1 : 0)) * 8 * Target.Scale;
+
+        Point TextPos;
+        TextPos.Y = (Target.TopLeft.Y + Target.BottomRight.Y) / 2 - (16 * Target.Scale) / 2;
+        switch (Target.HorizontalAlign)
+        {
+        case LabelAlign::Negative:
+        {
+            TextPos.X = Target.TopLeft.X + RAISEDWIDTH * Target.Scale;
+        }
+        break;
+        case LabelAlign::Center:
+        {
+            TextPos.X = (Target.TopLeft.X + Target.BottomRight.X) / 2 - TextWidth / 2;
+        }
+        break;
+        case LabelAlign::Positive:
+        {
+            TextPos.X = Target.BottomRight.X - RAISEDWIDTH * Target.Scale - TextWidth;
+        }
+        break;
+        }
+
+        Buffer->Print(Target.Text.cstr(), TextPos, Target.Scale, Target.Foreground, Target.Background);
+        if (HasFocus)
+        {
+            Buffer->Print("_", TextPos, Target.Scale, Target.Foreground, Target.Background);
+        }
+    }
+
+    void WidgetTree::Draw(DINFO* Info)
+    {
+        Point DamageTopLeft = Point(0, 0);
+        Point DamageBottomRight = Point(0, 0);
+
+        for (uint32_t i = 0; i < this->WidgetAmount; i++)
+        {
+            Widget& Current = this->Widgets[i];
+
+            //Anything drawn earlier that overlaps this widget covers it, so it has to be drawn again on top.
+            for (uint32_t j = 0; j < i && !Current.Dirty; j++)
+            {
+                if (this->Widgets[j].Dirty && Overlaps(this->Widgets[j].BoundsTopLeft, this->Widgets[j].BoundsBottomRight, Current.BoundsTopLeft, Current.BoundsBottomRight))
+                {
+                    Current.Dirty = true;
+                }
+            }
+
+            if (!Current.Dirty)
+            {
+                continue;
+            }
+
+            this->DrawWidget(Info->Buffer, Current);
+
+            if (DamageTopLeft.X >= DamageBottomRight.X || DamageTopLeft.Y >= DamageBottomRight.Y)
+            {
+                DamageTopLeft = Current.BoundsTopLeft;
+                DamageBottomRight = Current.BoundsBottomRight;
+            }
+            else
+            {
+                DamageTopLeft = Point(Min(DamageTopLeft.X, Current.BoundsTopLeft.X), Min(DamageTopLeft.Y, Current.BoundsTopLeft.Y));
+                DamageBottomRight = Point(Max(DamageBottomRight.X, Current.BoundsBottomRight.X), Max(DamageBottomRight.Y, Current.BoundsBottomRight.Y));
+            }
+        }
+
+        for (uint32_t i = 0; i < this->WidgetAmount; i++)
+        {
+            this->Widgets[i].Dirty = false;
+        }
+
+        Info->DamageTopLeft = DamageTopLeft;
+        Info->DamageBottomRight = DamageBottomRight;
+    }
+
+    WidgetID WidgetTree::HitTest(Point Pos)
+    {
+        if (Pos.X < 0 || Pos.Y < 0 || Pos.X / WIDGET_GRID_CELL_SIZE >= (int32_t)this->GridWidth || Pos.Y / WIDGET_GRID_CELL_SIZE >= (int32_t)this->GridHeight)
+        {
+            return WIDGET_NONE;
+        }
+
+        uint8_t* Cell = this->Grid + ((Pos.Y / WIDGET_GRID_CELL_SIZE) * this->GridWidth + Pos.X / WIDGET_GRID_CELL_SIZE) * GRID_CELL_BYTES;
+
+        //Widgets added later are drawn on top, so they are checked first.
+        if (Cell[0] != GRID_CELL_FULL)
+        {
+            for (uint32_t i = Cell[0]; i --> 0; )
+            {
+                Widget& Current = this->Widgets[Cell[1 + i]];
+                if (Contains(Current.TopLeft, Current.BottomRight, Pos))
+                {
+                    return Cell[1 + i];
+                }
+            }
+            return WIDGET_NONE;
+        }
+
+        for (uint32_t i = this->WidgetAmount; i --> 0; )
+        {
+            Widget& Current = this->Widgets[i];
+            if ((Current.Type == WidgetType::Button || Current.Type == WidgetType::TextField) && Contains(Current.TopLeft, Current.BottomRight, Pos))
+            {
+                return i;
+            }
+        }
+        return WIDGET_NONE;
+    }
+
+    WidgetID WidgetTree::HandleMouse(MINFO MouseInfo)
+    {
+        WidgetID Hit = MouseInfo.LeftHeld ? this->HitTest(MouseInfo.Pos) : WIDGET_NONE;
+
+        if (this->Held != WIDGET_NONE && this->Held != Hit)
+        {
+            this->Widgets[this->Held].Pressed = false;
+            this->Widgets[this->Held].Dirty = true;
+            this->Held = WIDGET_NONE;
+        }
+
+        if (Hit == WIDGET_NONE)
+        {
+            return WIDGET_NONE;
+        }
+
+        if (this->Widgets[Hit].Type == WidgetType::TextField)
+        {
+            if (this->Focused != Hit)
+            {
+                this->Invalidate(this->Focused);
+                this->Focused = Hit;
+                this->Widgets[Hit].Dirty = true;
+            }
+            return WIDGET_NONE;
+        }
+
+        if (this->Held == Hit)
+        {
+            return WIDGET_NONE;
+        }
+
+        this->Held = Hit;
+        this->Widgets[Hit].Pressed = true;
+        this->Widgets[Hit].Dirty = true;
+        return Hit;
+    }
+
+    bool WidgetTree::HandleKey(uint8_t Key)
+    {
+        if (this->Focused == WIDGET_NONE)
+        {
+            return false;
+        }
+
+        Widget& Field = this->Widgets[this->Focused];
+        if (Key == BACKSPACE)
+        {
+            if (Field.Text.Length() > 0)
+            {
+                Field.Text.Pop();
+                Field.Dirty = true;
+            }
+        }
+        else if (Key >= ' ' && Key < 127 && Field.Text.Length() < Field.MaxLength)
+        {
+            Field.Text += (char)Key;
+            Field.Dirty = true;
+        }
+
+        return true;
+    }
+
+    void WidgetTree::Release()
+    {
+        if (this->Grid != nullptr)
+        {
+            Free(this->Grid);
+            this->Grid = nullptr;
+        }
+
+        for (uint32_t i = 0; i < this->WidgetAmount; i++)
+        {
+            this->Widgets[i].Text = "";
+        }
+
+        this->WidgetAmount = 0;
+        this->Focused = WIDGET_NONE;
+        this->Held = WIDGET_NONE;
+    }
+}
@@ -0,0 +1,142 @@
+#pragma once
+
+#include "STL/Math/Point.h"
+#include "STL/Graphics/Framebuffer.h"
+#include "STL/String/String.h"
+#include "STL/Process/Process.h"
+#include "STL/GUI/Label.h"
+
+#define WIDGET_MAX_AMOUNT 64
+#define WIDGET_NONE 0xFFFFFFFF
+
+#define WIDGET_GRID_CELL_SIZE 32
+#define WIDGET_GRID_CELL_CAPACITY 7
+
+namespace STL
+{
+    typedef uint32_t WidgetID;
+
+    enum class WidgetType : uint32_t
+    {
+        Container,
+        Button,
+        Label,
+        TextField
+    };
+
+    struct Widget
+    {
+        WidgetType Type;
+
+        WidgetID Parent;
+
+        /// <summary>
+        /// The area the widget fills in the framebuffer, it should lie inside its parent.
+        /// </summary>
+        Point TopLeft;
+
+        Point BottomRight;
+
+        /// <summary>
+        /// The area the widget draws to, including its bevel, cached when the widget is added.
+        /// </summary>
+        Point BoundsTopLeft;
+
+        Point BoundsBottomRight;
+
+        ARGB Background;
+
+        ARGB Foreground;
+
+        String Text;
+
+        LabelStyle Style;
+
+        LabelAlign HorizontalAlign;
+
+        uint8_t Scale;
+
+        uint32_t MaxLength;
+
+        bool Pressed;
+
+        bool Dirty;
+    };
+
+    /// <summary>
+    /// A retained set of widgets drawn in the order they were added, so children must be added after their parent.
+    /// Only widgets that were invalidated, or that overlap one that was, are drawn again.
+    /// </summary>
+    class WidgetTree
+    {
+    public:
+
+        /// <summary>
+        /// Removes every widget and adds a root container of Size, it is always WidgetID 0.
+        /// </summary>
+        void Init(Point Size, ARGB Background, LabelStyle Style = LabelStyle::Flat);
+
+        WidgetID AddContainer(WidgetID Parent, Point TopLeft, Point BottomRight, ARGB Background, LabelStyle Style = LabelStyle::Flat);
+
+        WidgetID AddButton(WidgetID Parent, const char* Text, Point TopLeft, Point BottomRight, ARGB Color, uint8_t Scale = 1);
+
+        WidgetID AddLabel(WidgetID Parent, const char* Text, Point TopLeft, Point BottomRight, LabelStyle Style = LabelStyle::Flat, uint8_t Scale = 1);
+
+        WidgetID AddTextField(WidgetID Parent, Point TopLeft, Point BottomRight, uint32_t MaxLength, uint8_t Scale = 1);
+
+        Widget& Get(WidgetID ID);
+
+        void SetText(WidgetID ID, const char* Text);
+
+        void Invalidate(WidgetID ID);
+
+        void InvalidateAll();
+
+        bool IsDirty();
+
+        /// <summary>
+        /// Draws the invalidated widgets and narrows the damage of Info to them, the damage is empty if nothing was drawn.
+        /// </summary>
+        void Draw(DINFO* Info);
+
+        /// <summary>
+        /// Returns the topmost button or text field under Pos, found through a grid of the widgets covering each cell.
+        /// </summary>
+        WidgetID HitTest(Point Pos);
+
+        /// <summary>
+        /// Updates which button is held and which text field has focus, returns the button that was pressed by this event or WIDGET_NONE.
+        /// </summary>
+        WidgetID HandleMouse(MINFO MouseInfo);
+
+        /// <summary>
+        /// Types Key into the focused text field, returns false if no text field has focus.
+        /// </summary>
+        bool HandleKey(uint8_t Key);
+
+        void Release();
+
+    private:
+
+        WidgetID Add(WidgetType Type, WidgetID Parent, Point TopLeft, Point BottomRight);
+
+        void DrawWidget(Framebuffer* Buffer, Widget& Target);
+
+        Widget Widgets[WIDGET_MAX_AMOUNT];
+
+        uint32_t WidgetAmount = 0;
+
+        WidgetID Focused = WIDGET_NONE;
+
+        WidgetID Held = WIDGET_NONE;
+
+        /// <summary>
+        /// Every cell holds the amount of widgets covering it followed by their IDs, a cell that ran out of room is marked as full and searched linearly.
+        /// </summary>
+        uint8_t* Grid = nullptr;
+
+        uint32_t GridWidth = 0;
+
+        uint32_t GridHeight = 0;
+    };
+}
@@ -2,6 +2,11 @@
 
 namespace STL
 {		
+    uint8_t Saturate(int32_t Value)
+    {
+        return Value < 0 ? 0 : (Value > 255 ? 255 : Value);
+    }
+
     uint32_t ARGB::ToInt()
     {
         uint32_t A32 = A;
@@ -14,31 +19,31 @@ namespace STL
 
 	bool ARGB::operator==(ARGB const& Other)
     {
-        return (this->A == Other.A || this->R == Other.R || this->G == Other.G || this->B == Other.B);
+        return (this->A == Other.A && this->R == Other.R && this->G == Other.G && this->B == Other.B);
     }
 
     void ARGB::operator+=(ARGB const& Other)
     {
-        this->A += Other.A;
-        this->R += Other.R;
-        this->G += Other.G;
-        this->B += Other.B;
+        this->A = Saturate(this->A + Other.A);
+        this->R = Saturate(this->R + Other.R);
+        this->G = Saturate(this->G + Other.G);
+        this->B = Saturate(this->B + Other.B);
     }
 
     void ARGB::operator-=(ARGB const& Other)
     {
-        this->A -= Other.A;
-        this->R -= Other.R;
-        this->G -= Other.G;
-        this->B -= Other.B;
+        this->A = Saturate(this->A - Other.A);
+        this->R = Saturate(this->R - Other.R);
+        this->G = Saturate(this->G - Other.G);
+        this->B = Saturate(this->B - Other.B);
     }
 
     void ARGB::operator*=(ARGB const& Other)
     {
-        this->A *= Other.A;
-        this->R *= Other.R;
-        this->G *= Other.G;
-        this->B *= Other.B;
+        this->A = Saturate(this->A * Other.A);
+        this->R = Saturate(this->R * Other.R);
+        this->G = Saturate(this->G * Other.G);
+        this->B = Saturate(this->B * Other.B);
     }
 
     void ARGB::operator/=(ARGB const& Other)
@@ -51,17 +56,17 @@ namespace STL
 
     ARGB ARGB::operator+(ARGB const& Other)
     {
-        return ARGB(this->A + Other.A, this->R + Other.R, this->G + Other.G, this->B + Other.B);
+        return ARGB(Saturate(this->A + Other.A), Saturate(this->R + Other.R), Saturate(this->G + Other.G), Saturate(this->B + Other.B));
     }
 
     ARGB ARGB::operator-(ARGB const& Other)
     {
-        return ARGB(this->A - Other.A, this->R - Other.R, this->G - Other.G, this->B - Other.B);
+        return ARGB(Saturate(this->A - Other.A), Saturate(this->R - Other.R), Saturate(this->G - Other.G), Saturate(this->B - Other.B));
     }
 
     ARGB ARGB::operator*(ARGB const& Other)
     {
-        return ARGB(this->A * Other.A, this->R * Other.R, this->G * Other.G, this->B * Other.B);
+        return ARGB(Saturate(this->A * Other.A), Saturate(this->R * Other.R), Saturate(this->G * Other.G), Saturate(this->B * Other.B));
     }
 
     ARGB ARGB::operator/(ARGB const& Other)
@@ -71,26 +76,26 @@ namespace STL
 
     void ARGB::operator+=(uint8_t const& Other)
     {
-        this->A += Other;
-        this->R += Other;
-        this->G += Other;
-        this->B += Other;        
+        this->A = Saturate(this->A + Other);
+        this->R = Saturate(this->R + Other);
+        this->G = Saturate(this->G + Other);
+        this->B = Saturate(this->B + Other);        
     }
 
     void ARGB::operator-=(uint8_t const& Other)
     {
-        this->A -= Other;
-        this->R -= Other;
-        this->G -= Other;
-        this->B -= Other;   
+        this->A = Saturate(this->A - Other);
+        this->R = Saturate(this->R - Other);
+        this->G = Saturate(this->G - Other);
+        this->B = Saturate(this->B - Other);   
     }
 
     void ARGB::operator*=(uint8_t const& Other)
     {
-        this->A *= Other;
-        this->R *= Other;
-        this->G *= Other;
-        this->B *= Other;   
+        this->A = Saturate(this->A * Other);
+        this->R = Saturate(this->R * Other);
+        this->G = Saturate(this->G * Other);
+        this->B = Saturate(this->B * Other);   
     }
 
     void ARGB::operator/=(uint8_t const& Other)
@@ -103,17 +108,17 @@ namespace STL
 
     ARGB ARGB::operator+(uint8_t const& Other)
     {
-        return ARGB(this->A + Other, this->R + Other, this->G + Other, this->B + Other);
+        return ARGB(Saturate(this->A + Other), Saturate(this->R + Other), Saturate(this->G + Other), Saturate(this->B + Other));
     }
 
     ARGB ARGB::operator-(uint8_t const& Other)
     {
-        return ARGB(this->A - Other, this->R - Other, this->G - Other, this->B - Other);
+        return ARGB(Saturate(this->A - Other), Saturate(this->R - Other), Saturate(this->G - Other), Saturate(this->B - Other));
     }
 
     ARGB ARGB::operator*(uint8_t const& Other)
     {
-        return ARGB(this->A * Other, this->R * Other, this->G * Other, this->B * Other);
+        return ARGB(Saturate(this->A * Other), Saturate(this->R * Other), Saturate(this->G * Other), Saturate(this->B * Other));
     }
 
     ARGB ARGB::operator/(uint8_t const& Other)
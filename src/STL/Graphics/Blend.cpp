@@ -0,0 +1,229 @@
+#include "Blend.h"
+
+#include <immintrin.h>
+
+#include "STL/Memory/Memory.h"
+
+#include "CPU/CPU.h"
+
+namespace STL
+{
+    /// <summary>
+    /// Divides every 16 bit lane by 255, rounded, lanes must be at most 255 * 255.
+    /// </summary>
+    inline __m128i Divide255(__m128i Value)
+    {
+        Value = _mm_add_epi16(Value, _mm_set1_epi16(128));
+        return _mm_srli_epi16(_mm_add_epi16(Value, _mm_srli_epi16(Value, 8)), 8);
+    }
+
+    __attribute__((target("avx2"))) inline __m256i Divide255(__m256i Value)
+    {
+        Value = _mm256_add_epi16(Value, _mm256_set1_epi16(128));
+        return _mm256_srli_epi16(_mm256_add_epi16(Value, _mm256_srli_epi16(Value, 8)), 8);
+    }
+
+    uint8_t Divide255(uint32_t Value)
+    {
+        Value += 128;
+        return (Value + (Value >> 8)) >> 8;
+    }
+
+    /// <summary>
+    /// Dest = Source * Opacity + Dest * (255 - SourceAlpha * Opacity) for 2 pixels widened to 16 bit lanes.
+    /// </summary>
+    inline __m128i BlendLanes(__m128i Source, __m128i Dest, __m128i Opacity)
+    {
+        Source = Divide255(_mm_mullo_epi16(Source, Opacity));
+        __m128i Alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(Source, 0xFF), 0xFF);
+        Dest = Divide255(_mm_mullo_epi16(Dest, _mm_sub_epi16(_mm_set1_epi16(255), Alpha)));
+        return _mm_add_epi16(Source, Dest);
+    }
+
+    __attribute__((target("avx2"))) inline __m256i BlendLanes(__m256i Source, __m256i Dest, __m256i Opacity)
+    {
+        Source = Divide255(_mm256_mullo_epi16(Source, Opacity));
+        __m256i Alpha = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(Source, 0xFF), 0xFF);
+        Dest = Divide255(_mm256_mullo_epi16(Dest, _mm256_sub_epi16(_mm256_set1_epi16(255), Alpha)));
+        return _mm256_add_epi16(Source, Dest);
+    }
+
+    void BlendScalar(const ARGB* Source, ARGB* Dest, uint64_t Amount, uint8_t Opacity, uint32_t AlphaMask)
+    {
+        for (uint64_t i = 0; i < Amount; i++)
+        {
+            uint32_t Pixel = *(const uint32_t*)&Source[i] | AlphaMask;
+            uint8_t* Components = (uint8_t*)&Pixel;
+            uint8_t* Target = (uint8_t*)&Dest[i];
+
+            uint8_t Alpha = Divide255((uint32_t)Components[3] * Opacity);
+            for (uint32_t j = 0; j < 4; j++)
+            {
+                uint32_t Value = Divide255((uint32_t)Components[j] * Opacity) + Divide255((uint32_t)Target[j] * (255 - Alpha));
+                Target[j] = Value > 255 ? 255 : Value;
+            }
+        }
+    }
+
+    void BlendSSE2(const ARGB* Source, ARGB* Dest, uint64_t Amount, uint8_t Opacity, uint32_t AlphaMask)
+    {
+        __m128i Zero = _mm_setzero_si128();
+        __m128i Mask = _mm_set1_epi32(AlphaMask);
+        __m128i OpacityLanes = _mm_set1_epi16(Opacity);
+        __m128i OpaqueAlpha = _mm_set1_epi32(0xFF000000);
+
+        uint64_t i = 0;
+        for (; i + 4 <= Amount; i += 4)
+        {
+            __m128i Pixels = _mm_or_si128(_mm_loadu_si128((const __m128i*)(Source + i)), Mask);
+
+            //Opaque pixels at full opacity replace the destination.
+            if (Opacity == 255 && _mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(Pixels, OpaqueAlpha), OpaqueAlpha)) == 0xFFFF)
+            {
+                _mm_storeu_si128((__m128i*)(Dest + i), Pixels);
+                continue;
+            }
+
+            __m128i Target = _mm_loadu_si128((const __m128i*)(Dest + i));
+
+            __m128i Low = BlendLanes(_mm_unpacklo_epi8(Pixels, Zero), _mm_unpacklo_epi8(Target, Zero), OpacityLanes);
+            __m128i High = BlendLanes(_mm_unpackhi_epi8(Pixels, Zero), _mm_unpackhi_epi8(Target, Zero), OpacityLanes);
+
+            _mm_storeu_si128((__m128i*)(Dest + i), _mm_packus_epi16(Low, High));
+        }
+
+        BlendScalar(Source + i, Dest + i, Amount - i, Opacity, AlphaMask);
+    }
+
+    __attribute__((target("avx2"))) void BlendAVX2(const ARGB* Source, ARGB* Dest, uint64_t Amount, uint8_t Opacity, uint32_t AlphaMask)
+    {
+        __m256i Zero = _mm256_setzero_si256();
+        __m256i Mask = _mm256_set1_epi32(AlphaMask);
+        __m256i OpacityLanes = _mm256_set1_epi16(Opacity);
+        __m256i OpaqueAlpha = _mm256_set1_epi32(0xFF000000);
+
+        uint64_t i = 0;
+        for (; i + 8 <= Amount; i += 8)
+        {
+            __m256i Pixels = _mm256_or_si256(_mm256_loadu_si256((const __m256i*)(Source + i)), Mask);
+
+            if (Opacity == 255 && _mm256_movemask_epi8(_mm256_cmpeq_epi32(_mm256_and_si256(Pixels, OpaqueAlpha), OpaqueAlpha)) == -1)
+            {
+                _mm256_storeu_si256((__m256i*)(Dest + i), Pixels);
+                continue;
+            }
+
+            __m256i Target = _mm256_loadu_si256((const __m256i*)(Dest + i));
+
+            //Unpacking works within 128 bit halves, packing again restores the original order.
+            __m256i Low = BlendLanes(_mm256_unpacklo_epi8(Pixels, Zero), _mm256_unpacklo_epi8(Target, Zero), OpacityLanes);
+            __m256i High = BlendLanes(_mm256_unpackhi_epi8(Pixels, Zero), _mm256_unpackhi_epi8(Target, Zero), OpacityLanes);
+
+            _mm256_storeu_si256((__m256i*)(Dest + i), _mm256_packus_epi16(Low, High));
+        }
+
+        BlendSSE2(Source + i, Dest + i, Amount - i, Opacity, AlphaMask);
+    }
+
+    void BlendSpan(const ARGB* Source, ARGB* Dest, uint64_t Amount, uint8_t Opacity, bool PerPixel)
+    {
+        if (Opacity == 0)
+        {
+            return;
+        }
+
+        if (Opacity == 255 && !PerPixel)
+        {
+            CopyMemory((void*)Source, Dest, Amount * sizeof(ARGB));
+            return;
+        }
+
+        uint32_t AlphaMask = PerPixel ? 0 : 0xFF000000;
+        if (CPU::HasAVX2())
+        {
+            BlendAVX2(Source, Dest, Amount, Opacity, AlphaMask);
+        }
+        else
+        {
+            BlendSSE2(Source, Dest, Amount, Opacity, AlphaMask);
+        }
+    }
+
+    void FillSSE2(uint32_t* Dest, uint64_t Amount, uint32_t Color)
+    {
+        uint64_t i = 0;
+        for (; i < Amount && ((uint64_t)(Dest + i) & 15) != 0; i++)
+        {
+            Dest[i] = Color;
+        }
+
+        __m128i Lanes = _mm_set1_epi32(Color);
+        for (; i + 16 <= Amount; i += 16)
+        {
+            _mm_store_si128((__m128i*)(Dest + i), Lanes);
+            _mm_store_si128((__m128i*)(Dest + i + 4), Lanes);
+            _mm_store_si128((__m128i*)(Dest + i + 8), Lanes);
+            _mm_store_si128((__m128i*)(Dest + i + 12), Lanes);
+        }
+        for (; i + 4 <= Amount; i += 4)
+        {
+            _mm_store_si128((__m128i*)(Dest + i), Lanes);
+        }
+
+        for (; i < Amount; i++)
+        {
+            Dest[i] = Color;
+        }
+    }
+
+    __attribute__((target("avx2"))) void FillAVX2(uint32_t* Dest, uint64_t Amount, uint32_t Color)
+    {
+        uint64_t i = 0;
+        for (; i < Amount && ((uint64_t)(Dest + i) & 31) != 0; i++)
+        {
+            Dest[i] = Color;
+        }
+
+        __m256i Lanes = _mm256_set1_epi32(Color);
+        for (; i + 32 <= Amount; i += 32)
+        {
+            _mm256_store_si256((__m256i*)(Dest + i), Lanes);
+            _mm256_store_si256((__m256i*)(Dest + i + 8), Lanes);
+            _mm256_store_si256((__m256i*)(Dest + i + 16), Lanes);
+            _mm256_store_si256((__m256i*)(Dest + i + 24), Lanes);
+        }
+        for (; i + 8 <= Amount; i += 8)
+        {
+            _mm256_store_si256((__m256i*)(Dest + i), Lanes);
+        }
+
+        for (; i < Amount; i++)
+        {
+            Dest[i] = Color;
+        }
+    }
+
+    void FillSpan(ARGB* Dest, uint64_t Amount, ARGB Color)
+    {
+        //Short spans, like bevel rows, are not worth the alignment prologue, pixels that are not 4 byte aligned can never reach the wide stores.
+        if (Amount < 8 || ((uint64_t)Dest & 3) != 0)
+        {
+            for (uint64_t i = 0; i < Amount; i++)
+            {
+                Dest[i] = Color;
+            }
+            return;
+        }
+
+        uint64_t Address = (uint64_t)Dest;
+        uint32_t* Pixels = (uint32_t*)Address;
+        if (CPU::HasAVX2())
+        {
+            FillAVX2(Pixels, Amount, Color.ToInt());
+        }
+        else
+        {
+            FillSSE2(Pixels, Amount, Color.ToInt());
+        }
+    }
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "ARGB.h"
+
+namespace STL
+{
+    /// <summary>
+    /// Composites Amount pixels of Source over Dest, scaling Source by Opacity first.
+    /// If PerPixel is set Source must hold premultiplied colors and its alpha is used, otherwise every Source pixel is treated as opaque.
+    /// Opaque spans are copied, everything else goes through an AVX2 or SSE2 kernel.
+    /// </summary>
+    void BlendSpan(const ARGB* Source, ARGB* Dest, uint64_t Amount, uint8_t Opacity, bool PerPixel);
+
+    /// <summary>
+    /// Sets Amount pixels starting at Dest to Color with aligned AVX2 or SSE2 stores.
+    /// </summary>
+    void FillSpan(ARGB* Dest, uint64_t Amount, ARGB Color);
+}
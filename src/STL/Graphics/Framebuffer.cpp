@@ -1,6 +1,8 @@
 #include "Framebuffer.h"
 #include "Graphics.h"
 #include "ARGB.h"
+#include "GlyphAtlas.h"
+#include "Blend.h"
 
 #include "STL/Memory/Memory.h"
 #include "STL/String/cstr.h"
@@ -22,74 +24,102 @@ namespace STL
 
     ARGB Framebuffer::GetPixel(Point Pixel)
     {
-        if (Pixel.X > (int32_t)this->Width || Pixel.X < 0 || Pixel.Y > (int32_t)this->Height || Pixel.Y < 0)
+        if (Pixel.X >= (int32_t)this->Width || Pixel.X < 0 || Pixel.Y >= (int32_t)this->Height || Pixel.Y < 0)
         {
             return ARGB(0);
         }
 
-        return *(ARGB*)((uint64_t)this->Base + Pixel.X * 4 + Pixel.Y * this->PixelsPerScanline * 4);
+        return this->Base[Pixel.Y * this->PixelsPerScanline + Pixel.X];
     }
 
     void Framebuffer::PutPixel(Point Pixel, ARGB Color)
     {
-        if (Pixel.X > (int32_t)this->Width || Pixel.X < 0 || Pixel.Y > (int32_t)this->Height || Pixel.Y < 0)
+        if (Pixel.X >= (int32_t)this->Width || Pixel.X < 0 || Pixel.Y >= (int32_t)this->Height || Pixel.Y < 0)
         {
             return;
         }
 
-        *(ARGB*)((uint64_t)this->Base + Pixel.X * 4 + Pixel.Y * this->PixelsPerScanline * 4) = Color;
+        this->Base[Pixel.Y * this->PixelsPerScanline + Pixel.X] = Color;
     }
 
-    void Framebuffer::DrawRaisedRectEdge(Point TopLeft, Point BottomRight)
+    /// <summary>
+    /// Clips the area from TopLeft up to BottomRight to Buffer, returns false if nothing is left of it.
+    /// </summary>
+    bool ClipRect(Framebuffer* Buffer, Point& TopLeft, Point& BottomRight)
+    {
+        TopLeft.X = Max(TopLeft.X, (int32_t)0);
+        TopLeft.Y = Max(TopLeft.Y, (int32_t)0);
+        BottomRight.X = Min(BottomRight.X, (int32_t)Buffer->Width);
+        BottomRight.Y = Min(BottomRight.Y, (int32_t)Buffer->Height);
+
+        return TopLeft.X < BottomRight.X && TopLeft.Y < BottomRight.Y;
+    }
+
+    /// <summary>
+    /// Fills row Y from Left up to Right, clipped to Buffer.
+    /// </summary>
+    void FillRow(Framebuffer* Buffer, int32_t Y, int32_t Left, int32_t Right, ARGB Color)
     {
-        for (int y = TopLeft.Y - RAISEDWIDTH; y < TopLeft.Y; y++)
+        if (Y < 0 || Y >= (int32_t)Buffer->Height)
         {
-            for (int x = TopLeft.X - RAISEDWIDTH; x < BottomRight.X + RAISEDWIDTH; x++)
-            {                   
-                this->PutPixel(STL::Point(x, y), RAISEDHIGHCOLOR);                    
-            }
+            return;
         }
 
-        for (int y = BottomRight.Y; y < BottomRight.Y + RAISEDWIDTH; y++)
+        Left = Max(Left, (int32_t)0);
+        Right = Min(Right, (int32_t)Buffer->Width);
+        if (Left < Right)
         {
-            for (int x = TopLeft.X - RAISEDWIDTH; x < BottomRight.X + RAISEDWIDTH; x++)
-            {                   
-                this->PutPixel(STL::Point(x, y), RAISEDLOWCOLOR);                    
-            }
+            FillSpan(Buffer->Base + Y * Buffer->PixelsPerScanline + Left, Right - Left, Color);
         }
+    }
+
+    /// <summary>
+    /// Draws a RAISEDWIDTH wide bevel around the area from TopLeft up to BottomRight.
+    /// The top and left sides are Light, the bottom and right sides are Dark and the two remaining corners are split diagonally.
+    /// </summary>
+    void DrawBevel(Framebuffer* Buffer, Point TopLeft, Point BottomRight, ARGB Light, ARGB Dark)
+    {
+        int32_t Left = TopLeft.X - RAISEDWIDTH;
+        int32_t Right = BottomRight.X + RAISEDWIDTH;
 
-        for (int y = TopLeft.Y - RAISEDWIDTH; y < BottomRight.Y + RAISEDWIDTH; y++)
+        for (int32_t Row = 0; Row < RAISEDWIDTH; Row++)
         {
-            for (int x = TopLeft.X - RAISEDWIDTH; x < TopLeft.X; x++)
-            {                   
-                this->PutPixel(STL::Point(x, y), RAISEDHIGHCOLOR);                    
-            }
+            int32_t Split = BottomRight.X + RAISEDWIDTH - Row;
+            FillRow(Buffer, TopLeft.Y - RAISEDWIDTH + Row, Left, Split, Light);
+            FillRow(Buffer, TopLeft.Y - RAISEDWIDTH + Row, Split, Right, Dark);
         }
 
-        for (int y = TopLeft.Y - RAISEDWIDTH; y < BottomRight.Y + RAISEDWIDTH; y++)
+        Point SideTopLeft = Point(Left, TopLeft.Y);
+        Point SideBottomRight = Point(TopLeft.X, BottomRight.Y);
+        if (ClipRect(Buffer, SideTopLeft, SideBottomRight))
         {
-            for (int x = BottomRight.X; x < BottomRight.X + RAISEDWIDTH; x++)
-            {                   
-                this->PutPixel(STL::Point(x, y), RAISEDLOWCOLOR);                    
+            for (int32_t y = SideTopLeft.Y; y < SideBottomRight.Y; y++)
+            {
+                FillSpan(Buffer->Base + y * Buffer->PixelsPerScanline + SideTopLeft.X, SideBottomRight.X - SideTopLeft.X, Light);
             }
         }
 
-        for (int y = 0; y < RAISEDWIDTH; y++)
+        SideTopLeft = Point(BottomRight.X, TopLeft.Y);
+        SideBottomRight = Point(Right, BottomRight.Y);
+        if (ClipRect(Buffer, SideTopLeft, SideBottomRight))
         {
-            for (int x = 0; x < RAISEDWIDTH; x++)
+            for (int32_t y = SideTopLeft.Y; y < SideBottomRight.Y; y++)
             {
-                if (y + x < RAISEDWIDTH)
-                {
-                    this->PutPixel(STL::Point(BottomRight.X + x, TopLeft.Y - RAISEDWIDTH + y), RAISEDHIGHCOLOR);
-                    this->PutPixel(STL::Point(TopLeft.X - RAISEDWIDTH + x, BottomRight.Y + y), RAISEDHIGHCOLOR);                    
-                }
-                else
-                {
-                    this->PutPixel(STL::Point(BottomRight.X + x, TopLeft.Y - RAISEDWIDTH + y), RAISEDLOWCOLOR);
-                    this->PutPixel(STL::Point(TopLeft.X - RAISEDWIDTH + x, BottomRight.Y + y), RAISEDLOWCOLOR);
-                }
+                FillSpan(Buffer->Base + y * Buffer->PixelsPerScanline + SideTopLeft.X, SideBottomRight.X - SideTopLeft.X, Dark);
             }
-        }          
+        }
+
+        for (int32_t Row = 0; Row < RAISEDWIDTH; Row++)
+        {
+            int32_t Split = TopLeft.X - Row;
+            FillRow(Buffer, BottomRight.Y + Row, Left, Split, Light);
+            FillRow(Buffer, BottomRight.Y + Row, Split, Right, Dark);
+        }
+    }
+
+    void Framebuffer::DrawRaisedRectEdge(Point TopLeft, Point BottomRight)
+    {
+        DrawBevel(this, TopLeft, BottomRight, RAISEDHIGHCOLOR, RAISEDLOWCOLOR);
     }
 
     void Framebuffer::DrawRaisedRect(Point TopLeft, Point BottomRight, ARGB Color)
@@ -101,54 +131,7 @@ namespace STL
 
     void Framebuffer::DrawSunkenRectEdge(Point TopLeft, Point BottomRight)
     {
-        for (int y = TopLeft.Y - RAISEDWIDTH; y < TopLeft.Y; y++)
-        {
-            for (int x = TopLeft.X - RAISEDWIDTH; x < BottomRight.X + RAISEDWIDTH; x++)
-            {                   
-                this->PutPixel(STL::Point(x, y), RAISEDLOWCOLOR);                    
-            }
-        }
-
-        for (int y = BottomRight.Y; y < BottomRight.Y + RAISEDWIDTH; y++)
-        {
-            for (int x = TopLeft.X - RAISEDWIDTH; x < BottomRight.X + RAISEDWIDTH; x++)
-            {                   
-                this->PutPixel(STL::Point(x, y), RAISEDHIGHCOLOR);                    
-            }
-        }
-
-        for (int y = TopLeft.Y - RAISEDWIDTH; y < BottomRight.Y + RAISEDWIDTH; y++)
-        {
-            for (int x = TopLeft.X - RAISEDWIDTH; x < TopLeft.X; x++)
-            {                   
-                this->PutPixel(STL::Point(x, y), RAISEDLOWCOLOR);                    
-            }
-        }
-
-        for (int y = TopLeft.Y - RAISEDWIDTH; y < BottomRight.Y + RAISEDWIDTH; y++)
-        {
-            for (int x = BottomRight.X; x < BottomRight.X + RAISEDWIDTH; x++)
-            {                   
-                this->PutPixel(STL::Point(x, y), RAISEDHIGHCOLOR);                    
-            }
-        }
-
-        for (int y = 0; y < RAISEDWIDTH; y++)
-        {
-            for (int x = 0; x < RAISEDWIDTH; x++)
-            {
-                if (y + x < RAISEDWIDTH)
-                {
-                    this->PutPixel(STL::Point(BottomRight.X + x, TopLeft.Y - RAISEDWIDTH + y), RAISEDLOWCOLOR);
-                    this->PutPixel(STL::Point(TopLeft.X - RAISEDWIDTH + x, BottomRight.Y + y), RAISEDLOWCOLOR);                    
-                }
-                else
-                {
-                    this->PutPixel(STL::Point(BottomRight.X + x, TopLeft.Y - RAISEDWIDTH + y), RAISEDHIGHCOLOR);
-                    this->PutPixel(STL::Point(TopLeft.X - RAISEDWIDTH + x, BottomRight.Y + y), RAISEDHIGHCOLOR);
-                }
-            }
-        }
+        DrawBevel(this, TopLeft, BottomRight, RAISEDLOWCOLOR, RAISEDHIGHCOLOR);
     }
 
     void Framebuffer::DrawSunkenRect(Point TopLeft, Point BottomRight, ARGB Color)
@@ -160,65 +143,104 @@ namespace STL
 
     void Framebuffer::DrawRect(STL::Point TopLeft, STL::Point BottomRight, ARGB Color)
     {        
-        if (TopLeft.X > (int32_t)this->Width || TopLeft.X < 0 || TopLeft.Y > (int32_t)this->Height || TopLeft.Y < 0)
+        if (!ClipRect(this, TopLeft, BottomRight))
         {
             return;
         }
 
-        if (BottomRight.X > (int32_t)this->Width || BottomRight.X < 0 || BottomRight.Y > (int32_t)this->Height || BottomRight.Y < 0)
+        ARGB* Row = this->Base + TopLeft.Y * this->PixelsPerScanline + TopLeft.X;
+        for (int32_t y = TopLeft.Y; y < BottomRight.Y; y++)
         {
-            return;
-        }
-
-        for (int y = TopLeft.Y; y < BottomRight.Y; y++)
-        {
-            for (int x = TopLeft.X; x < BottomRight.X; x++)
-            {
-                *(ARGB*)((uint64_t)this->Base + x * 4 + y * this->PixelsPerScanline * 4) = Color;
-            }
+            FillSpan(Row, BottomRight.X - TopLeft.X, Color);
+            Row += this->PixelsPerScanline;
         }
     }
 
     void Framebuffer::Fill(ARGB Color)
     {
-        for (uint32_t y = 0; y < this->Height; y++)
+        if (this->PixelsPerScanline == this->Width)
         {
-            for (uint32_t x = 0; x < this->Width; x++)
-            {
-                *(ARGB*)((uint64_t)this->Base + x * 4 + y * this->PixelsPerScanline * 4) = Color;
-            }
-        }        
+            FillSpan(this->Base, (uint64_t)this->Width * this->Height, Color);
+            return;
+        }
+
+        DrawRect(Point(0, 0), Point(this->Width, this->Height), Color);
     }
 
     void Framebuffer::PutChar(char chr, STL::Point Pos, uint8_t Scale, ARGB Foreground, ARGB Background)
     {
-        char* Glyph = GetFont()->glyphBuffer + (chr * GetFont()->PSF_header->charsize);
+        int32_t Width = GLYPH_WIDTH * Scale;
+        int32_t Height = GLYPH_HEIGHT * Scale;
+
+        //Clip the glyph once instead of checking every pixel.
+        int32_t Left = Pos.X < 0 ? -Pos.X : 0;
+        int32_t Top = Pos.Y < 0 ? -Pos.Y : 0;
+        int32_t Right = Pos.X + Width > (int32_t)this->Width ? (int32_t)this->Width - Pos.X : Width;
+        int32_t Bottom = Pos.Y + Height > (int32_t)this->Height ? (int32_t)this->Height - Pos.Y : Height;
+
+        if (Left >= Right || Top >= Bottom)
+        {
+            return;
+        }
+
+        uint32_t* Destination = (uint32_t*)(this->Base + (Pos.Y + Top) * this->PixelsPerScanline + Pos.X + Left);
 
-        for (uint64_t y = 0; y < 16 * Scale; y++)
+        const ARGB* Cached = GetGlyph(GetFont(), chr, Scale, Foreground, Background);
+        if (Cached != nullptr)
         {
-            for (uint64_t x = 0; x < 8 * Scale; x++)
+            const uint32_t* Source = (const uint32_t*)Cached + Top * Width + Left;
+            for (int32_t y = Top; y < Bottom; y++)
             {
-                if ((*Glyph & (0b10000000 >> x / Scale)) > 0)
+                for (int32_t x = 0; x < Right - Left; x++)
                 {
-                    this->PutPixel(Point(Pos.X + x, Pos.Y + y), Foreground);
+                    Destination[x] = Source[x];
                 }
-                else
+                Source += Width;
+                Destination += this->PixelsPerScanline;
+            }
+            return;
+        }
+
+        //Scales too large for the atlas expand each glyph row once and copy it for the remaining rows.
+        uint32_t Fore = Foreground.ToInt();
+        uint32_t Back = Background.ToInt();
+        const uint8_t* Glyph = (const uint8_t*)GetFont()->glyphBuffer + (uint8_t)chr * GetFont()->PSF_header->charsize;
+
+        uint32_t* PreviousRow = nullptr;
+        for (int32_t y = Top; y < Bottom; y++)
+        {
+            if (PreviousRow != nullptr && y % Scale != 0)
+            {
+                for (int32_t x = 0; x < Right - Left; x++)
                 {
-                    this->PutPixel(Point(Pos.X + x, Pos.Y + y), Background);
+                    Destination[x] = PreviousRow[x];
                 }
             }
-            if (y % Scale == 0)
+            else
             {
-                Glyph++;
+                uint8_t Row = Glyph[y / Scale];
+                for (int32_t x = 0; x < Right - Left; x++)
+                {
+                    Destination[x] = (Row & (0b10000000 >> ((x + Left) / Scale))) ? Fore : Back;
+                }
             }
+            PreviousRow = Destination;
+            Destination += this->PixelsPerScanline;
         }
     }
 
     void Framebuffer::Print(const char* cstr, STL::Point& Pos, uint8_t Scale, ARGB Foreground, ARGB Background, uint64_t NewLineOffset)
     {
-        for (uint32_t i = 0; i < Length(cstr); i++)
+        auto ReadColor = [](const char* Digits)
+        {
+            return STL::ARGB(255, (Digits[0] - '0') * 100 + (Digits[1] - '0') * 10 + (Digits[2] - '0'), 
+            (Digits[3] - '0') * 100 + (Digits[4] - '0') * 10 + (Digits[5] - '0'), 
+            (Digits[6] - '0') * 100 + (Digits[7] - '0') * 10 + (Digits[8] - '0'));
+        };
+
+        for (const char* Chr = cstr; *Chr != 0; Chr++)
         {
-            switch (cstr[i])
+            switch (*Chr)
             {
             case '\n':
             {
@@ -232,30 +254,30 @@ namespace STL
             break;
             case '\033':
             {
-                if (i + 10 > STL::Length(cstr))
+                //An escape is a 'F' or 'B' followed by 9 digits, stop if the string ends before that.
+                for (uint32_t i = 1; i <= 10; i++)
                 {
-                    return;
+                    if (Chr[i] == 0)
+                    {
+                        return;
+                    }
                 }
 
-                i++;
-                switch (cstr[i])
+                Chr++;
+                switch (*Chr)
                 {
                 case 'F':
                 {
-                    Foreground = STL::ARGB(255, (cstr[i + 1] - '0') * 100 + (cstr[i + 2] - '0') * 10 + (cstr[i + 3] - '0'), 
-                    (cstr[i + 4] - '0') * 100 + (cstr[i + 5] - '0') * 10 + (cstr[i + 6] - '0'), 
-                    (cstr[i + 7] - '0') * 100 + (cstr[i + 8] - '0') * 10 + (cstr[i + 9] - '0'));
+                    Foreground = ReadColor(Chr + 1);
                 }
                 break;
                 case 'B':
                 {
-                    Background = STL::ARGB(255, (cstr[i + 1] - '0') * 100 + (cstr[i + 2] - '0') * 10 + (cstr[i + 3] - '0'), 
-                    (cstr[i + 4] - '0') * 100 + (cstr[i + 5] - '0') * 10 + (cstr[i + 6] - '0'), 
-                    (cstr[i + 7] - '0') * 100 + (cstr[i + 8] - '0') * 10 + (cstr[i + 9] - '0'));
+                    Background = ReadColor(Chr + 1);
                 }
                 break;
                 }
-                i += 9;
+                Chr += 9;
             }
             break;
             default:
@@ -266,7 +288,7 @@ namespace STL
                     Pos.Y += 16 * Scale;
                 }
 
-                PutChar(cstr[i], Pos, Scale, Foreground, Background);
+                PutChar(*Chr, Pos, Scale, Foreground, Background);
                 Pos.X += 8 * Scale;
             }
             break;
@@ -0,0 +1,121 @@
+#include "GlyphAtlas.h"
+
+#include "STL/System/System.h"
+
+namespace STL
+{
+    struct AtlasEntry
+    {
+        const PSF_FONT* Font;
+        uint8_t Scale;
+        uint32_t Foreground;
+        uint32_t Background;
+
+        uint64_t LastUsed;
+        uint64_t Expanded[GLYPH_AMOUNT / 64];
+        ARGB* Glyphs;
+    };
+
+    AtlasEntry Atlas[GLYPHATLAS_ENTRIES];
+    uint64_t AtlasClock = 0;
+
+    void ExpandGlyph(AtlasEntry& Entry, uint8_t Chr)
+    {
+        uint64_t Width = GLYPH_WIDTH * Entry.Scale;
+        ARGB* Pixel = Entry.Glyphs + Chr * Width * GLYPH_HEIGHT * Entry.Scale;
+        const uint8_t* Glyph = (const uint8_t*)Entry.Font->glyphBuffer + Chr * Entry.Font->PSF_header->charsize;
+
+        for (uint64_t Row = 0; Row < GLYPH_HEIGHT; Row++)
+        {
+            ARGB* RowStart = Pixel;
+            for (uint64_t x = 0; x < Width; x++)
+            {
+                *(uint32_t*)Pixel++ = (Glyph[Row] & (0b10000000 >> (x / Entry.Scale))) ? Entry.Foreground : Entry.Background;
+            }
+
+            for (uint64_t i = 1; i < Entry.Scale; i++)
+            {
+                for (uint64_t x = 0; x < Width; x++)
+                {
+                    *Pixel++ = RowStart[x];
+                }
+            }
+        }
+
+        Entry.Expanded[Chr / 64] |= (uint64_t)1 << (Chr % 64);
+    }
+
+    const ARGB* GetGlyph(const PSF_FONT* Font, char Chr, uint8_t Scale, ARGB Foreground, ARGB Background)
+    {
+        if (Scale == 0 || Scale > GLYPHATLAS_MAX_SCALE)
+        {
+            return nullptr;
+        }
+
+        uint32_t Fore = Foreground.ToInt();
+        uint32_t Back = Background.ToInt();
+
+        AtlasEntry* Entry = nullptr;
+        AtlasEntry* LeastRecent = &Atlas[0];
+        for (uint32_t i = 0; i < GLYPHATLAS_ENTRIES; i++)
+        {
+            if (Atlas[i].Glyphs != nullptr && Atlas[i].Font == Font && Atlas[i].Scale == Scale && 
+                Atlas[i].Foreground == Fore && Atlas[i].Background == Back)
+            {
+                Entry = &Atlas[i];
+                break;
+            }
+
+            if (Atlas[i].LastUsed < LeastRecent->LastUsed)
+            {
+                LeastRecent = &Atlas[i];
+            }
+        }
+
+        if (Entry == nullptr)
+        {
+            Entry = LeastRecent;
+
+            if (Entry->Glyphs == nullptr || Entry->Scale != Scale)
+            {
+                if (Entry->Glyphs != nullptr)
+                {
+                    Free(Entry->Glyphs);
+                }
+                Entry->Glyphs = (ARGB*)Malloc(GLYPH_AMOUNT * GLYPH_WIDTH * GLYPH_HEIGHT * Scale * Scale * sizeof(ARGB));
+            }
+
+            Entry->Font = Font;
+            Entry->Scale = Scale;
+            Entry->Foreground = Fore;
+            Entry->Background = Back;
+            for (uint32_t i = 0; i < GLYPH_AMOUNT / 64; i++)
+            {
+                Entry->Expanded[i] = 0;
+            }
+        }
+
+        Entry->LastUsed = ++AtlasClock;
+
+        uint8_t Index = (uint8_t)Chr;
+        if (!(Entry->Expanded[Index / 64] & ((uint64_t)1 << (Index % 64))))
+        {
+            ExpandGlyph(*Entry, Index);
+        }
+
+        return Entry->Glyphs + Index * GLYPH_WIDTH * GLYPH_HEIGHT * Scale * Scale;
+    }
+
+    void ClearGlyphAtlas()
+    {
+        for (uint32_t i = 0; i < GLYPHATLAS_ENTRIES; i++)
+        {
+            if (Atlas[i].Glyphs != nullptr)
+            {
+                Free(Atlas[i].Glyphs);
+            }
+            Atlas[i].Glyphs = nullptr;
+            Atlas[i].LastUsed = 0;
+        }
+    }
+}
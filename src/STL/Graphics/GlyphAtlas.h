@@ -0,0 +1,28 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "Font.h"
+#include "ARGB.h"
+
+#define GLYPH_WIDTH 8
+#define GLYPH_HEIGHT 16
+#define GLYPH_AMOUNT 256
+
+#define GLYPHATLAS_ENTRIES 8
+#define GLYPHATLAS_MAX_SCALE 2
+
+namespace STL
+{
+    /// <summary>
+    /// Returns the glyph for Chr expanded to (8 * Scale) x (16 * Scale) pixels, rows are stored one after another without padding.
+    /// Glyphs are cached per font, scale and color pair in a small LRU atlas and only expanded the first time they are drawn.
+    /// Returns nullptr if Scale is too large to cache, the caller must then draw the glyph itself.
+    /// </summary>
+    const ARGB* GetGlyph(const PSF_FONT* Font, char Chr, uint8_t Scale, ARGB Foreground, ARGB Background);
+
+    /// <summary>
+    /// Drops every cached glyph, must be called if a font in use is changed or freed.
+    /// </summary>
+    void ClearGlyphAtlas();
+}
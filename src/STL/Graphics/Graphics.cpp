@@ -1,4 +1,5 @@
 #include "Graphics.h"
+#include "GlyphAtlas.h"
 
 namespace STL
 {
@@ -10,6 +11,8 @@ namespace STL
     {
         Fonts = NewFonts;
         FontAmount = NewFontAmount;
+
+        ClearGlyphAtlas();
     }
 
     const PSF_FONT* GetFont()
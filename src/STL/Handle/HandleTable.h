@@ -0,0 +1,127 @@
+#pragma once
+
+#include <stdint.h>
+
+#define HANDLE_INDEX_BITS 16
+
+namespace STL
+{
+    /// <summary>
+    /// Reference counted objects named by handles, a handle holds the index of its slot in the low bits and the generation of the slot above them.
+    /// The generation is bumped whenever a slot is freed, so handles to the old object stop matching. 0 is never a valid handle.
+    /// </summary>
+    template<typename T, uint64_t Amount>
+    class HandleTable
+    {
+    public:
+
+        /// <summary>
+        /// Stores Object with one reference, returns 0 if out of slots.
+        /// </summary>
+        uint64_t Insert(T const& Object)
+        {
+            for (uint64_t i = 0; i < Amount; i++)
+            {
+                if (this->Slots[i].References != 0)
+                {
+                    continue;
+                }
+
+                //Generation 0 in slot 0 would be handle 0.
+                if (this->Slots[i].Generation == 0)
+                {
+                    this->Slots[i].Generation = 1;
+                }
+                this->Slots[i].Object = Object;
+                this->Slots[i].References = 1;
+                this->Used++;
+
+                return ((uint64_t)this->Slots[i].Generation << HANDLE_INDEX_BITS) | i;
+            }
+
+            return 0;
+        }
+
+        /// <summary>
+        /// Returns the object of a handle, or nullptr if the handle is no longer valid.
+        /// </summary>
+        T* Get(uint64_t Handle)
+        {
+            Slot* Current = this->Find(Handle);
+            return Current != nullptr ? &Current->Object : nullptr;
+        }
+
+        /// <summary>
+        /// Adds a reference, returns false if the handle is no longer valid.
+        /// </summary>
+        bool Acquire(uint64_t Handle)
+        {
+            Slot* Current = this->Find(Handle);
+            if (Current == nullptr)
+            {
+                return false;
+            }
+
+            Current->References++;
+            return true;
+        }
+
+        /// <summary>
+        /// Drops a reference, returns true and copies the object into Object if it was the last one, so the caller can free it.
+        /// </summary>
+        bool Release(uint64_t Handle, T* Object)
+        {
+            Slot* Current = this->Find(Handle);
+            if (Current == nullptr)
+            {
+                return false;
+            }
+
+            Current->References--;
+            if (Current->References != 0)
+            {
+                return false;
+            }
+
+            *Object = Current->Object;
+            Current->Object = T();
+            Current->Generation++;
+            this->Used--;
+
+            return true;
+        }
+
+        /// <summary>
+        /// Returns the amount of objects alive.
+        /// </summary>
+        uint64_t GetAmount()
+        {
+            return this->Used;
+        }
+
+    private:
+
+        struct Slot
+        {
+            T Object;
+            uint32_t References;
+            uint32_t Generation;
+        };
+
+        Slot* Find(uint64_t Handle)
+        {
+            uint64_t Index = Handle & ((1 << HANDLE_INDEX_BITS) - 1);
+            if (Handle == 0 || Index >= Amount || this->Slots[Index].References == 0 || this->Slots[Index].Generation != (Handle >> HANDLE_INDEX_BITS))
+            {
+                return nullptr;
+            }
+
+            return &this->Slots[Index];
+        }
+
+        //No initializers, so tables are zeroed with the rest of .bss and need no constructor.
+        Slot Slots[Amount];
+
+        uint64_t Used;
+    };
+}
@@ -0,0 +1,101 @@
+#include "Channel.h"
+
+#include "STL/Memory/Memory.h"
+#include "STL/System/System.h"
+
+namespace STL
+{
+    uint64_t Channel::GetSize(uint32_t MessageSize, uint32_t Capacity)
+    {
+        return sizeof(Channel) + (uint64_t)MessageSize * Capacity;
+    }
+
+    void Channel::Init(uint32_t MessageSize, uint32_t Capacity)
+    {
+        this->Head = 0;
+        this->Tail = 0;
+        this->WriterWaiting = 0;
+        this->ReaderWaiting = 0;
+        this->MessageSize = MessageSize;
+        this->Capacity = Capacity;
+    }
+
+    bool Channel::Write(const void* Message)
+    {
+        uint32_t CurrentTail = this->Tail;
+        if (CurrentTail - __atomic_load_n(&this->Head, __ATOMIC_ACQUIRE) == this->Capacity)
+        {
+            return false;
+        }
+
+        uint8_t* Slot = (uint8_t*)(this + 1) + (CurrentTail & (this->Capacity - 1)) * this->MessageSize;
+        CopyMemory((void*)Message, Slot, this->MessageSize);
+        __atomic_store_n(&this->Tail, CurrentTail + 1, __ATOMIC_RELEASE);
+
+        //The new tail has to be visible before the flag is read, or a reader that just saw the ring empty could miss it.
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        if (this->ReaderWaiting)
+        {
+            this->ReaderWaiting = 0;
+            Wake(&this->Tail);
+        }
+
+        return true;
+    }
+
+    bool Channel::Read(void* Message)
+    {
+        uint32_t CurrentHead = this->Head;
+        if (CurrentHead == __atomic_load_n(&this->Tail, __ATOMIC_ACQUIRE))
+        {
+            return false;
+        }
+
+        uint8_t* Slot = (uint8_t*)(this + 1) + (CurrentHead & (this->Capacity - 1)) * this->MessageSize;
+        CopyMemory(Slot, Message, this->MessageSize);
+        __atomic_store_n(&this->Head, CurrentHead + 1, __ATOMIC_RELEASE);
+
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        if (this->WriterWaiting)
+        {
+            this->WriterWaiting = 0;
+            Wake(&this->Head);
+        }
+
+        return true;
+    }
+
+    uint32_t Channel::GetAmount()
+    {
+        return __atomic_load_n(&this->Tail, __ATOMIC_ACQUIRE) - __atomic_load_n(&this->Head, __ATOMIC_ACQUIRE);
+    }
+
+    bool Channel::WaitReadable()
+    {
+        uint32_t Observed = this->Tail;
+        if (Observed != this->Head)
+        {
+            return false;
+        }
+
+        this->ReaderWaiting = 1;
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+        //Fails if the writer got in after Observed was read.
+        return Wait(&this->Tail, Observed);
+    }
+
+    bool Channel::WaitWritable()
+    {
+        uint32_t Observed = this->Head;
+        if (this->Tail - Observed != this->Capacity)
+        {
+            return false;
+        }
+
+        this->WriterWaiting = 1;
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+        return Wait(&this->Head, Observed);
+    }
+}
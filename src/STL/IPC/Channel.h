@@ -0,0 +1,59 @@
+#pragma once
+
+#include <stdint.h>
+
+#define CHANNEL_CACHE_LINE 64
+
+namespace STL
+{
+    /// <summary>
+    /// A ring of fixed size messages between one writer and one reader, placed in memory both of them can reach.
+    /// Reading and writing never enter the kernel, only a side that has to wait on the other does.
+    /// </summary>
+    struct Channel
+    {
+        /// <summary>
+        /// The amount of messages ever read, only changed by the reader.
+        /// </summary>
+        alignas(CHANNEL_CACHE_LINE) volatile uint32_t Head;
+        volatile uint32_t WriterWaiting;
+
+        /// <summary>
+        /// The amount of messages ever written, only changed by the writer.
+        /// </summary>
+        alignas(CHANNEL_CACHE_LINE) volatile uint32_t Tail;
+        volatile uint32_t ReaderWaiting;
+
+        alignas(CHANNEL_CACHE_LINE) uint32_t MessageSize;
+        uint32_t Capacity; //A power of two.
+
+        /// <summary>
+        /// Returns the bytes needed for a channel and its messages.
+        /// </summary>
+        static uint64_t GetSize(uint32_t MessageSize, uint32_t Capacity);
+
+        void Init(uint32_t MessageSize, uint32_t Capacity);
+
+        /// <summary>
+        /// Copies a message into the ring and wakes the reader if it waits, returns false if the ring is full.
+        /// </summary>
+        bool Write(const void* Message);
+
+        /// <summary>
+        /// Copies the oldest message out of the ring and wakes the writer if it waits, returns false if the ring is empty.
+        /// </summary>
+        bool Read(void* Message);
+
+        uint32_t GetAmount();
+
+        /// <summary>
+        /// Asks for a WAKE message once something is written, returns false if there already is something to read.
+        /// </summary>
+        bool WaitReadable();
+
+        /// <summary>
+        /// Asks for a WAKE message once something is read, returns false if there already is room to write.
+        /// </summary>
+        bool WaitWritable();
+    };
+}
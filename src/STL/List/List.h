@@ -19,7 +19,7 @@ namespace STL
             }
 
             this->ReservedSize = MinSize * 2;    
-            T* NewData = (T*)Malloc(this->ReservedSize);
+            T* NewData = (T*)Malloc(this->ReservedSize * sizeof(T));
 
             if (this->Data != nullptr)
             {        
@@ -4,6 +4,7 @@
 
 #include "STL/Math/Point.h"
 #include "STL/String/String.h"
+#include "STL/Graphics/Framebuffer.h"
 
 namespace STL
 {
@@ -24,7 +25,9 @@ namespace STL
         KILL,
         TICK,
         MOUSE,
-        KEYPRESS
+        KEYPRESS,
+        WAKE, //Input is the address passed to Wait.
+        OUTPUT //Input is the output of a command the process loop ran for the process, a const char*.
     };
 
     enum class PROT //Process Type
@@ -53,6 +56,19 @@ namespace STL
         uint64_t Top;
 
         String Title;
+
+        uint8_t Opacity = 255; //Opacity of the whole window, anything below 255 blends it with what is behind it.
+
+        bool Alpha = false; //If set the framebuffer holds premultiplied ARGB and the alpha of every pixel is used.
+    };
+
+    struct DINFO //Draw Info
+    {
+        Framebuffer* Buffer;
+
+        Point DamageTopLeft; //The area of Buffer the procedure changed, the whole buffer unless the procedure narrows it.
+
+        Point DamageBottomRight;
     };
 
     struct MINFO //Mouse Info
@@ -106,6 +106,36 @@ namespace STL
         return 0;
     }
 
+    bool Compare(const char* String0, const char* String1)
+    {
+        uint64_t i = 0;
+        while (String0[i] == String1[i])
+        {
+            if (String0[i] == 0)
+            {
+                return true;
+            }
+            i++;
+        }
+
+        return false;
+    }
+
+    bool StartsWith(const char* String, const char* Prefix)
+    {
+        uint64_t i = 0;
+        while (Prefix[i] != 0)
+        {
+            if (String[i] != Prefix[i])
+            {
+                return false;
+            }
+            i++;
+        }
+
+        return true;
+    }
+
     char* CopyString(char* Dest, const char* Source)
     {
         uint64_t SourceLength = Length(Source);
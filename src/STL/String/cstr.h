@@ -37,5 +37,9 @@ namespace STL
 
     uint64_t Length(const char* String);
 
+    bool Compare(const char* String0, const char* String1);
+
+    bool StartsWith(const char* String, const char* Prefix);
+
     char* CopyString(char* Dest, const char* Source);
 }
@@ -0,0 +1,71 @@
+#include "Ring.h"
+
+#include "System/System.h"
+
+namespace STL
+{
+    uint64_t SyscallRing::GetSize(uint32_t Capacity)
+    {
+        return sizeof(SyscallRing) + (uint64_t)Capacity * (sizeof(SQE) + sizeof(CQE));
+    }
+
+    void SyscallRing::Init(uint32_t Capacity)
+    {
+        this->SubmissionHead = 0;
+        this->SubmissionTail = 0;
+        this->CompletionHead = 0;
+        this->CompletionTail = 0;
+        this->Capacity = Capacity;
+    }
+
+    SQE* SyscallRing::GetSubmissions()
+    {
+        return (SQE*)(this + 1);
+    }
+
+    CQE* SyscallRing::GetCompletions()
+    {
+        return (CQE*)(this->GetSubmissions() + this->Capacity);
+    }
+
+    bool SyscallRing::Submit(uint64_t Selector, uint64_t Argument, uint64_t UserData)
+    {
+        uint32_t Tail = this->SubmissionTail;
+        if (Tail - __atomic_load_n(&this->SubmissionHead, __ATOMIC_ACQUIRE) == this->Capacity)
+        {
+            return false;
+        }
+
+        SQE& Entry = this->GetSubmissions()[Tail & (this->Capacity - 1)];
+        Entry.Selector = Selector;
+        Entry.Argument = Argument;
+        Entry.UserData = UserData;
+        __atomic_store_n(&this->SubmissionTail, Tail + 1, __ATOMIC_RELEASE);
+
+        return true;
+    }
+
+    bool SyscallRing::Complete(CQE& Out)
+    {
+        uint32_t Head = this->CompletionHead;
+        if (Head == __atomic_load_n(&this->CompletionTail, __ATOMIC_ACQUIRE))
+        {
+            return false;
+        }
+
+        Out = this->GetCompletions()[Head & (this->Capacity - 1)];
+        __atomic_store_n(&this->CompletionHead, Head + 1, __ATOMIC_RELEASE);
+
+        return true;
+    }
+
+    uint64_t SyscallRing::Enter()
+    {
+        return System::Call(SYSCALL_RING_ENTER, (uint64_t)this);
+    }
+
+    SyscallRing* SetupRing(uint32_t Capacity)
+    {
+        return (SyscallRing*)System::Call(SYSCALL_RING_SETUP, Capacity);
+    }
+}
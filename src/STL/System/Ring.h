@@ -0,0 +1,66 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "System.h"
+
+#define RING_CACHE_LINE 64
+
+namespace STL
+{
+    struct SQE //Submission Queue Entry
+    {
+        uint64_t Selector; //Any SYSCALL_ selector except the ring and exit ones.
+        uint64_t Argument;
+        uint64_t UserData; //Copied to the completion untouched.
+    };
+
+    struct CQE //Completion Queue Entry
+    {
+        uint64_t UserData;
+        SYSRV Result;
+    };
+
+    /// <summary>
+    /// A pair of rings shared by a process and the kernel, syscalls are queued on the submission ring and their results come back on the completion ring.
+    /// The kernel takes submissions when RingEnter is called and on every pass of the process loop, so a process that can wait for the next frame needs no syscall at all.
+    /// </summary>
+    struct SyscallRing
+    {
+        alignas(RING_CACHE_LINE) volatile uint32_t SubmissionHead; //Only changed by the kernel.
+        alignas(RING_CACHE_LINE) volatile uint32_t SubmissionTail; //Only changed by the process.
+        alignas(RING_CACHE_LINE) volatile uint32_t CompletionHead; //Only changed by the process.
+        alignas(RING_CACHE_LINE) volatile uint32_t CompletionTail; //Only changed by the kernel.
+
+        alignas(RING_CACHE_LINE) uint32_t Capacity; //Of both rings, a power of two.
+
+        static uint64_t GetSize(uint32_t Capacity);
+
+        void Init(uint32_t Capacity);
+
+        SQE* GetSubmissions();
+
+        CQE* GetCompletions();
+
+        /// <summary>
+        /// Queues a syscall without entering the kernel, returns false if the submission ring is full.
+        /// </summary>
+        bool Submit(uint64_t Selector, uint64_t Argument, uint64_t UserData = 0);
+
+        /// <summary>
+        /// Takes the oldest completion, returns false if there is none.
+        /// </summary>
+        bool Complete(CQE& Out);
+
+        /// <summary>
+        /// Has the kernel run the queued syscalls now, returns how many completed.
+        /// Submissions wait while the completion ring is full.
+        /// </summary>
+        uint64_t Enter();
+    };
+
+    /// <summary>
+    /// Returns the rings of the calling process, creating them with Capacity entries the first time. Returns nullptr on failure.
+    /// </summary>
+    SyscallRing* SetupRing(uint32_t Capacity);
+}
@@ -16,7 +16,7 @@ namespace STL
 {    
     const char* System(const char* Command)
     {
-        return (const char*)System::Call(SYSCALL_SYSTEM, Command);
+        return (const char*)System::Call(SYSCALL_SYSTEM, (uint64_t)Command);
     }
 
     void* Malloc(uint64_t Size)
@@ -26,6 +26,53 @@ namespace STL
 
     void Free(void* Memory)
     {
-        System::Call(SYSCALL_FREE, Memory);
+        System::Call(SYSCALL_FREE, (uint64_t)Memory);
+    }
+
+    uint64_t Start(PROG Program)
+    {
+        return System::Call(SYSCALL_START, (uint64_t)Program);
+    }
+
+    bool Kill(uint64_t ID)
+    {
+        return System::Call(SYSCALL_KILL, ID);
+    }
+
+    void GetTime(TINFO* Info)
+    {
+        System::Call(SYSCALL_TIME, (uint64_t)Info);
+    }
+
+    void GetStat(SINFO* Info)
+    {
+        System::Call(SYSCALL_STAT, (uint64_t)Info);
+    }
+
+    bool Wait(volatile uint32_t* Address, uint32_t Expected)
+    {
+        WINFO Info = {Address, Expected};
+        return System::Call(SYSCALL_WAIT, (uint64_t)&Info);
+    }
+
+    uint64_t Wake(volatile uint32_t* Address)
+    {
+        return System::Call(SYSCALL_WAKE, (uint64_t)Address);
+    }
+
+    uint64_t CreateChannel(uint32_t MessageSize, uint32_t Capacity)
+    {
+        CINFO Info = {MessageSize, Capacity};
+        return System::Call(SYSCALL_CHANNEL_CREATE, (uint64_t)&Info);
+    }
+
+    Channel* OpenChannel(uint64_t Handle)
+    {
+        return (Channel*)System::Call(SYSCALL_CHANNEL_OPEN, Handle);
+    }
+
+    void CloseChannel(uint64_t Handle)
+    {
+        System::Call(SYSCALL_CHANNEL_CLOSE, Handle);
     }
 }
\ No newline at end of file
@@ -5,6 +5,19 @@
 #define SYSCALL_SYSTEM 0
 #define SYSCALL_MALLOC 1
 #define SYSCALL_FREE 2
+#define SYSCALL_START 3
+#define SYSCALL_KILL 4
+#define SYSCALL_TIME 5
+#define SYSCALL_STAT 6
+#define SYSCALL_EXIT 7 //Only valid from user mode, handled by the entry path itself.
+#define SYSCALL_WAIT 8
+#define SYSCALL_WAKE 9
+#define SYSCALL_CHANNEL_CREATE 10
+#define SYSCALL_CHANNEL_OPEN 11
+#define SYSCALL_CHANNEL_CLOSE 12
+#define SYSCALL_RING_SETUP 13
+#define SYSCALL_RING_ENTER 14
+#define SYSCALL_SYSTEM_PAGE 15
 
 #define ENTER 0x1C
 #define BACKSPACE 0x0E
@@ -22,9 +35,96 @@ namespace STL
 {
     typedef uint64_t SYSRV;
 
+    enum class PROG //Program
+    {
+        TTY,
+        DESKTOP,
+        TOPBAR,
+        SYSTEMMENU,
+        STARTMENU,
+        TERMINAL,
+        CALCULATOR
+    };
+
+    struct TINFO //Time Info
+    {
+        uint8_t Second;
+        uint8_t Minute;
+        uint8_t Hour;
+        uint8_t Day;
+        uint8_t Month;
+        uint16_t Year;
+    };
+
+    struct WINFO //Wait Info
+    {
+        volatile uint32_t* Address;
+        uint32_t Expected;
+    };
+
+    struct CINFO //Channel Info
+    {
+        uint32_t MessageSize;
+        uint32_t Capacity;
+    };
+
+    struct Channel;
+
+    struct SINFO //System Info
+    {
+        uint64_t ProcessAmount;
+        uint64_t FreeMemory;
+        uint64_t UsedMemory;
+        uint64_t HeapUsed;
+        uint64_t Ticks;
+    };
+
+    /// <summary>
+    /// Runs a shell command and returns its output, programs should prefer the typed calls below.
+    /// </summary>
     const char* System(const char* Command);
 
     void* Malloc(uint64_t Size);
 
     void Free(void* Memory);
+
+    /// <summary>
+    /// Starts a program and returns the ID of its process, or 0 if it is already running.
+    /// </summary>
+    uint64_t Start(PROG Program);
+
+    /// <summary>
+    /// Requests the process with the given ID to be killed, returns false if there is no such process.
+    /// </summary>
+    bool Kill(uint64_t ID);
+
+    void GetTime(TINFO* Info);
+
+    void GetStat(SINFO* Info);
+
+    /// <summary>
+    /// Asks for a WAKE message once Wake is called on Address, unless Address no longer holds Expected.
+    /// Returns false if the message will not come, the caller should check the value again.
+    /// </summary>
+    bool Wait(volatile uint32_t* Address, uint32_t Expected);
+
+    /// <summary>
+    /// Sends a WAKE message to every process waiting on Address before the next frame, returns how many there were.
+    /// </summary>
+    uint64_t Wake(volatile uint32_t* Address);
+
+    /// <summary>
+    /// Creates a channel and returns its handle with one reference held by the caller, or 0 on failure.
+    /// </summary>
+    uint64_t CreateChannel(uint32_t MessageSize, uint32_t Capacity);
+
+    /// <summary>
+    /// Takes a reference to a channel and returns it, or nullptr if the handle is no longer valid.
+    /// </summary>
+    Channel* OpenChannel(uint64_t Handle);
+
+    /// <summary>
+    /// Drops a reference taken by CreateChannel or OpenChannel.
+    /// </summary>
+    void CloseChannel(uint64_t Handle);
 }
\ No newline at end of file
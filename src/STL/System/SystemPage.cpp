@@ -0,0 +1,112 @@
+#include "SystemPage.h"
+
+#include "System/System.h"
+
+namespace STL
+{
+    uint32_t SystemPage::ReadBegin() const
+    {
+        while (true)
+        {
+            uint32_t Start = __atomic_load_n(&this->Sequence, __ATOMIC_ACQUIRE);
+            if ((Start & 1) == 0)
+            {
+                return Start;
+            }
+
+            asm volatile("PAUSE");
+        }
+    }
+
+    bool SystemPage::ReadRetry(uint32_t Start) const
+    {
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        return __atomic_load_n(&this->Sequence, __ATOMIC_RELAXED) != Start;
+    }
+
+    void SystemPage::BeginWrite()
+    {
+        __atomic_store_n(&this->Sequence, this->Sequence + 1, __ATOMIC_RELAXED);
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+    }
+
+    void SystemPage::EndWrite()
+    {
+        __atomic_store_n(&this->Sequence, this->Sequence + 1, __ATOMIC_RELEASE);
+    }
+
+    uint64_t SystemPage::GetNanoseconds() const
+    {
+        uint32_t Start;
+        uint64_t Base;
+        uint64_t Nanoseconds;
+        uint64_t Scale;
+        do
+        {
+            Start = this->ReadBegin();
+            Base = this->TSCBase;
+            Nanoseconds = this->NanosecondsBase;
+            Scale = this->TSCScale;
+        }
+        while (this->ReadRetry(Start));
+
+        uint32_t Low;
+        uint32_t High;
+        asm volatile ("RDTSC" : "=a"(Low), "=d"(High));
+        uint64_t Cycles = (((uint64_t)High << 32) | Low) - Base;
+
+        //128 bits so a late update can not overflow the product.
+        return Nanoseconds + (uint64_t)(((unsigned __int128)Cycles * Scale) >> 32);
+    }
+
+    uint64_t SystemPage::GetTicks() const
+    {
+        uint32_t Start;
+        uint64_t Result;
+        do
+        {
+            Start = this->ReadBegin();
+            Result = this->Ticks;
+        }
+        while (this->ReadRetry(Start));
+
+        return Result;
+    }
+
+    void SystemPage::GetTime(TINFO* Info) const
+    {
+        uint32_t Start;
+        do
+        {
+            Start = this->ReadBegin();
+            *Info = this->Time;
+        }
+        while (this->ReadRetry(Start));
+    }
+
+    void SystemPage::GetStat(SINFO* Info) const
+    {
+        uint32_t Start;
+        do
+        {
+            Start = this->ReadBegin();
+            Info->ProcessAmount = this->ProcessAmount;
+            Info->FreeMemory = this->FreeMemory;
+            Info->UsedMemory = this->UsedMemory;
+            Info->HeapUsed = this->HeapUsed;
+            Info->Ticks = this->Ticks;
+        }
+        while (this->ReadRetry(Start));
+    }
+
+    const SystemPage* GetSystemPage()
+    {
+        static const SystemPage* Page = nullptr;
+        if (Page == nullptr)
+        {
+            Page = (const SystemPage*)System::Call(SYSCALL_SYSTEM_PAGE, 0);
+        }
+
+        return Page;
+    }
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "System.h"
+
+namespace STL
+{
+    /// <summary>
+    /// A page the kernel keeps up to date and every process can read but not write, so time and system counters are read without a syscall.
+    /// The kernel makes Sequence odd while it writes, a reader copies what it needs and tries again unless Sequence was the same even value before and after.
+    /// </summary>
+    struct SystemPage
+    {
+        volatile uint32_t Sequence;
+
+        /// <summary>
+        /// The monotonic time in nanoseconds since boot was NanosecondsBase when the TSC read TSCBase, readers add the cycles since then.
+        /// </summary>
+        uint64_t TSCBase;
+        uint64_t NanosecondsBase;
+        uint64_t TSCScale; //Nanoseconds per cycle in 32.32 fixed point, 0 if the TSC was not calibrated.
+
+        uint64_t Ticks;
+        TINFO Time;
+
+        uint64_t ProcessAmount;
+        uint64_t FreeMemory;
+        uint64_t UsedMemory;
+        uint64_t HeapUsed;
+
+        /// <summary>
+        /// Waits until no write is in progress and returns the sequence to pass to ReadRetry.
+        /// </summary>
+        uint32_t ReadBegin() const;
+
+        /// <summary>
+        /// Returns true if the kernel wrote to the page since ReadBegin, everything read in between has to be read again.
+        /// </summary>
+        bool ReadRetry(uint32_t Start) const;
+
+        /// <summary>
+        /// Only used by the kernel.
+        /// </summary>
+        void BeginWrite();
+
+        void EndWrite();
+
+        /// <summary>
+        /// Returns the nanoseconds since boot, never less than a value returned before.
+        /// </summary>
+        uint64_t GetNanoseconds() const;
+
+        uint64_t GetTicks() const;
+
+        void GetTime(TINFO* Info) const;
+
+        void GetStat(SINFO* Info) const;
+    };
+
+    /// <summary>
+    /// Returns where the system page is mapped for the caller, only the first call makes a syscall.
+    /// </summary>
+    const SystemPage* GetSystemPage();
+}
@@ -0,0 +1,99 @@
+#include "Serial.h"
+
+#include "IO/IO.h"
+#include "Log/Log.h"
+
+#define UART_DATA 0
+#define UART_INTERRUPT_ENABLE 1
+#define UART_INTERRUPT_IDENTIFICATION 2
+#define UART_FIFO_CONTROL 2
+#define UART_LINE_CONTROL 3
+#define UART_MODEM_CONTROL 4
+#define UART_LINE_STATUS 5
+
+#define UART_LINE_STATUS_THRE 0x20
+#define UART_INTERRUPT_THRE 0x02
+#define UART_FIFO_SIZE 16
+
+namespace Serial
+{
+    bool Present = false;
+    bool InterruptDriven = false;
+
+    void Init()
+    {
+        IO::OutByte(COM1 + UART_INTERRUPT_ENABLE, 0x00);
+        IO::OutByte(COM1 + UART_LINE_CONTROL, 0x80); //Enable DLAB to set the divisor.
+        IO::OutByte(COM1 + UART_DATA, 0x01); //115200 baud.
+        IO::OutByte(COM1 + UART_INTERRUPT_ENABLE, 0x00);
+        IO::OutByte(COM1 + UART_LINE_CONTROL, 0x03); //8 bits, no parity, one stop bit.
+        IO::OutByte(COM1 + UART_FIFO_CONTROL, 0xC7); //Enable and clear the FIFOs.
+        IO::OutByte(COM1 + UART_MODEM_CONTROL, 0x0B); //OUT2 must be set for the UART to raise IRQ4.
+
+        //A missing UART reads back as all ones.
+        Present = IO::InByte(COM1 + UART_LINE_STATUS) != 0xFF;
+    }
+
+    void EnableInterrupts()
+    {
+        InterruptDriven = Present;
+        Kick();
+    }
+
+    void Kick()
+    {
+        if (!InterruptDriven)
+        {
+            return;
+        }
+
+        //Enabling the interrupt while the transmitter is empty raises it immediately.
+        IO::OutByte(COM1 + UART_INTERRUPT_ENABLE, UART_INTERRUPT_THRE);
+    }
+
+    void HandleInterrupt()
+    {
+        //Reading the identification register acknowledges the transmitter empty interrupt.
+        IO::InByte(COM1 + UART_INTERRUPT_IDENTIFICATION);
+
+        if (!(IO::InByte(COM1 + UART_LINE_STATUS) & UART_LINE_STATUS_THRE))
+        {
+            return;
+        }
+
+        for (uint8_t i = 0; i < UART_FIFO_SIZE; i++)
+        {
+            char Chr;
+            if (!Log::NextSerialByte(Chr))
+            {
+                IO::OutByte(COM1 + UART_INTERRUPT_ENABLE, 0x00);
+                return;
+            }
+
+            IO::OutByte(COM1 + UART_DATA, Chr);
+        }
+    }
+
+    void Write(char Chr)
+    {
+        if (!Present)
+        {
+            return;
+        }
+
+        while (!(IO::InByte(COM1 + UART_LINE_STATUS) & UART_LINE_STATUS_THRE))
+        {
+
+        }
+
+        IO::OutByte(COM1 + UART_DATA, Chr);
+    }
+
+    void Write(const char* cstr)
+    {
+        for (uint64_t i = 0; cstr[i] != 0; i++)
+        {
+            Write(cstr[i]);
+        }
+    }
+}
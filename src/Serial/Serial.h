@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stdint.h>
+
+#define COM1 0x3F8
+
+namespace Serial
+{
+    /// <summary>
+    /// Sets up COM1 as a 115200 baud 8N1 16550 UART.
+    /// </summary>
+    void Init();
+
+    /// <summary>
+    /// Switches transmission of the kernel log to the transmitter empty interrupt, must be called once IRQ4 has a handler.
+    /// </summary>
+    void EnableInterrupts();
+
+    /// <summary>
+    /// Restarts interrupt driven transmission after new output has been queued.
+    /// </summary>
+    void Kick();
+
+    /// <summary>
+    /// Refills the transmit FIFO from the kernel log, called by the IRQ4 handler.
+    /// </summary>
+    void HandleInterrupt();
+
+    /// <summary>
+    /// Polled output, blocks until the UART accepts every byte.
+    /// </summary>
+    void Write(char Chr);
+
+    void Write(const char* cstr);
+}
@@ -0,0 +1,87 @@
+#include "SharedPage.h"
+
+#include "STL/Memory/Memory.h"
+#include "Memory/Paging/PageAllocator.h"
+#include "Memory/Heap.h"
+#include "ProcessHandler/ProcessTable.h"
+#include "TSC/TSC.h"
+#include "PIT/PIT.h"
+#include "RTC/RTC.h"
+#include "CPU/CPU.h"
+
+namespace SharedPage
+{
+    STL::SystemPage* Page = nullptr;
+
+    void Init()
+    {
+        Page = (STL::SystemPage*)PageAllocator::RequestPage();
+        STL::SetMemory(Page, 0, 4096);
+
+        if (TSC::GetFrequency() != 0)
+        {
+            Page->TSCScale = (1000000000ull << 32) / TSC::GetFrequency();
+        }
+        Page->TSCBase = TSC::Read();
+
+        Tick();
+    }
+
+    void Tick()
+    {
+        uint64_t Now = TSC::Read();
+
+        Page->BeginWrite();
+
+        //The same sum readers make, so the time never goes back when the base moves.
+        if (Page->TSCScale != 0)
+        {
+            Page->NanosecondsBase += (uint64_t)(((unsigned __int128)(Now - Page->TSCBase) * Page->TSCScale) >> 32);
+        }
+        else
+        {
+            Page->NanosecondsBase = PIT::Ticks * 1000000000 / PIT::GetFrequency();
+        }
+        Page->TSCBase = Now;
+
+        Page->Ticks = PIT::Ticks;
+        Page->Time.Second = RTC::GetSecond();
+        Page->Time.Minute = RTC::GetMinute();
+        Page->Time.Hour = RTC::GetHour();
+        Page->Time.Day = RTC::GetDay();
+        Page->Time.Month = RTC::GetMonth();
+        Page->Time.Year = 2000 + RTC::GetYear();
+
+        Page->EndWrite();
+    }
+
+    void UpdateCounters()
+    {
+        uint64_t ProcessAmount = ProcessTable::GetAmount();
+        uint64_t FreeMemory = PageAllocator::GetFreePages() * 4096;
+        uint64_t UsedMemory = (PageAllocator::GetTotalPages() - PageAllocator::GetFreePages()) * 4096;
+        uint64_t HeapUsed = Heap::GetUsedSize();
+
+        //The PIT interrupt is the other writer, it must not find the sequence odd.
+        uint64_t Flags = CPU::DisableInterrupts();
+
+        Page->BeginWrite();
+        Page->ProcessAmount = ProcessAmount;
+        Page->FreeMemory = FreeMemory;
+        Page->UsedMemory = UsedMemory;
+        Page->HeapUsed = HeapUsed;
+        Page->EndWrite();
+
+        CPU::RestoreInterrupts(Flags);
+    }
+
+    STL::SystemPage* Get()
+    {
+        return Page;
+    }
+
+    bool Map(AddressSpace::Space* Space, void* VirtualAddress)
+    {
+        return AddressSpace::Map(Space, VirtualAddress, Page, false);
+    }
+}
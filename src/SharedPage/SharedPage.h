@@ -0,0 +1,37 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "STL/System/SystemPage.h"
+#include "Memory/Paging/AddressSpace.h"
+
+/// <summary>
+/// Keeps the system page up to date, the time on every PIT interrupt and the counters on every pass of the process loop.
+/// </summary>
+namespace SharedPage
+{
+    /// <summary>
+    /// Allocates and fills the page, must be called after TSC calibration and before interrupts are enabled.
+    /// </summary>
+    void Init();
+
+    /// <summary>
+    /// Updates the time, called by the PIT interrupt.
+    /// </summary>
+    void Tick();
+
+    /// <summary>
+    /// Updates the process, memory and heap counters, called by the loop.
+    /// </summary>
+    void UpdateCounters();
+
+    /// <summary>
+    /// Returns the page at the address the kernel reaches it through.
+    /// </summary>
+    STL::SystemPage* Get();
+
+    /// <summary>
+    /// Maps the page read only into Space at VirtualAddress.
+    /// </summary>
+    bool Map(AddressSpace::Space* Space, void* VirtualAddress);
+}
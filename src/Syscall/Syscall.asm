@@ -0,0 +1,102 @@
+[bits 64]
+GLOBAL SyscallEntry
+GLOBAL EnterUser
+GLOBAL UserAbort
+GLOBAL UserCallAbort
+GLOBAL SyscallBenchStart
+GLOBAL SyscallBenchEnd
+EXTERN SyscallDispatch
+
+%define SYSCALL_KILL 4
+%define SYSCALL_EXIT 7
+
+%define CPU_KERNEL_STACK 0
+%define CPU_USER_STACK 8
+%define CPU_RETURN_STACK 16
+
+%define USER_FLAGS 0x202
+%define USER_ABORTED -1
+
+section .text
+
+SyscallEntry:
+    SWAPGS
+    MOV [gs:CPU_USER_STACK], rsp
+    MOV rsp, [gs:CPU_KERNEL_STACK]
+
+    CMP rax, SYSCALL_EXIT
+    JE .Exit
+
+    PUSH qword [gs:CPU_USER_STACK]
+    PUSH rcx
+    PUSH r11
+    SUB rsp, 8
+
+    ;The user stack is no longer in use, so interrupts can be taken while the syscall runs.
+    STI
+    MOV rsi, rdi
+    MOV rdi, rax
+    CALL SyscallDispatch
+    CLI
+
+    ADD rsp, 8
+    POP r11
+    POP rcx
+    POP rsp
+    SWAPGS
+    O64 SYSRET
+
+.Exit:
+    MOV rsp, [gs:CPU_RETURN_STACK]
+    SWAPGS
+    MOV rax, rdi
+.Restore:
+    POP r15
+    POP r14
+    POP r13
+    POP r12
+    POP rbx
+    POP rbp
+    POPFQ
+    RET
+
+;Reached through IRETQ from a fault handler, already on the return stack with the kernel GS.
+UserAbort:
+    MOV rax, USER_ABORTED
+    JMP SyscallEntry.Restore
+
+;The syscall swapped GS on entry, it is swapped back before leaving like the exit path does.
+UserCallAbort:
+    SWAPGS
+    JMP UserAbort
+
+EnterUser:
+    PUSHFQ
+    PUSH rbp
+    PUSH rbx
+    PUSH r12
+    PUSH r13
+    PUSH r14
+    PUSH r15
+    CLI
+    SWAPGS
+    MOV [gs:CPU_RETURN_STACK], rsp
+    SWAPGS
+    MOV rcx, rdi
+    MOV rsp, rsi
+    MOV rdi, rdx
+    MOV r11, USER_FLAGS
+    O64 SYSRET
+
+SyscallBenchStart:
+    MOV ebx, 64
+.Loop:
+    MOV eax, SYSCALL_KILL
+    XOR edi, edi
+    SYSCALL
+    DEC ebx
+    JNZ .Loop
+    MOV eax, SYSCALL_EXIT
+    XOR edi, edi
+    SYSCALL
+SyscallBenchEnd:
@@ -0,0 +1,51 @@
+#include "Syscall.h"
+
+#include "CPU/CPU.h"
+#include "Memory/GDT/GDT.h"
+#include "System/System.h"
+
+#define EFER_SCE (1 << 0)
+
+namespace Syscall
+{
+    __attribute__((aligned(16)))
+    uint8_t KernelStack[SYSCALL_STACK_SIZE];
+
+    CPUData BootCPU;
+
+    void Init()
+    {
+        BootCPU.KernelStack = (uint64_t)KernelStack + SYSCALL_STACK_SIZE;
+        BootCPU.UserStack = 0;
+        BootCPU.ReturnStack = 0;
+        BootCPU.InUserCall = false;
+
+        //Interrupts taken in ring 3 use the same stack, a syscall can not be running while user code is.
+        DefaultTSS.RSP[0] = BootCPU.KernelStack;
+
+        //The kernel does not use GS, so it keeps the user value and the CPU data is only swapped in on entry.
+        CPU::WriteMSR(MSR_GS_BASE, 0);
+        CPU::WriteMSR(MSR_KERNEL_GS_BASE, (uint64_t)&BootCPU);
+
+        //SYSCALL loads CS and SS from bits 32 to 47, SYSRET loads them relative to bits 48 to 63.
+        CPU::WriteMSR(MSR_STAR, ((uint64_t)GDT_USER_BASE << 48) | ((uint64_t)GDT_KERNEL_CODE << 32));
+        CPU::WriteMSR(MSR_LSTAR, (uint64_t)SyscallEntry);
+        CPU::WriteMSR(MSR_SFMASK, SYSCALL_FLAGS_MASK);
+
+        CPU::WriteMSR(MSR_EFER, CPU::ReadMSR(MSR_EFER) | EFER_SCE);
+    }
+
+    CPUData* GetCPU()
+    {
+        return &BootCPU;
+    }
+}
+
+extern "C" STL::SYSRV SyscallDispatch(uint64_t Selector, uint64_t Argument)
+{
+    Syscall::BootCPU.InUserCall = true;
+    STL::SYSRV Result = System::UserCall(Selector, Argument);
+    Syscall::BootCPU.InUserCall = false;
+
+    return Result;
+}
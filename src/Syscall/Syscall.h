@@ -0,0 +1,76 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "STL/System/System.h"
+
+#define SYSCALL_STACK_SIZE 0x8000 //Also taken by IRQs from ring 3, which nest and keep their FPU state on it.
+
+#define SYSCALL_FLAGS_MASK 0x40700 //AC, DF, IF and TF are cleared on entry.
+
+#define USER_ABORTED 0xFFFFFFFFFFFFFFFF //Returned by EnterUser when the user code faulted.
+
+/// <summary>
+/// The path user code enters the kernel through. The selector is passed in RAX and the argument in RDI, the result is returned in RAX.
+/// RCX, R11 and the registers a SysV call may change are not preserved.
+/// </summary>
+namespace Syscall
+{
+    /// <summary>
+    /// The data of a CPU reached through GS after SWAPGS, the offsets are used by Syscall.asm.
+    /// </summary>
+    struct CPUData
+    {
+        uint64_t KernelStack;
+        uint64_t UserStack;
+        uint64_t ReturnStack;
+
+        /// <summary>
+        /// True while a syscall made by user code runs, a fault on user memory then abandons the user code instead of the kernel.
+        /// </summary>
+        bool InUserCall;
+    };
+
+    /// <summary>
+    /// Points the SYSCALL MSRs at SyscallEntry and gives the CPU its kernel stack, the GDT has to be loaded first.
+    /// </summary>
+    void Init();
+
+    /// <summary>
+    /// Returns the data of the current CPU without going through GS.
+    /// </summary>
+    CPUData* GetCPU();
+}
+
+/// <summary>
+/// Found in Syscall.asm
+/// </summary>
+extern "C" void SyscallEntry();
+
+/// <summary>
+/// Found in Syscall.asm, runs user code at Entry on Stack in the current address space until it makes the SYSCALL_EXIT syscall, returns its argument.
+/// The user code gets Argument in RDI. If it faults it is abandoned and USER_ABORTED is returned instead.
+/// </summary>
+extern "C" uint64_t EnterUser(uint64_t Entry, uint64_t Stack, uint64_t Argument = 0);
+
+/// <summary>
+/// Found in Syscall.asm, a fault handler returns here on the stack saved by EnterUser to abandon the user code.
+/// </summary>
+extern "C" void UserAbort();
+
+/// <summary>
+/// Found in Syscall.asm, like UserAbort for a fault in a syscall made by the user code, which still runs with the CPU data in GS.
+/// </summary>
+extern "C" void UserCallAbort();
+
+/// <summary>
+/// Found in Syscall.asm, position independent user code that makes 64 syscalls and exits, copied to a user page by the syscall benchmark.
+/// </summary>
+extern "C" uint8_t SyscallBenchStart[];
+
+extern "C" uint8_t SyscallBenchEnd[];
+
+/// <summary>
+/// Called by SyscallEntry with the registers of the caller, only the syscalls ring 3 is allowed to make are dispatched.
+/// </summary>
+extern "C" STL::SYSRV SyscallDispatch(uint64_t Selector, uint64_t Argument);
@@ -17,21 +17,33 @@
 #include "PIT/PIT.h"
 #include "Debug/Debug.h"
 #include "IO/IO.h"
+#include "CPU/CPU.h"
 #include "Memory/Paging/PageAllocator.h"
 #include "Memory/Heap.h"
 #include "ProcessHandler/ProcessHandler.h"
+#include "ProcessHandler/Compositor.h"
 #include "ACPI/ACPI.h"
 #include "PCI/PCI.h"
 #include "UEFI/UEFI.h"
 #include "AHCI/AHCI.h"
+#include "RAMFS/RAMFS.h"
+#include "ELF/ELF.h"
+#include "SharedPage/SharedPage.h"
+#include "IPC/IPC.h"
+#include "Syscall/Syscall.h"
+#include "Profiling/BootTrace.h"
+#include "Log/Log.h"
+#include "Profiling/Profiler.h"
+#include "Profiling/Bench.h"
 
 #include "Version.h"
 
-#include <cstdarg>
+#define DEBUG_EXIT_PORT 0xF4
+#define SCRIPT_MAX_LINE 256
 
 namespace System
 {
-    static char CommandOutput[1024];
+    static char CommandOutput[4096];
 
     const char* CommandSet(const char* Command)
     {        
@@ -57,7 +69,10 @@ namespace System
         SettableVar SettableVars[] =
         {
             SettableVar("drawmouse", &Renderer::DrawMouse, sizeof(Renderer::DrawMouse)),
-            SettableVar("font", &STL::SelectedFont, sizeof(STL::SelectedFont))
+            SettableVar("font", &STL::SelectedFont, sizeof(STL::SelectedFont)),
+            SettableVar("loglevel", &Log::MinimumLevel, sizeof(Log::MinimumLevel)),
+            SettableVar("heaptrace", &Heap::Trace, sizeof(Heap::Trace)),
+            SettableVar("fps", &Compositor::TargetFPS, sizeof(Compositor::TargetFPS))
         };
 
         uint64_t Hash = STL::HashWord(Variable);
@@ -155,21 +170,25 @@ namespace System
         {
         case STL::ConstHashWord("process"):
         {                  
-            WriteLine(2);
+            WriteLine(4);
       
             StartLine("TITLE");
-            EndLine("ID");
+            NextEntry("ID");
+            NextEntry("COALESCED REQUESTS");
+            EndLine("DROPPED REQUESTS");
 
-            WriteLine(2);
+            WriteLine(4);
 
-            for (uint32_t i = 0; i < ProcessHandler::Processes.Length(); i++)
+            for (Process* Current = ProcessTable::GetBottom(); Current != nullptr; Current = ProcessTable::GetAbove(Current))
             {                
-                StartLine(ProcessHandler::Processes[i]->GetTitle());
+                StartLine(Current->GetTitle());
 
-                EndLine(STL::ToString(ProcessHandler::Processes[i]->GetID()));
+                NextEntry(STL::ToString(Current->GetID()));
+                NextEntry(STL::ToString(Current->GetCoalescedRequests()));
+                EndLine(STL::ToString(Current->GetDroppedRequests()));
             }
 
-            WriteLine(2);
+            WriteLine(4);
         }
         break;
         case STL::ConstHashWord("pci"):
@@ -246,6 +265,46 @@ namespace System
             WriteLine(2);  
         }
         break;
+        case STL::ConstHashWord("files"):
+        {                    
+            WriteLine(2);   
+
+            StartLine("NAME");
+            EndLine("SIZE");
+
+            WriteLine(2);
+
+            RAMFS::File File;
+            RAMFS::ResetEnumeration();
+            while (RAMFS::Enumerate(File))
+            {
+                StartLine(File.Name);
+
+                EndLine(STL::ToString(File.Size));
+            }
+
+            WriteLine(2);  
+        }
+        break;
+        case STL::ConstHashWord("images"):
+        {                    
+            WriteLine(2);   
+
+            StartLine("NAME");
+            EndLine("SHARED PAGES");
+
+            WriteLine(2);
+
+            for (ELF::Image* Current = ELF::GetImages(); Current != nullptr; Current = Current->Next)
+            {
+                StartLine(Current->Name);
+
+                EndLine(STL::ToString(Current->SharedPageAmount));
+            }
+
+            WriteLine(2);  
+        }
+        break;
         default:
         {
             return "ERROR: List not found";
@@ -284,7 +343,10 @@ namespace System
             FOREGROUND_COLOR(255, 255, 255)"    set [VARIABLE] [VALUE]\n\n\r"
             FOREGROUND_COLOR(224, 108, 117)"    VARIABLE:\n\r"
             FOREGROUND_COLOR(255, 255, 255)"        drawmouse - A boolean value that sets if a cursor is drawn to the screen.\n\r"
-            FOREGROUND_COLOR(255, 255, 255)"        font - A byte value that sets what font is used to render text.\n\n\r"
+            FOREGROUND_COLOR(255, 255, 255)"        font - A byte value that sets what font is used to render text.\n\r"
+            FOREGROUND_COLOR(255, 255, 255)"        loglevel - A byte value that sets the lowest severity written to the kernel log (0 = debug, 3 = error).\n\r"
+            FOREGROUND_COLOR(255, 255, 255)"        heaptrace - A boolean value that sets if every heap allocation and free is written to the kernel log.\n\r"
+            FOREGROUND_COLOR(255, 255, 255)"        fps - The rate frames are presented at, 0 presents as soon as anything is drawn.\n\n\r"
             FOREGROUND_COLOR(086, 182, 194)"    VALUE:\n\r"
             FOREGROUND_COLOR(255, 255, 255)"        Any positive integer.\n\n\r"
             ),
@@ -294,9 +356,11 @@ namespace System
             FOREGROUND_COLOR(086, 182, 194)"SYNOPSIS:\n\r"
             FOREGROUND_COLOR(255, 255, 255)"    list [LIST]\n\n\r"
             FOREGROUND_COLOR(224, 108, 117)"    LIST:\n\r"
-            FOREGROUND_COLOR(255, 255, 255)"        process - A list of all currently running processes.\n\r"
+            FOREGROUND_COLOR(255, 255, 255)"        process - A list of all currently running processes and how many of their requests were coalesced or dropped.\n\r"
             FOREGROUND_COLOR(255, 255, 255)"        pci - A list of all connected PCI devices.\n\r"
             FOREGROUND_COLOR(255, 255, 255)"        sata - A list of all sata ports.\n\r"
+            FOREGROUND_COLOR(255, 255, 255)"        files - A list of all files in the initrd.\n\r"
+            FOREGROUND_COLOR(255, 255, 255)"        images - A list of all programs loaded by exec and how many read only pages they share.\n\r"
             ),
             Manual("time", "Allows access to the time values read from the appropriate CMOS registers.",
             FOREGROUND_COLOR(086, 182, 194)"\nNAME:\n\r"
@@ -324,6 +388,17 @@ namespace System
             FOREGROUND_COLOR(255, 255, 255)"        terminal - A GUI terminal.\n\r"
             FOREGROUND_COLOR(255, 255, 255)"        tty - A terminal like process that starts at boot.\n\r"
             ),           
+            Manual("exec", "Runs an ELF64 program from the initrd in ring 3 until it exits.",
+            FOREGROUND_COLOR(086, 182, 194)"\nNAME:\n\r"
+            FOREGROUND_COLOR(255, 255, 255)"    exec - Runs an ELF64 program from the initrd in ring 3 until it exits.\n\r"
+            FOREGROUND_COLOR(255, 255, 255)"    The process loop runs it once the command returns and reports the result, a program still running after 10 seconds is aborted.\n\n\r"
+            FOREGROUND_COLOR(086, 182, 194)"SYNOPSIS:\n\r"
+            FOREGROUND_COLOR(255, 255, 255)"    exec [FILE] [ARGUMENT]\n\n\r"
+            FOREGROUND_COLOR(224, 108, 117)"    FILE:\n\r"
+            FOREGROUND_COLOR(255, 255, 255)"        A static or position independent executable, its entry point is called with ARGUMENT and it exits with the exit syscall.\n\n\r"
+            FOREGROUND_COLOR(086, 182, 194)"    ARGUMENT:\n\r"
+            FOREGROUND_COLOR(255, 255, 255)"        Any positive integer, 0 if left out.\n\n\r"
+            ),
             Manual("suicide", "Send a request to kill the process that called the command.",
             FOREGROUND_COLOR(086, 182, 194)"\nNAME:\n\r"
             FOREGROUND_COLOR(255, 255, 255)"    suicide - Send a request to kill the process that called the command.\n\r"
@@ -344,6 +419,49 @@ namespace System
             FOREGROUND_COLOR(086, 182, 194)"\nNAME:\n\r"
             FOREGROUND_COLOR(255, 255, 255)"    sysfetch - A neofetch lookalike to give system information.\n\r"
             ), 
+            Manual("dmesg", "Shows the most recent messages in the kernel log.",
+            FOREGROUND_COLOR(086, 182, 194)"\nNAME:\n\r"
+            FOREGROUND_COLOR(255, 255, 255)"    dmesg - Shows the most recent messages in the kernel log, the full log is sent over COM1.\n\r"
+            ), 
+            Manual("perf", "A sampling profiler for the kernel.",
+            FOREGROUND_COLOR(086, 182, 194)"\nNAME:\n\r"
+            FOREGROUND_COLOR(255, 255, 255)"    perf - A sampling profiler that records where the kernel was interrupted by the timer.\n\n\r"
+            FOREGROUND_COLOR(086, 182, 194)"SYNOPSIS:\n\r"
+            FOREGROUND_COLOR(255, 255, 255)"    perf [ACTION]\n\n\r"
+            FOREGROUND_COLOR(224, 108, 117)"    ACTION:\n\r"
+            FOREGROUND_COLOR(255, 255, 255)"        start - Clears the previous samples and starts sampling.\n\r"
+            FOREGROUND_COLOR(255, 255, 255)"        stop - Stops sampling.\n\r"
+            FOREGROUND_COLOR(255, 255, 255)"        report - Shows the most sampled kernel functions.\n\r"
+            ), 
+            Manual("bench", "Runs the kernel microbenchmarks.",
+            FOREGROUND_COLOR(086, 182, 194)"\nNAME:\n\r"
+            FOREGROUND_COLOR(255, 255, 255)"    bench - Times kernel primitives with the TSC and reports the min, median and p99 of each.\n\r"
+            FOREGROUND_COLOR(255, 255, 255)"    The process loop runs them once the command returns and reports the results.\n\n\r"
+            FOREGROUND_COLOR(086, 182, 194)"SYNOPSIS:\n\r"
+            FOREGROUND_COLOR(255, 255, 255)"    bench [FILTER]\n\n\r"
+            FOREGROUND_COLOR(224, 108, 117)"    FILTER:\n\r"
+            FOREGROUND_COLOR(255, 255, 255)"        Only runs the benchmarks whose name starts with FILTER, for example heap, page, copy, set, draw or print.\n\r"
+            ), 
+            Manual("exit", "Exits the emulator through the isa-debug-exit device.",
+            FOREGROUND_COLOR(086, 182, 194)"\nNAME:\n\r"
+            FOREGROUND_COLOR(255, 255, 255)"    exit - Flushes the kernel log and exits QEMU through the isa-debug-exit device at port 0xF4.\n\n\r"
+            FOREGROUND_COLOR(086, 182, 194)"SYNOPSIS:\n\r"
+            FOREGROUND_COLOR(255, 255, 255)"    exit [CODE]\n\n\r"
+            FOREGROUND_COLOR(224, 108, 117)"    CODE:\n\r"
+            FOREGROUND_COLOR(255, 255, 255)"        QEMU exits with the status (CODE << 1) | 1.\n\r"
+            ), 
+            Manual("boottime", "Shows how long each stage of the boot took.",
+            FOREGROUND_COLOR(086, 182, 194)"\nNAME:\n\r"
+            FOREGROUND_COLOR(255, 255, 255)"    boottime - Shows how long each stage of the boot took, measured with the TSC.\n\r"
+            ), 
+            Manual("frames", "Shows frame time statistics of the compositor.",
+            FOREGROUND_COLOR(086, 182, 194)"\nNAME:\n\r"
+            FOREGROUND_COLOR(255, 255, 255)"    frames - Shows the average, p95 and worst time to compose the last frames and how many frames were dropped.\n\n\r"
+            FOREGROUND_COLOR(086, 182, 194)"SYNOPSIS:\n\r"
+            FOREGROUND_COLOR(255, 255, 255)"    frames [ACTION]\n\n\r"
+            FOREGROUND_COLOR(224, 108, 117)"    ACTION:\n\r"
+            FOREGROUND_COLOR(255, 255, 255)"        reset - Clears the recorded frames.\n\r"
+            ), 
         };  
 
         uint64_t Hash = STL::HashWord(STL::NextWord(Command));
@@ -507,33 +625,34 @@ namespace System
         return "";
     }   
 
-    const char* CommandStart(const char* Command)
+    struct StartableProcess
     {
-        struct StartableProcess
-        {
-            const char* Name;
-            uint64_t Hash;
-            STL::PROC Procedure;
+        const char* Name;
+        uint64_t Hash;
+        STL::PROC Procedure;
 
-            StartableProcess(const char* Name, STL::PROC Procedure)
-            {
-                this->Procedure = Procedure;
-                this->Name = Name;
-                this->Hash = STL::HashWord(Name);
-            }
-        };
-
-        StartableProcess StartableProcesses[] =
+        constexpr StartableProcess(const char* Name, STL::PROC Procedure)
         {
-            StartableProcess("tty", tty::Procedure),
-            StartableProcess("desktop", Desktop::Procedure),
-            StartableProcess("topbar", Topbar::Procedure),
-            StartableProcess("systemmenu", SystemMenu::Procedure),
-            StartableProcess("startmenu", StartMenu::Procedure),
-            StartableProcess("terminal", Terminal::Procedure),
-            StartableProcess("calculator", Calculator::Procedure)
-        };
+            this->Procedure = Procedure;
+            this->Name = Name;
+            this->Hash = STL::ConstHashWord(Name);
+        }
+    };
+
+    //Indexed by STL::PROG.
+    static const StartableProcess StartableProcesses[] =
+    {
+        StartableProcess("tty", tty::Procedure),
+        StartableProcess("desktop", Desktop::Procedure),
+        StartableProcess("topbar", Topbar::Procedure),
+        StartableProcess("systemmenu", SystemMenu::Procedure),
+        StartableProcess("startmenu", StartMenu::Procedure),
+        StartableProcess("terminal", Terminal::Procedure),
+        StartableProcess("calculator", Calculator::Procedure)
+    };
 
+    const char* CommandStart(const char* Command)
+    {
         uint64_t Hash = STL::HashWord(STL::NextWord(Command));
         for (uint32_t i = 0; i < sizeof(StartableProcesses)/sizeof(StartableProcesses[0]); i++)
         {
@@ -546,6 +665,46 @@ namespace System
         return "ERROR: Process not found";
     }
 
+    const char* CommandExec(const char* Command)
+    {
+        const char* Word = STL::NextWord(Command);
+
+        char Path[100];
+        uint64_t Length = 0;
+        while (Word[Length] != 0 && Word[Length] != ' ' && Length < sizeof(Path) - 1)
+        {
+            Path[Length] = Word[Length];
+            Length++;
+        }
+        Path[Length] = 0;
+
+        uint64_t Argument = Word[Length] == ' ' ? STL::ToInt(Word + Length + 1) : 0;
+
+        ELF::Program* NewProgram = ELF::Load(Path);
+        if (NewProgram == nullptr)
+        {
+            return "ERROR: Not an executable in the initrd";
+        }
+
+        uint64_t Result = ELF::Run(NewProgram, Argument);
+        uint64_t PageFaults = NewProgram->PageFaults;
+        ELF::Unload(NewProgram);
+
+        if (Result == USER_ABORTED)
+        {
+            return "ERROR: Program aborted after a fault";
+        }
+
+        char* Index = STL::CopyString(CommandOutput, "Exited with ") + 1;
+        Index = STL::CopyString(Index, STL::ToString(Result)) + 1;
+        Index = STL::CopyString(Index, " after ") + 1;
+        Index = STL::CopyString(Index, STL::ToString(PageFaults)) + 1;
+        Index = STL::CopyString(Index, " page faults") + 1;
+        *Index = 0;
+
+        return CommandOutput;
+    }
+
     const char* CommandHeapvis(const char* Command)
     {    
         char* Index = CommandOutput;
@@ -646,7 +805,7 @@ namespace System
         Write(7, "Used Heap: ", STL::ToString(Heap::GetUsedSize() / 1000), " KB   ");
         Write(8, "Total Heap: ", STL::ToString((Heap::GetUsedSize() + Heap::GetFreeSize()) / 1000), " KB   ");
         Write(9, "Heap Segments: ", STL::ToString(Heap::GetSegmentAmount()));
-        Write(10, "Process Amount: ", STL::ToString(ProcessHandler::Processes.Length()));
+        Write(10, "Process Amount: ", STL::ToString(ProcessTable::GetAmount()));
 
         Write(14, "\033B040044052   \033B224108117   \033B229192123   \033B152195121   \033B097175239   \033B198120221   \033B000000000");
         Write(15, "\033B040044052   \033B224108117   \033B229192123   \033B152195121   \033B097175239   \033B198120221   \033B000000000");
@@ -654,79 +813,483 @@ namespace System
         return Sysfetch;
     }   
 
-    const char* System(const char* Input)
-    {        
-        struct Command
+    const char* CommandDmesg(const char* Command)
+    {
+        return Log::GetDump();
+    }
+
+    const char* CommandPerf(const char* Command)
+    {
+        uint64_t Hash = STL::HashWord(STL::NextWord(Command));
+        switch (Hash)
         {
-            const char* Name;
-            uint64_t Hash;
-            const char* (*Function)(const char*);
+        case STL::ConstHashWord("start"):
+        {
+            Profiler::Start();
+            return "Profiler started";
+        }
+        break;
+        case STL::ConstHashWord("stop"):
+        {
+            Profiler::Stop();
+            return "Profiler stopped";
+        }
+        break;
+        case STL::ConstHashWord("report"):
+        {
+            const char* Report = Profiler::GetReport();
+            Log::Info(Report);
+            return Report;
+        }
+        break;
+        }
 
-            Command(const char* Name, const char* (*Function)(const char*))
-            {
-                this->Function = Function;
-                this->Name = Name;
-                this->Hash = STL::HashWord(Name);
-            }
-        };
+        return "ERROR: Invalid value of ACTION";
+    }
 
-        Command Commands[] =
-        {
-            Command("set", CommandSet),
-            Command("list", CommandList),
-            Command("help", CommandHelp),
-            Command("time", CommandTime),
-            Command("date", CommandDate),
-            Command("kill", CommandKill),
-            Command("clear", CommandClear),
-            Command("start", CommandStart),
-            Command("restart", CommandRestart),
-            Command("shutdown", CommandShutdown),
-            Command("suicide", CommandSuicide),
-            Command("heapvis", CommandHeapvis),
-            Command("sysfetch", CommandSysfetch)
-        };
+    const char* CommandBench(const char* Command)
+    {
+        return Bench::Run(STL::NextWord(Command));
+    }
+
+    const char* CommandExit(const char* Command)
+    {
+        //Get everything out over serial before the emulator goes away.
+        uint64_t Flags = CPU::DisableInterrupts();
+        Log::Flush();
+        IO::OutByte(DEBUG_EXIT_PORT, STL::ToInt(STL::NextWord(Command)));
+        CPU::RestoreInterrupts(Flags);
+
+        return "ERROR: No isa-debug-exit device";
+    }
+
+    const char* CommandBoottime(const char* Command)
+    {
+        return BootTrace::GetReport();
+    }
+
+    const char* CommandFrames(const char* Command)
+    {
+        if (STL::HashWord(STL::NextWord(Command)) == STL::ConstHashWord("reset"))
+        {
+            Compositor::ResetFrameStats();
+            return "Frame statistics reset";
+        }
+
+        return Compositor::GetFrameStats();
+    }
 
+    struct Command
+    {
+        const char* Name;
+        uint64_t Hash;
+        const char* (*Function)(const char*);
+
+        /// <summary>
+        /// Run by the process loop instead of the caller, for commands that enter ring 3 or take long.
+        /// Procedures issue commands from IRQs, where user code would run with interrupts enabled inside the handler and hold back its EOI.
+        /// </summary>
+        bool Deferred;
+
+        constexpr Command(const char* Name, const char* (*Function)(const char*), bool Deferred = false)
+        {
+            this->Function = Function;
+            this->Name = Name;
+            this->Hash = STL::ConstHashWord(Name);
+            this->Deferred = Deferred;
+        }
+    };
+
+    static const Command Commands[] =
+    {
+        Command("set", CommandSet),
+        Command("list", CommandList),
+        Command("help", CommandHelp),
+        Command("time", CommandTime),
+        Command("date", CommandDate),
+        Command("kill", CommandKill),
+        Command("clear", CommandClear),
+        Command("start", CommandStart),
+        Command("exec", CommandExec, true),
+        Command("restart", CommandRestart),
+        Command("shutdown", CommandShutdown),
+        Command("suicide", CommandSuicide),
+        Command("heapvis", CommandHeapvis),
+        Command("sysfetch", CommandSysfetch),
+        Command("boottime", CommandBoottime),
+        Command("frames", CommandFrames),
+        Command("dmesg", CommandDmesg),
+        Command("perf", CommandPerf),
+        Command("bench", CommandBench, true),
+        Command("exit", CommandExit)
+    };
+
+    //The deferred command waiting for or being run by the process loop, one at a time.
+    const Command* volatile DeferredCommand = nullptr;
+    char DeferredInput[SCRIPT_MAX_LINE];
+    uint64_t DeferredProcessID = 0; //0 if no process issued it.
+
+    const char* Run(const char* Input, bool Now)
+    {        
         uint64_t Hash = STL::HashWord(Input);
         for (uint32_t i = 0; i < sizeof(Commands)/sizeof(Commands[0]); i++)
         {
-            if (Hash == Commands[i].Hash)
+            if (Hash != Commands[i].Hash)
+            {
+                continue;
+            }
+
+            if (Now || !Commands[i].Deferred)
             {
                 return Commands[i].Function(Input);
             }
+
+            uint64_t Flags = CPU::DisableInterrupts();
+            if (DeferredCommand != nullptr)
+            {
+                CPU::RestoreInterrupts(Flags);
+                return "ERROR: Another command is still running";
+            }
+
+            uint64_t Length = 0;
+            while (Input[Length] != 0 && Length < SCRIPT_MAX_LINE - 1)
+            {
+                DeferredInput[Length] = Input[Length];
+                Length++;
+            }
+            DeferredInput[Length] = 0;
+            DeferredProcessID = ProcessHandler::LastMessagedProcess != nullptr ? ProcessHandler::LastMessagedProcess->GetID() : 0;
+            DeferredCommand = &Commands[i];
+
+            CPU::RestoreInterrupts(Flags);
+            return "Running, the output follows when done";
         }
 
         return "ERROR: Command not found";
     }
 
-    STL::SYSRV Call(uint64_t Selector...)
+    const char* System(const char* Input)
     {
-        va_list Args;
-        va_start(Args, Selector);
+        return Run(Input, false);
+    }
 
-        STL::SYSRV ReturnVal = 0;
+    void RunDeferred()
+    {
+        if (DeferredCommand == nullptr)
+        {
+            return;
+        }
+
+        const char* Output = DeferredCommand->Function(DeferredInput);
+        Log::Info(Output);
 
-        switch (Selector)
+        Process* Issuer = ProcessHandler::GetProcess(DeferredProcessID);
+        if (Issuer != nullptr)
         {
-        case 0:
+            Issuer->SendMessage(STL::PROM::OUTPUT, (STL::PROI)Output);
+        }
+
+        DeferredCommand = nullptr;
+    }
+
+    void RunScript(const char* Script, uint64_t Size)
+    {
+        char Line[SCRIPT_MAX_LINE];
+        uint64_t LineLength = 0;
+
+        for (uint64_t i = 0; i <= Size; i++)
         {
-            ReturnVal = (STL::SYSRV)System::System(va_arg(Args, const char*));
+            if (i == Size || Script[i] == '\n' || Script[i] == 0)
+            {
+                Line[LineLength] = 0;
+                if (LineLength != 0)
+                {
+                    Log::Info(Line);
+                    Log::Info(Run(Line, true));
+                }
+                LineLength = 0;
+
+                if (i == Size || Script[i] == 0)
+                {
+                    break;
+                }
+            }
+            else if (Script[i] != '\r' && LineLength < SCRIPT_MAX_LINE - 1)
+            {
+                Line[LineLength++] = Script[i];
+            }
         }
-        break;
-        case 1:
+    }
+
+    STL::SYSRV SyscallSystem(uint64_t Argument)
+    {
+        return (STL::SYSRV)System((const char*)Argument);
+    }
+
+    STL::SYSRV SyscallMalloc(uint64_t Argument)
+    {
+        return (STL::SYSRV)Heap::Allocate(Argument);
+    }
+
+    STL::SYSRV SyscallFree(uint64_t Argument)
+    {
+        Heap::Free((void*)Argument);
+        return 0;
+    }
+
+    STL::SYSRV SyscallStart(uint64_t Argument)
+    {
+        if (Argument >= sizeof(StartableProcesses)/sizeof(StartableProcesses[0]))
         {
-            ReturnVal = (STL::SYSRV)Heap::Allocate(va_arg(Args, uint64_t));
+            return 0;
         }
-        break;
-        case 2:
+
+        return ProcessHandler::StartProcess(StartableProcesses[Argument].Procedure);
+    }
+
+    STL::SYSRV SyscallKill(uint64_t Argument)
+    {
+        return ProcessHandler::KillProcess(Argument);
+    }
+
+    STL::SYSRV SyscallTime(uint64_t Argument)
+    {
+        STL::TINFO* Info = (STL::TINFO*)Argument;
+
+        Info->Second = RTC::GetSecond();
+        Info->Minute = RTC::GetMinute();
+        Info->Hour = RTC::GetHour();
+        Info->Day = RTC::GetDay();
+        Info->Month = RTC::GetMonth();
+        Info->Year = 2000 + RTC::GetYear();
+
+        return 0;
+    }
+
+    STL::SYSRV SyscallStat(uint64_t Argument)
+    {
+        STL::SINFO* Info = (STL::SINFO*)Argument;
+
+        Info->ProcessAmount = ProcessTable::GetAmount();
+        Info->FreeMemory = PageAllocator::GetFreePages() * 4096;
+        Info->UsedMemory = (PageAllocator::GetTotalPages() - PageAllocator::GetFreePages()) * 4096;
+        Info->HeapUsed = Heap::GetUsedSize();
+        Info->Ticks = PIT::Ticks;
+
+        return 0;
+    }
+
+    STL::SYSRV SyscallExit(uint64_t Argument)
+    {
+        //Only has a meaning in user mode, where SyscallEntry handles it.
+        return 0;
+    }
+
+    STL::SYSRV SyscallWait(uint64_t Argument)
+    {
+        STL::WINFO* Info = (STL::WINFO*)Argument;
+
+        if (ProcessHandler::LastMessagedProcess == nullptr)
         {
-            Heap::Free(va_arg(Args, void*));
+            return false;
         }
-        break;
+
+        return IPC::Wait(ProcessHandler::LastMessagedProcess->GetID(), Info->Address, Info->Expected);
+    }
+
+    STL::SYSRV SyscallWake(uint64_t Argument)
+    {
+        return IPC::Wake((volatile uint32_t*)Argument);
+    }
+
+    STL::SYSRV SyscallChannelCreate(uint64_t Argument)
+    {
+        STL::CINFO* Info = (STL::CINFO*)Argument;
+
+        return IPC::CreateChannel(Info->MessageSize, Info->Capacity);
+    }
+
+    STL::SYSRV SyscallChannelOpen(uint64_t Argument)
+    {
+        return (STL::SYSRV)IPC::OpenChannel(Argument);
+    }
+
+    STL::SYSRV SyscallChannelClose(uint64_t Argument)
+    {
+        IPC::CloseChannel(Argument);
+        return 0;
+    }
+
+    STL::SYSRV SyscallRingSetup(uint64_t Argument)
+    {
+        if (ProcessHandler::LastMessagedProcess == nullptr)
+        {
+            return 0;
+        }
+
+        return (STL::SYSRV)ProcessHandler::LastMessagedProcess->SetupRing(Argument);
+    }
+
+    STL::SYSRV SyscallRingEnter(uint64_t Argument)
+    {
+        //A process may only enter its own ring.
+        if (ProcessHandler::LastMessagedProcess == nullptr || (uint64_t)ProcessHandler::LastMessagedProcess->GetRing() != Argument)
+        {
+            return 0;
         }
 
-        va_end(Args);
+        return Drain((STL::SyscallRing*)Argument);
+    }
+
+    STL::SYSRV SyscallSystemPage(uint64_t Argument)
+    {
+        return (uint64_t)SharedPage::Get();
+    }
+
+    //The versions ring 3 gets, every pointer has to point into the user region. A fault on one abandons the user code.
+    STL::SYSRV UserSyscallTime(uint64_t Argument)
+    {
+        if (!AddressSpace::IsUser((void*)Argument, sizeof(STL::TINFO)))
+        {
+            return 0;
+        }
+
+        return SyscallTime(Argument);
+    }
+
+    STL::SYSRV UserSyscallStat(uint64_t Argument)
+    {
+        if (!AddressSpace::IsUser((void*)Argument, sizeof(STL::SINFO)))
+        {
+            return 0;
+        }
+
+        return SyscallStat(Argument);
+    }
+
+    STL::SYSRV UserSyscallWait(uint64_t Argument)
+    {
+        if (!AddressSpace::IsUser((void*)Argument, sizeof(STL::WINFO)))
+        {
+            return false;
+        }
+
+        //Read once, so the checked address is the one used.
+        STL::WINFO Info = *(STL::WINFO*)Argument;
+        if (!AddressSpace::IsUser((void*)Info.Address, sizeof(uint32_t)))
+        {
+            return false;
+        }
+
+        return SyscallWait((uint64_t)&Info);
+    }
+
+    STL::SYSRV UserSyscallWake(uint64_t Argument)
+    {
+        if (!AddressSpace::IsUser((void*)Argument, sizeof(uint32_t)))
+        {
+            return 0;
+        }
+
+        return SyscallWake(Argument);
+    }
+
+    STL::SYSRV UserSyscallSystemPage(uint64_t Argument)
+    {
+        //Where ELF::Load mapped the page, the identity mapped one is not reachable from ring 3.
+        return ELF_SYSTEM_PAGE;
+    }
+
+    //Indexed by the SYSCALL_ selectors.
+    static STL::SYSRV (* const Syscalls[])(uint64_t) =
+    {
+        SyscallSystem,
+        SyscallMalloc,
+        SyscallFree,
+        SyscallStart,
+        SyscallKill,
+        SyscallTime,
+        SyscallStat,
+        SyscallExit,
+        SyscallWait,
+        SyscallWake,
+        SyscallChannelCreate,
+        SyscallChannelOpen,
+        SyscallChannelClose,
+        SyscallRingSetup,
+        SyscallRingEnter,
+        SyscallSystemPage
+    };
+
+    //Indexed by the SYSCALL_ selectors, what ring 3 may call. The kernel heap, commands and channels are kernel memory and
+    //rings belong to processes, so those are refused. exec would also enter user mode again on the stacks in use.
+    static STL::SYSRV (* const UserSyscalls[])(uint64_t) =
+    {
+        nullptr,
+        nullptr,
+        nullptr,
+        SyscallStart,
+        SyscallKill,
+        UserSyscallTime,
+        UserSyscallStat,
+        SyscallExit,
+        UserSyscallWait,
+        UserSyscallWake,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        UserSyscallSystemPage
+    };
+
+    STL::SYSRV Call(uint64_t Selector, uint64_t Argument)
+    {
+        if (Selector >= sizeof(Syscalls)/sizeof(Syscalls[0]))
+        {
+            return 0;
+        }
+
+        return Syscalls[Selector](Argument);
+    }
+
+    STL::SYSRV UserCall(uint64_t Selector, uint64_t Argument)
+    {
+        if (Selector >= sizeof(UserSyscalls)/sizeof(UserSyscalls[0]) || UserSyscalls[Selector] == nullptr)
+        {
+            return 0;
+        }
+
+        return UserSyscalls[Selector](Argument);
+    }
+
+    uint64_t Drain(STL::SyscallRing* Ring)
+    {
+        STL::SQE* Submissions = Ring->GetSubmissions();
+        STL::CQE* Completions = Ring->GetCompletions();
+        uint32_t Mask = Ring->Capacity - 1;
+
+        uint64_t Amount = 0;
+        uint32_t Head = Ring->SubmissionHead;
+        uint32_t CompletionTail = Ring->CompletionTail;
+        while (Head != __atomic_load_n(&Ring->SubmissionTail, __ATOMIC_ACQUIRE) &&
+               CompletionTail - __atomic_load_n(&Ring->CompletionHead, __ATOMIC_ACQUIRE) != Ring->Capacity)
+        {
+            STL::SQE Entry = Submissions[Head & Mask];
+            __atomic_store_n(&Ring->SubmissionHead, ++Head, __ATOMIC_RELEASE);
+
+            //Entering a ring from a ring would recurse and exit is not a call.
+            STL::SYSRV Result = 0;
+            if (Entry.Selector != SYSCALL_RING_SETUP && Entry.Selector != SYSCALL_RING_ENTER && Entry.Selector != SYSCALL_EXIT)
+            {
+                Result = Call(Entry.Selector, Entry.Argument);
+            }
+
+            Completions[CompletionTail & Mask] = {Entry.UserData, Result};
+            __atomic_store_n(&Ring->CompletionTail, ++CompletionTail, __ATOMIC_RELEASE);
+            Amount++;
+        }
 
-        return ReturnVal;
+        return Amount;
     }
 }
\ No newline at end of file
@@ -3,8 +3,40 @@
 #include <stdint.h>
 
 #include "STL/System/System.h"
+#include "STL/System/Ring.h"
 
 namespace System
 {
-    STL::SYSRV Call(uint64_t Selector...);
+    /// <summary>
+    /// Runs a command and returns its output. Deferred commands like exec are queued for RunDeferred instead,
+    /// their output is logged and sent to the issuing process as an OUTPUT message.
+    /// </summary>
+    const char* System(const char* Input);
+
+    /// <summary>
+    /// Runs the deferred command if one is queued, called by the process loop.
+    /// </summary>
+    void RunDeferred();
+
+    /// <summary>
+    /// Runs every line of Script as a command and writes the output to the kernel log, Script does not need to be null terminated.
+    /// Called before the process loop starts, so deferred commands are run right away.
+    /// </summary>
+    void RunScript(const char* Script, uint64_t Size);
+
+    /// <summary>
+    /// Dispatches a syscall through the table of SYSCALL_ selectors, an unknown selector returns 0.
+    /// </summary>
+    STL::SYSRV Call(uint64_t Selector, uint64_t Argument = 0);
+
+    /// <summary>
+    /// Dispatches a syscall made from ring 3, only the selectors ring 3 may use are run and pointer arguments are checked to be user memory.
+    /// A refused or unknown selector returns 0.
+    /// </summary>
+    STL::SYSRV UserCall(uint64_t Selector, uint64_t Argument);
+
+    /// <summary>
+    /// Runs the syscalls queued on a ring for as long as there is room for their completions, returns how many completed.
+    /// </summary>
+    uint64_t Drain(STL::SyscallRing* Ring);
 }
\ No newline at end of file
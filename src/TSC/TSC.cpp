@@ -0,0 +1,75 @@
+#include "TSC.h"
+
+#include "IO/IO.h"
+#include "PIT/PIT.h"
+
+#define PIT_CHANNEL2_DATA 0x42
+#define PIT_COMMAND 0x43
+#define PIT_CHANNEL2_GATE 0x61
+
+#define CALIBRATION_HZ 20 //Calibrate over 1/20th of a second.
+
+namespace TSC
+{
+    uint64_t Frequency = 0;
+
+    uint64_t Read()
+    {
+        uint32_t Low;
+        uint32_t High;
+        asm volatile ("RDTSC" : "=a"(Low), "=d"(High));
+        return ((uint64_t)High << 32) | Low;
+    }
+
+    void Calibrate()
+    {
+        uint16_t Count = PIT_FREQUENCY / CALIBRATION_HZ;
+
+        //Disable the speaker and enable the channel 2 gate.
+        IO::OutByte(PIT_CHANNEL2_GATE, (IO::InByte(PIT_CHANNEL2_GATE) & ~0x02) | 0x01);
+
+        //Channel 2, lobyte/hibyte, mode 0 (interrupt on terminal count).
+        IO::OutByte(PIT_COMMAND, 0b10110000);
+        IO::OutByte(PIT_CHANNEL2_DATA, (uint8_t)Count);
+        IO::OutByte(PIT_CHANNEL2_DATA, (uint8_t)(Count >> 8));
+
+        //Restart the count by toggling the gate.
+        uint8_t Gate = IO::InByte(PIT_CHANNEL2_GATE) & ~0x01;
+        IO::OutByte(PIT_CHANNEL2_GATE, Gate);
+        IO::OutByte(PIT_CHANNEL2_GATE, Gate | 0x01);
+
+        uint64_t Start = Read();
+        while (!(IO::InByte(PIT_CHANNEL2_GATE) & 0x20))
+        {
+
+        }
+        uint64_t End = Read();
+
+        Frequency = (End - Start) * CALIBRATION_HZ;
+    }
+
+    uint64_t GetFrequency()
+    {
+        return Frequency;
+    }
+
+    uint64_t ToMicroseconds(uint64_t Cycles)
+    {
+        if (Frequency == 0)
+        {
+            return 0;
+        }
+
+        return (Cycles / Frequency) * 1000000 + ((Cycles % Frequency) * 1000000) / Frequency;
+    }
+
+    uint64_t ToNanoseconds(uint64_t Cycles)
+    {
+        if (Frequency == 0)
+        {
+            return 0;
+        }
+
+        return (Cycles / Frequency) * 1000000000 + ((Cycles % Frequency) * 1000000000) / Frequency;
+    }
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <stdint.h>
+
+namespace TSC
+{
+    /// <summary>
+    /// Returns the current value of the time stamp counter.
+    /// </summary>
+    uint64_t Read();
+
+    /// <summary>
+    /// Measures the TSC frequency against PIT channel 2, must be called with interrupts disabled.
+    /// </summary>
+    void Calibrate();
+
+    /// <summary>
+    /// Returns the calibrated TSC frequency in Hz, or 0 if Calibrate has not been called.
+    /// </summary>
+    uint64_t GetFrequency();
+
+    uint64_t ToMicroseconds(uint64_t Cycles);
+
+    uint64_t ToNanoseconds(uint64_t Cycles);
+}
@@ -0,0 +1,224 @@
+#include "Virtio.h"
+
+#include "STL/Memory/Memory.h"
+
+#include "Memory/Paging/PageTable.h"
+#include "Memory/Paging/PageAllocator.h"
+
+#define PCI_COMMAND_MEMORY (1 << 1)
+#define PCI_COMMAND_BUS_MASTER (1 << 2)
+#define PCI_STATUS_CAPABILITIES (1 << 4)
+
+#define PCI_CAPABILITY_VENDOR 0x09
+
+#define VIRTIO_PCI_CAP_COMMON_CFG 1
+#define VIRTIO_PCI_CAP_NOTIFY_CFG 2
+#define VIRTIO_PCI_CAP_ISR_CFG 3
+#define VIRTIO_PCI_CAP_DEVICE_CFG 4
+
+#define VIRTIO_STATUS_ACKNOWLEDGE 1
+#define VIRTIO_STATUS_DRIVER 2
+#define VIRTIO_STATUS_DRIVER_OK 4
+#define VIRTIO_STATUS_FEATURES_OK 8
+
+#define VIRTIO_F_VERSION_1 ((uint64_t)1 << 32)
+
+namespace Virtio
+{
+    struct PCICapability
+    {
+        uint8_t Vendor;
+        uint8_t Next;
+        uint8_t Length;
+        uint8_t Type;
+        uint8_t BAR;
+        uint8_t ID;
+        uint8_t Padding[2];
+        uint32_t Offset;
+        uint32_t Size;
+    } __attribute__((packed));
+
+    /// <summary>
+    /// Returns the address of memory bar Index and identity maps Size bytes starting at Offset inside it.
+    /// </summary>
+    uint64_t MapBAR(PCIHeader* Header, uint8_t Index, uint32_t Offset, uint32_t Size)
+    {
+        uint32_t* BARs = (uint32_t*)((uint64_t)Header + sizeof(DeviceHeader));
+
+        uint64_t Address = BARs[Index] & ~(uint64_t)0xF;
+        if ((BARs[Index] & 0b110) == 0b100 && Index < 5)
+        {
+            Address |= (uint64_t)BARs[Index + 1] << 32;
+        }
+
+        for (uint64_t Page = (Address + Offset) & ~(uint64_t)4095; Page < Address + Offset + Size; Page += 4096)
+        {
+            PageTableManager::MapAddress((void*)Page, (void*)Page);
+        }
+
+        return Address + Offset;
+    }
+
+    bool Init(Device& Out, uint16_t Type, uint64_t Features)
+    {
+        Out.Header = nullptr;
+
+        DeviceHeader* Header;
+        PCI::ResetEnumeration();
+        while (PCI::Enumerate(Header))
+        { 
+            if (Header->VendorID == VIRTIO_VENDOR_ID && Header->DeviceID == VIRTIO_MODERN_DEVICE_ID + Type)
+            {
+                Out.Header = (PCIHeader*)Header;
+            }
+        }
+
+        if (Out.Header == nullptr || !(Out.Header->Header.Status & PCI_STATUS_CAPABILITIES))
+        {
+            return false;
+        }
+
+        Out.Header->Header.Command |= PCI_COMMAND_MEMORY | PCI_COMMAND_BUS_MASTER;
+
+        Out.Common = nullptr;
+        Out.ISR = nullptr;
+        Out.DeviceConfig = nullptr;
+        Out.NotifyBase = 0;
+
+        uint8_t Offset = Out.Header->CapabilitiesPtr & ~0b11;
+        while (Offset != 0)
+        {
+            PCICapability* Capability = (PCICapability*)((uint64_t)Out.Header + Offset);
+
+            if (Capability->Vendor == PCI_CAPABILITY_VENDOR)
+            {
+                switch (Capability->Type)
+                {
+                case VIRTIO_PCI_CAP_COMMON_CFG:
+                {
+                    Out.Common = (CommonConfig*)MapBAR(Out.Header, Capability->BAR, Capability->Offset, Capability->Size);
+                }
+                break;
+                case VIRTIO_PCI_CAP_NOTIFY_CFG:
+                {
+                    Out.NotifyBase = MapBAR(Out.Header, Capability->BAR, Capability->Offset, Capability->Size);
+                    Out.NotifyMultiplier = *(uint32_t*)((uint64_t)Capability + sizeof(PCICapability));
+                }
+                break;
+                case VIRTIO_PCI_CAP_ISR_CFG:
+                {
+                    Out.ISR = (uint8_t*)MapBAR(Out.Header, Capability->BAR, Capability->Offset, Capability->Size);
+                }
+                break;
+                case VIRTIO_PCI_CAP_DEVICE_CFG:
+                {
+                    Out.DeviceConfig = (uint8_t*)MapBAR(Out.Header, Capability->BAR, Capability->Offset, Capability->Size);
+                }
+                break;
+                }
+            }
+
+            Offset = Capability->Next & ~0b11;
+        }
+
+        if (Out.Common == nullptr || Out.NotifyBase == 0)
+        {
+            return false;
+        }
+
+        Out.Common->DeviceStatus = 0;
+        while (Out.Common->DeviceStatus != 0)
+        {
+            asm volatile ("PAUSE");
+        }
+
+        Out.Common->DeviceStatus = VIRTIO_STATUS_ACKNOWLEDGE;
+        Out.Common->DeviceStatus = VIRTIO_STATUS_ACKNOWLEDGE | VIRTIO_STATUS_DRIVER;
+
+        Features |= VIRTIO_F_VERSION_1;
+
+        Out.Common->DeviceFeatureSelect = 0;
+        uint64_t Offered = Out.Common->DeviceFeature;
+        Out.Common->DeviceFeatureSelect = 1;
+        Offered |= (uint64_t)Out.Common->DeviceFeature << 32;
+
+        if ((Offered & Features) != Features)
+        {
+            return false;
+        }
+
+        Out.Common->DriverFeatureSelect = 0;
+        Out.Common->DriverFeature = (uint32_t)Features;
+        Out.Common->DriverFeatureSelect = 1;
+        Out.Common->DriverFeature = (uint32_t)(Features >> 32);
+
+        Out.Common->DeviceStatus = VIRTIO_STATUS_ACKNOWLEDGE | VIRTIO_STATUS_DRIVER | VIRTIO_STATUS_FEATURES_OK;
+        return Out.Common->DeviceStatus & VIRTIO_STATUS_FEATURES_OK;
+    }
+
+    bool SetupQueue(Device& Dev, uint16_t Index, Queue& Out)
+    {
+        Dev.Common->QueueSelect = Index;
+
+        uint16_t Size = Dev.Common->QueueSize;
+        if (Size == 0)
+        {
+            return false;
+        }
+        Size = Size > VIRTIO_QUEUE_SIZE ? VIRTIO_QUEUE_SIZE : Size;
+        Dev.Common->QueueSize = Size;
+
+        uint64_t Page = (uint64_t)PageAllocator::RequestPage();
+        STL::SetMemory((void*)Page, 0, 4096);
+
+        Out.Index = Index;
+        Out.Size = Size;
+        Out.LastUsed = 0;
+        Out.Descriptors = (QueueDescriptor*)Page;
+        Out.Available = (QueueAvailable*)(Page + 1024);
+        Out.Used = (QueueUsed*)(Page + 2048);
+        Out.Notify = (uint16_t*)(Dev.NotifyBase + Dev.Common->QueueNotifyOffset * Dev.NotifyMultiplier);
+
+        Dev.Common->QueueDescriptorLow = (uint32_t)(uint64_t)Out.Descriptors;
+        Dev.Common->QueueDescriptorHigh = (uint32_t)((uint64_t)Out.Descriptors >> 32);
+        Dev.Common->QueueDriverLow = (uint32_t)(uint64_t)Out.Available;
+        Dev.Common->QueueDriverHigh = (uint32_t)((uint64_t)Out.Available >> 32);
+        Dev.Common->QueueDeviceLow = (uint32_t)(uint64_t)Out.Used;
+        Dev.Common->QueueDeviceHigh = (uint32_t)((uint64_t)Out.Used >> 32);
+        Dev.Common->QueueEnable = 1;
+
+        return true;
+    }
+
+    void Start(Device& Dev)
+    {
+        Dev.Common->DeviceStatus = Dev.Common->DeviceStatus | VIRTIO_STATUS_DRIVER_OK;
+    }
+
+    void Send(Queue& Target, void* Request, uint32_t RequestSize, void* Response, uint32_t ResponseSize)
+    {
+        //Requests are synchronous, so the same two descriptors are used every time.
+        Target.Descriptors[0].Address = (uint64_t)Request;
+        Target.Descriptors[0].Length = RequestSize;
+        Target.Descriptors[0].Flags = VIRTIO_DESCRIPTOR_NEXT;
+        Target.Descriptors[0].Next = 1;
+
+        Target.Descriptors[1].Address = (uint64_t)Response;
+        Target.Descriptors[1].Length = ResponseSize;
+        Target.Descriptors[1].Flags = VIRTIO_DESCRIPTOR_WRITE;
+        Target.Descriptors[1].Next = 0;
+
+        Target.Available->Ring[Target.Available->Index % Target.Size] = 0;
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        Target.Available->Index = Target.Available->Index + 1;
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+        *Target.Notify = Target.Index;
+
+        while (Target.Used->Index == Target.LastUsed)
+        {
+            asm volatile ("PAUSE");
+        }
+        Target.LastUsed++;
+    }
+}
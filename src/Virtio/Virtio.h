@@ -0,0 +1,118 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "PCI/PCI.h"
+
+#define VIRTIO_VENDOR_ID 0x1AF4
+#define VIRTIO_MODERN_DEVICE_ID 0x1040 //Modern device IDs are this plus the virtio device type.
+
+#define VIRTIO_QUEUE_SIZE 16
+
+#define VIRTIO_DESCRIPTOR_NEXT 1
+#define VIRTIO_DESCRIPTOR_WRITE 2
+
+namespace Virtio
+{
+    struct CommonConfig
+    {
+        uint32_t DeviceFeatureSelect;
+        uint32_t DeviceFeature;
+        uint32_t DriverFeatureSelect;
+        uint32_t DriverFeature;
+        uint16_t ConfigMSIXVector;
+        uint16_t QueueAmount;
+        uint8_t DeviceStatus;
+        uint8_t ConfigGeneration;
+        uint16_t QueueSelect;
+        uint16_t QueueSize;
+        uint16_t QueueMSIXVector;
+        uint16_t QueueEnable;
+        uint16_t QueueNotifyOffset;
+        uint32_t QueueDescriptorLow;
+        uint32_t QueueDescriptorHigh;
+        uint32_t QueueDriverLow;
+        uint32_t QueueDriverHigh;
+        uint32_t QueueDeviceLow;
+        uint32_t QueueDeviceHigh;
+    } __attribute__((packed));
+
+    struct QueueDescriptor
+    {
+        uint64_t Address;
+        uint32_t Length;
+        uint16_t Flags;
+        uint16_t Next;
+    } __attribute__((packed));
+
+    struct QueueAvailable
+    {
+        uint16_t Flags;
+        uint16_t Index;
+        uint16_t Ring[VIRTIO_QUEUE_SIZE];
+    } __attribute__((packed));
+
+    struct QueueUsedElement
+    {
+        uint32_t ID;
+        uint32_t Length;
+    } __attribute__((packed));
+
+    struct QueueUsed
+    {
+        uint16_t Flags;
+        uint16_t Index;
+        QueueUsedElement Ring[VIRTIO_QUEUE_SIZE];
+    } __attribute__((packed));
+
+    /// <summary>
+    /// A split virtqueue, all three parts live in one identity mapped page.
+    /// </summary>
+    struct Queue
+    {
+        uint16_t Index;
+        uint16_t Size;
+        uint16_t LastUsed;
+
+        volatile QueueDescriptor* Descriptors;
+        volatile QueueAvailable* Available;
+        volatile QueueUsed* Used;
+        volatile uint16_t* Notify;
+    };
+
+    /// <summary>
+    /// A virtio device using the modern PCI transport.
+    /// </summary>
+    struct Device
+    {
+        PCIHeader* Header;
+
+        volatile CommonConfig* Common;
+        volatile uint8_t* ISR;
+        volatile uint8_t* DeviceConfig;
+
+        uint64_t NotifyBase;
+        uint32_t NotifyMultiplier;
+    };
+
+    /// <summary>
+    /// Finds the modern virtio device of Type, resets it and negotiates VIRTIO_F_VERSION_1 and Features.
+    /// Returns false if there is no such device or it does not accept the features.
+    /// </summary>
+    bool Init(Device& Out, uint16_t Type, uint64_t Features);
+
+    /// <summary>
+    /// Allocates and enables virtqueue Index, must be called between Init and Start.
+    /// </summary>
+    bool SetupQueue(Device& Dev, uint16_t Index, Queue& Out);
+
+    /// <summary>
+    /// Tells the device the driver is ready, after this the queues can be used.
+    /// </summary>
+    void Start(Device& Dev);
+
+    /// <summary>
+    /// Sends a request buffer and a response buffer, both identity mapped, and waits for the device to use them.
+    /// </summary>
+    void Send(Queue& Target, void* Request, uint32_t RequestSize, void* Response, uint32_t ResponseSize);
+}
@@ -0,0 +1,254 @@
+#include "VirtioGPU.h"
+
+#include "STL/Memory/Memory.h"
+
+#include "Virtio/Virtio.h"
+#include "Memory/Paging/PageTable.h"
+#include "Memory/Paging/PageAllocator.h"
+
+#define VIRTIO_GPU_CMD_RESOURCE_CREATE_2D 0x0101
+#define VIRTIO_GPU_CMD_SET_SCANOUT 0x0103
+#define VIRTIO_GPU_CMD_RESOURCE_FLUSH 0x0104
+#define VIRTIO_GPU_CMD_TRANSFER_TO_HOST_2D 0x0105
+#define VIRTIO_GPU_CMD_RESOURCE_ATTACH_BACKING 0x0106
+
+#define VIRTIO_GPU_RESP_OK_NODATA 0x1100
+
+#define VIRTIO_GPU_FORMAT_B8G8R8X8_UNORM 2
+
+#define VIRTIOGPU_CONTROL_QUEUE 0
+#define VIRTIOGPU_RESOURCE_ID 1
+#define VIRTIOGPU_FRAMEBUFFER_BASE 0x140000000000 //Unused virtual address range, the backing pages are mapped here to be contiguous.
+
+namespace VirtioGPU
+{
+    struct ControlHeader
+    {
+        uint32_t Type;
+        uint32_t Flags;
+        uint64_t FenceID;
+        uint32_t ContextID;
+        uint32_t Padding;
+    } __attribute__((packed));
+
+    struct Rect
+    {
+        uint32_t X;
+        uint32_t Y;
+        uint32_t Width;
+        uint32_t Height;
+    } __attribute__((packed));
+
+    struct ResourceCreate2D
+    {
+        ControlHeader Header;
+        uint32_t ResourceID;
+        uint32_t Format;
+        uint32_t Width;
+        uint32_t Height;
+    } __attribute__((packed));
+
+    struct MemoryEntry
+    {
+        uint64_t Address;
+        uint32_t Length;
+        uint32_t Padding;
+    } __attribute__((packed));
+
+    struct ResourceAttachBacking
+    {
+        ControlHeader Header;
+        uint32_t ResourceID;
+        uint32_t EntryAmount;
+        MemoryEntry Entries[];
+    } __attribute__((packed));
+
+    struct SetScanout
+    {
+        ControlHeader Header;
+        Rect Area;
+        uint32_t ScanoutID;
+        uint32_t ResourceID;
+    } __attribute__((packed));
+
+    struct TransferToHost2D
+    {
+        ControlHeader Header;
+        Rect Area;
+        uint64_t Offset;
+        uint32_t ResourceID;
+        uint32_t Padding;
+    } __attribute__((packed));
+
+    struct ResourceFlush
+    {
+        ControlHeader Header;
+        Rect Area;
+        uint32_t ResourceID;
+        uint32_t Padding;
+    } __attribute__((packed));
+
+    Virtio::Device Device;
+    Virtio::Queue ControlQueue;
+
+    /// <summary>
+    /// One identity mapped page each for the command being sent and the reply to it.
+    /// </summary>
+    uint8_t* Request = nullptr;
+    ControlHeader* Response = nullptr;
+
+    STL::Framebuffer Framebuffer;
+
+    bool Found = false;
+
+    /// <summary>
+    /// Sends the command in the request page and returns true if the device answered OK_NODATA.
+    /// </summary>
+    bool Send(uint32_t Size)
+    {
+        Response->Type = 0;
+        Virtio::Send(ControlQueue, Request, Size, Response, sizeof(ControlHeader));
+        return Response->Type == VIRTIO_GPU_RESP_OK_NODATA;
+    }
+
+    template <typename T>
+    T* NewCommand(uint32_t Type)
+    {
+        STL::SetMemory(Request, 0, sizeof(T));
+        ((ControlHeader*)Request)->Type = Type;
+        return (T*)Request;
+    }
+
+    bool Init()
+    {
+        Found = false;
+
+        if (!Virtio::Init(Device, VIRTIOGPU_DEVICE_TYPE, 0))
+        {
+            return false;
+        }
+
+        if (!Virtio::SetupQueue(Device, VIRTIOGPU_CONTROL_QUEUE, ControlQueue))
+        {
+            return false;
+        }
+
+        Virtio::Start(Device);
+
+        if (Request == nullptr)
+        {
+            Request = (uint8_t*)PageAllocator::RequestPage();
+            Response = (ControlHeader*)PageAllocator::RequestPage();
+        }
+
+        Found = true;
+        return true;
+    }
+
+    bool SetMode(uint32_t Width, uint32_t Height)
+    {
+        if (!Found || Framebuffer.Base != nullptr)
+        {
+            return false;
+        }
+
+        ResourceCreate2D* Create = NewCommand<ResourceCreate2D>(VIRTIO_GPU_CMD_RESOURCE_CREATE_2D);
+        Create->ResourceID = VIRTIOGPU_RESOURCE_ID;
+        Create->Format = VIRTIO_GPU_FORMAT_B8G8R8X8_UNORM;
+        Create->Width = Width;
+        Create->Height = Height;
+        if (!Send(sizeof(ResourceCreate2D)))
+        {
+            return false;
+        }
+
+        //The backing is sent as runs of physically contiguous pages, the whole list has to fit in the request page.
+        uint64_t MaxEntries = (4096 - sizeof(ResourceAttachBacking)) / sizeof(MemoryEntry);
+        uint64_t Size = (uint64_t)Width * Height * 4;
+        uint64_t PageAmount = (Size + 4095) / 4096;
+
+        ResourceAttachBacking* Attach = NewCommand<ResourceAttachBacking>(VIRTIO_GPU_CMD_RESOURCE_ATTACH_BACKING);
+        Attach->ResourceID = VIRTIOGPU_RESOURCE_ID;
+        Attach->EntryAmount = 0;
+
+        for (uint64_t i = 0; i < PageAmount; i++)
+        {
+            uint64_t Page = (uint64_t)PageAllocator::RequestPage();
+            if (Page == 0)
+            {
+                return false;
+            }
+
+            MemoryEntry* Last = Attach->EntryAmount != 0 ? &Attach->Entries[Attach->EntryAmount - 1] : nullptr;
+            if (Last != nullptr && Last->Address + Last->Length == Page)
+            {
+                Last->Length += 4096;
+            }
+            else if (Attach->EntryAmount < MaxEntries)
+            {
+                Attach->Entries[Attach->EntryAmount].Address = Page;
+                Attach->Entries[Attach->EntryAmount].Length = 4096;
+                Attach->Entries[Attach->EntryAmount].Padding = 0;
+                Attach->EntryAmount++;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        //Mapping can allocate page tables, so it is only done once all the backing pages are taken.
+        uint64_t VirtualAddress = VIRTIOGPU_FRAMEBUFFER_BASE;
+        for (uint32_t i = 0; i < Attach->EntryAmount; i++)
+        {
+            for (uint64_t Offset = 0; Offset < Attach->Entries[i].Length; Offset += 4096)
+            {
+                PageTableManager::MapAddress((void*)VirtualAddress, (void*)(Attach->Entries[i].Address + Offset));
+                VirtualAddress += 4096;
+            }
+        }
+
+        if (!Send(sizeof(ResourceAttachBacking) + Attach->EntryAmount * sizeof(MemoryEntry)))
+        {
+            return false;
+        }
+
+        SetScanout* Scanout = NewCommand<SetScanout>(VIRTIO_GPU_CMD_SET_SCANOUT);
+        Scanout->Area = {0, 0, Width, Height};
+        Scanout->ScanoutID = 0;
+        Scanout->ResourceID = VIRTIOGPU_RESOURCE_ID;
+        if (!Send(sizeof(SetScanout)))
+        {
+            return false;
+        }
+
+        Framebuffer.Base = (STL::ARGB*)VIRTIOGPU_FRAMEBUFFER_BASE;
+        Framebuffer.Size = Size;
+        Framebuffer.Width = Width;
+        Framebuffer.Height = Height;
+        Framebuffer.PixelsPerScanline = Width;
+
+        return true;
+    }
+
+    STL::Framebuffer GetFramebuffer()
+    {
+        return Framebuffer;
+    }
+
+    void Flush(STL::Point TopLeft, STL::Point BottomRight)
+    {
+        Rect Area = {(uint32_t)TopLeft.X, (uint32_t)TopLeft.Y, (uint32_t)(BottomRight.X - TopLeft.X), (uint32_t)(BottomRight.Y - TopLeft.Y)};
+
+        TransferToHost2D* Transfer = NewCommand<TransferToHost2D>(VIRTIO_GPU_CMD_TRANSFER_TO_HOST_2D);
+        Transfer->Area = Area;
+        Transfer->Offset = ((uint64_t)Area.Y * Framebuffer.PixelsPerScanline + Area.X) * 4;
+        Transfer->ResourceID = VIRTIOGPU_RESOURCE_ID;
+        Send(sizeof(TransferToHost2D));
+
+        ResourceFlush* Flush = NewCommand<ResourceFlush>(VIRTIO_GPU_CMD_RESOURCE_FLUSH);
+        Flush->Area = Area;
+        Flush->ResourceID = VIRTIOGPU_RESOURCE_ID;
+        Send(sizeof(ResourceFlush));
+    }
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "STL/Graphics/Framebuffer.h"
+
+#define VIRTIOGPU_DEVICE_TYPE 16
+
+namespace VirtioGPU
+{
+    /// <summary>
+    /// Looks for a virtio-gpu device (-device virtio-gpu-pci) on the PCI bus and sets up its control queue, returns true if it was found.
+    /// </summary>
+    bool Init();
+
+    /// <summary>
+    /// Creates a Width by Height resource backed by guest memory and shows it on the first scanout.
+    /// Returns false if the device refused any of the commands.
+    /// </summary>
+    bool SetMode(uint32_t Width, uint32_t Height);
+
+    /// <summary>
+    /// Returns the guest memory backing the scanout, nothing reaches the screen until it is flushed.
+    /// </summary>
+    STL::Framebuffer GetFramebuffer();
+
+    /// <summary>
+    /// Transfers the area from TopLeft up to BottomRight to the host resource and flushes it to the screen.
+    /// </summary>
+    void Flush(STL::Point TopLeft, STL::Point BottomRight);
+}
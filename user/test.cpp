@@ -0,0 +1,77 @@
+#include <stdint.h>
+
+#include "STL/System/System.h"
+#include "STL/System/SystemPage.h"
+
+//A program for exec that touches every kind of page the loader fills in, run as "exec user/test ARGUMENT".
+//It exits with ARGUMENT squared if each page held what it should, and with 0 otherwise.
+
+#define TEST_WORDS 4096 //16 KiB, so every kind spans several pages.
+
+constexpr uint32_t Pattern(uint32_t Index)
+{
+    return Index * 2654435761u;
+}
+
+struct Table
+{
+    uint32_t Words[TEST_WORDS];
+
+    constexpr Table() : Words()
+    {
+        for (uint32_t i = 0; i < TEST_WORDS; i++)
+        {
+            this->Words[i] = Pattern(i);
+        }
+    }
+};
+
+//Read only pages, shared by every program using the image.
+static const Table ReadOnly;
+
+//Writable pages copied from the file.
+static Table Writable;
+
+//Writable pages past the end of the file, which start out zeroed.
+static uint32_t Zeroed[TEST_WORDS];
+
+uint64_t Syscall(uint64_t Selector, uint64_t Argument)
+{
+    uint64_t Result;
+    asm volatile ("SYSCALL" : "=a"(Result) : "a"(Selector), "D"(Argument) : "rcx", "r11", "memory");
+    return Result;
+}
+
+extern "C" void _start(uint64_t Argument)
+{
+    bool Passed = true;
+
+    //The stack grows into pages filled in on first touch as well.
+    volatile uint32_t Stack[TEST_WORDS];
+    for (uint32_t i = 0; i < TEST_WORDS; i++)
+    {
+        Stack[i] = Pattern(i);
+    }
+
+    for (uint32_t i = 0; i < TEST_WORDS; i++)
+    {
+        Passed &= ReadOnly.Words[i] == Pattern(i);
+        Passed &= Writable.Words[i] == Pattern(i);
+        Passed &= Zeroed[i] == 0;
+
+        Writable.Words[i] = ~Writable.Words[i];
+        Zeroed[i] = Stack[i];
+    }
+
+    for (uint32_t i = 0; i < TEST_WORDS; i++)
+    {
+        Passed &= Writable.Words[i] == ~Pattern(i);
+        Passed &= Zeroed[i] == Pattern(i);
+    }
+
+    //Mapped read only above the stack, a running clock shows the kernel keeps it up to date.
+    const STL::SystemPage* Page = (const STL::SystemPage*)Syscall(SYSCALL_SYSTEM_PAGE, 0);
+    Passed &= Page->GetTicks() != 0;
+
+    Syscall(SYSCALL_EXIT, Passed ? Argument * Argument : 0);
+}